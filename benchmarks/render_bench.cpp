@@ -0,0 +1,391 @@
+// Headless renderer throughput benchmark. Fixed scenes are drawn on SDL's software renderer
+// through the offscreen video driver, so it runs on CI machines with neither a display nor a GPU.
+//
+//   kraken_render_bench [--frames N] [--sprites N] [--scene NAME] [--simd scalar|sse41|avx2]
+//
+// Each scene reports the draw-path time per item, measured from the first draw call to the end
+// of the queue flush, and the average number of draw calls and geometry submissions per frame.
+
+#include <SDL3_image/SDL_image.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "KrakenEngine.hpp"
+#include "_sprite_kernel.hpp"
+
+namespace
+{
+constexpr int SCREEN_W = 640;
+constexpr int SCREEN_H = 360;
+constexpr int WARMUP_FRAMES = 3;
+
+struct Options
+{
+    int frames = 60;
+    size_t sprites = 10000;
+    std::string scene;
+    std::string simd;
+};
+
+struct Scene
+{
+    std::string name;
+    size_t items = 0;
+    std::function<void()> draw;
+};
+
+// Deterministic positions spread over an area a little larger than the screen, so a share of
+// every scene is culled
+std::vector<kn::Vec2> scatter(const size_t count)
+{
+    std::vector<kn::Vec2> points;
+    points.reserve(count);
+
+    uint32_t state = 0x12345678u;
+    const auto next = [&state]
+    {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<double>(state >> 8) / static_cast<double>(1u << 24);
+    };
+
+    for (size_t i = 0; i < count; ++i)
+        points.emplace_back(next() * SCREEN_W * 1.25 - 16.0, next() * SCREEN_H * 1.25 - 16.0);
+
+    return points;
+}
+
+// Writes a 64x32 tile map with a 4x4 tileset and returns the path of the .tmx file
+std::filesystem::path writeTileMap(const std::filesystem::path& dir)
+{
+    constexpr int MAP_W = 64;
+    constexpr int MAP_H = 32;
+    constexpr int TILE = 16;
+
+    std::filesystem::create_directories(dir);
+
+    const kn::PixelArray tiles(TILE * 4, TILE * 4);
+    for (int i = 0; i < 16; ++i)
+    {
+        SDL_Surface* surface = tiles.getSDL();
+        const auto shade = static_cast<Uint8>(40 + i * 12);
+        const SDL_Rect area{(i % 4) * TILE, (i / 4) * TILE, TILE, TILE};
+        SDL_FillSurfaceRect(surface, &area, SDL_MapSurfaceRGBA(surface, shade, shade, 255, 255));
+    }
+    if (!IMG_SavePNG(tiles.getSDL(), (dir / "tiles.png").string().c_str()))
+        throw std::runtime_error("Failed to write tileset: " + std::string(SDL_GetError()));
+
+    std::ofstream tmx(dir / "bench.tmx");
+    tmx << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        << "<map version=\"1.10\" orientation=\"orthogonal\" renderorder=\"right-down\" width=\""
+        << MAP_W << "\" height=\"" << MAP_H << "\" tilewidth=\"" << TILE << "\" tileheight=\""
+        << TILE << "\" infinite=\"0\" nextlayerid=\"2\" nextobjectid=\"1\">\n"
+        << " <tileset firstgid=\"1\" name=\"tiles\" tilewidth=\"" << TILE << "\" tileheight=\""
+        << TILE << "\" tilecount=\"16\" columns=\"4\">\n"
+        << "  <image source=\"tiles.png\" width=\"" << TILE * 4 << "\" height=\"" << TILE * 4
+        << "\"/>\n"
+        << " </tileset>\n"
+        << " <layer id=\"1\" name=\"ground\" width=\"" << MAP_W << "\" height=\"" << MAP_H
+        << "\">\n"
+        << "  <data encoding=\"csv\">\n";
+
+    for (int y = 0; y < MAP_H; ++y)
+    {
+        for (int x = 0; x < MAP_W; ++x)
+        {
+            tmx << ((x * 7 + y * 3) % 16 + 1);
+            if (x + 1 < MAP_W || y + 1 < MAP_H)
+                tmx << ',';
+        }
+        tmx << '\n';
+    }
+
+    tmx << "  </data>\n"
+        << " </layer>\n"
+        << "</map>\n";
+
+    return dir / "bench.tmx";
+}
+
+Options parseOptions(const int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--frames" && hasValue)
+            options.frames = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--sprites" && hasValue)
+            options.sprites = static_cast<size_t>(std::max(1, std::atoi(argv[++i])));
+        else if (arg == "--scene" && hasValue)
+            options.scene = argv[++i];
+        else if (arg == "--simd" && hasValue)
+            options.simd = argv[++i];
+        else
+            throw std::invalid_argument("Unknown argument: " + arg);
+    }
+    return options;
+}
+
+void applySimdLevel(const std::string& name)
+{
+    using kn::renderer::kernel::SimdLevel;
+
+    if (name.empty())
+        return;
+    if (name == "scalar")
+        kn::renderer::kernel::setSimdLevel(SimdLevel::Scalar);
+    else if (name == "sse41")
+        kn::renderer::kernel::setSimdLevel(SimdLevel::SSE41);
+    else if (name == "avx2")
+        kn::renderer::kernel::setSimdLevel(SimdLevel::AVX2);
+    else
+        throw std::invalid_argument("Unknown SIMD level: " + name);
+}
+
+const char* simdName(const kn::renderer::kernel::SimdLevel level)
+{
+    switch (level)
+    {
+    case kn::renderer::kernel::SimdLevel::AVX2:
+        return "avx2";
+    case kn::renderer::kernel::SimdLevel::SSE41:
+        return "sse41";
+    default:
+        return "scalar";
+    }
+}
+
+void runScene(const Scene& scene, const int frames)
+{
+    using Clock = std::chrono::steady_clock;
+
+    double drawNs = 0.0;
+    double frameNs = 0.0;
+    uint64_t drawCalls = 0;
+    uint64_t geometryCalls = 0;
+
+    for (int frame = -WARMUP_FRAMES; frame < frames; ++frame)
+    {
+        kn::renderer::clear(kn::Color{0, 0, 0, 255});
+
+        const auto start = Clock::now();
+        scene.draw();
+        kn::renderer::_flush();
+        const auto drawn = Clock::now();
+        kn::renderer::present();
+        const auto presented = Clock::now();
+
+        if (frame < 0)
+            continue;
+
+        drawNs += std::chrono::duration<double, std::nano>(drawn - start).count();
+        frameNs += std::chrono::duration<double, std::nano>(presented - start).count();
+
+        const kn::renderer::FrameStats stats = kn::renderer::getFrameStats();
+        drawCalls += stats.drawCalls;
+        geometryCalls += stats.geometryCalls;
+    }
+
+    const double perItem = drawNs / frames / static_cast<double>(std::max<size_t>(scene.items, 1));
+    std::printf(
+        "%-14s %8zu %12.1f %12.3f %12.3f", scene.name.c_str(), scene.items, perItem,
+        drawNs / frames / 1e6, frameNs / frames / 1e6
+    );
+    if (kn::renderer::isFrameStatsEnabled())
+    {
+        std::printf(
+            " %10.1f %10.1f\n", static_cast<double>(drawCalls) / frames,
+            static_cast<double>(geometryCalls) / frames
+        );
+    }
+    else
+    {
+        std::printf(" %10s %10s\n", "-", "-");
+    }
+}
+
+int runBenchmarks(const Options& options)
+{
+    using namespace kn;
+
+    const size_t n = options.sprites;
+    const std::vector<Vec2> points = scatter(n);
+
+    PixelArray spritePixels(16, 16);
+    spritePixels.fill(Color{255, 200, 80, 255});
+    const auto sprite = std::make_shared<Texture>(spritePixels);
+
+    std::vector<Transform> transforms;
+    transforms.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+        transforms.push_back({points[i], static_cast<double>(i % 628) * 0.01, Vec2{1.0}});
+
+    renderer::Batcher batcher;
+    batcher.preallocate(n);
+
+    // Float columns, as the NumPy batch path receives them
+    std::vector<float> xs(n);
+    std::vector<float> ys(n);
+    std::vector<float> angles(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        xs[i] = static_cast<float>(points[i].x);
+        ys[i] = static_cast<float>(points[i].y);
+        angles[i] = static_cast<float>(transforms[i].angle);
+    }
+    std::vector<SDL_Vertex> kernelVertices(n * 4);
+
+    renderer::StaticBatch staticBatch(sprite);
+    for (const Transform& transform : transforms)
+        staticBatch.add(transform);
+
+    const size_t shapeCount = std::max<size_t>(n / 10, 1);
+    std::vector<Circle> circles;
+    std::vector<Rect> rects;
+    std::vector<Polygon> polygons;
+    for (size_t i = 0; i < shapeCount; ++i)
+    {
+        circles.emplace_back(points[i], 6.0);
+        rects.emplace_back(points[i], 12.0, 8.0);
+        polygons.emplace_back(6, 8.0, points[i]);
+    }
+
+    const auto mapDir = std::filesystem::temp_directory_path() / "kraken_render_bench";
+    tilemap::Map map(writeTileMap(mapDir));
+
+    Font font("kraken-modern", 16);
+    std::vector<std::unique_ptr<Text>> texts;
+    for (int i = 0; i < 100; ++i)
+        texts.push_back(std::make_unique<Text>(font, "Kraken " + std::to_string(i)));
+
+    std::vector<Scene> scenes;
+    scenes.push_back(
+        {"draw", n,
+         [&]
+         {
+             for (const Transform& transform : transforms)
+                 renderer::draw(*sprite, transform);
+         }}
+    );
+    scenes.push_back(
+        {"draw_batch", n,
+         [&]
+         {
+             renderer::drawBatch(
+                 *sprite, transforms, Anchor::TOP_LEFT, Anchor::CENTER, std::nullopt, &batcher
+             );
+         }}
+    );
+    scenes.push_back(
+        {"kernel_batch", n,
+         [&]
+         {
+             renderer::kernel::BatchParams params;
+             params.clipW = 16.0f;
+             params.clipH = 16.0f;
+             params.invTexW = 1.0f / 16.0f;
+             params.invTexH = 1.0f / 16.0f;
+             params.viewW = static_cast<float>(SCREEN_W);
+             params.viewH = static_cast<float>(SCREEN_H);
+
+             renderer::kernel::InstanceSpan span;
+             span.count = n;
+             span.x = xs.data();
+             span.y = ys.data();
+             span.angle = angles.data();
+
+             const size_t quads =
+                 renderer::kernel::generateQuads(params, span, kernelVertices.data());
+             renderer::_submitBatch(sprite->getSDL(), kernelVertices.data(), quads, 0, 0.0);
+         }}
+    );
+    scenes.push_back({"static_batch", n, [&] { staticBatch.draw(); }});
+    scenes.push_back(
+        {"circles", shapeCount, [&] { draw::circles(circles, Color{80, 200, 255, 255}); }}
+    );
+    scenes.push_back(
+        {"rects", shapeCount, [&] { draw::rects(rects, Color{120, 255, 120, 255}); }}
+    );
+    scenes.push_back(
+        {"polygons", shapeCount, [&] { draw::polygons(polygons, Color{255, 120, 200, 255}); }}
+    );
+    scenes.push_back({"tilemap", 64 * 32, [&] { map.draw(); }});
+    scenes.push_back(
+        {"text", texts.size(),
+         [&]
+         {
+             for (size_t i = 0; i < texts.size(); ++i)
+                 texts[i]->draw(points[i % points.size()]);
+         }}
+    );
+
+    std::printf(
+        "renderer: %s, simd: %s, frames: %d\n\n", SDL_GetRendererName(renderer::_get()),
+        simdName(renderer::kernel::getSimdLevel()), options.frames
+    );
+    std::printf(
+        "%-14s %8s %12s %12s %12s %10s %10s\n", "scene", "items", "ns/item", "draw ms",
+        "frame ms", "calls", "geometry"
+    );
+
+    bool ran = false;
+    for (const Scene& scene : scenes)
+    {
+        if (!options.scene.empty() && options.scene != scene.name)
+            continue;
+
+        runScene(scene, options.frames);
+        ran = true;
+    }
+
+    if (!ran)
+    {
+        std::fprintf(stderr, "Unknown scene: %s\n", options.scene.c_str());
+        return 1;
+    }
+
+    return 0;
+}
+}  // namespace
+
+int main(const int argc, char** argv)
+{
+    try
+    {
+        const Options options = parseOptions(argc, argv);
+        applySimdLevel(options.simd);
+
+        // Offscreen needs no display server. Dummy covers SDL builds without it.
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen,dummy");
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+
+        kn::init();
+        kn::renderer::setRenderBackend(kn::RenderBackend::Software);
+        kn::window::create("Kraken render benchmark", SCREEN_W, SCREEN_H, false);
+
+        const int result = runBenchmarks(options);
+
+        kn::quit();
+        return result;
+    }
+    catch (const std::exception& e)
+    {
+        std::fprintf(stderr, "render bench: %s\n", e.what());
+        kn::quit();
+        return 1;
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#ifdef KRAKEN_ENABLE_PYTHON
+#include <nanobind/nanobind.h>
+#endif  // KRAKEN_ENABLE_PYTHON
+
+#include <functional>
+#include <memory>
+
+#include "Math.hpp"
+#include "Texture.hpp"
+#include "_globals.hpp"
+
+#ifdef KRAKEN_ENABLE_PYTHON
+namespace nb = nanobind;
+#endif  // KRAKEN_ENABLE_PYTHON
+
+namespace kn
+{
+namespace renderer
+{
+// Render-to-texture cache for content that rarely changes, such as HUD frames, minimaps or
+// background composites. The record callback draws the content into the layer's own texture,
+// and until the layer is invalidated or resized, drawing it costs a single quad.
+//
+// Content is recorded in layer coordinates, from (0, 0) to the layer size, through a temporary
+// camera that applies the layer's scale. The layer is drawn either in screen space or in world
+// space, where the active camera moves, rotates and zooms it like a sprite.
+class CachedLayer
+{
+  public:
+    using RecordFunc = std::function<void()>;
+
+    CachedLayer(
+        const Vec2& size, RecordFunc record, double scale = 1.0, bool worldSpace = false,
+        FilterMode filter = FilterMode::Default
+    );
+    ~CachedLayer() = default;
+
+    // The content is recorded again on the next draw
+    void invalidate();
+    [[nodiscard]] bool isValid() const;
+
+    void setSize(const Vec2& size);
+    [[nodiscard]] Vec2 getSize() const;
+
+    // Texture pixels per layer unit. Raise it for world-space layers seen through a zoomed camera.
+    void setScale(double scale);
+    [[nodiscard]] double getScale() const;
+
+    void setWorldSpace(bool worldSpace);
+    [[nodiscard]] bool isWorldSpace() const;
+
+    void setRecord(RecordFunc record);
+
+    // Records the content now if the layer is invalid, instead of on the next draw
+    void update();
+
+    // The cached texture, recorded first if the layer is invalid
+    [[nodiscard]] const std::shared_ptr<Texture>& getTexture();
+
+    // pos is the top left corner, in screen pixels or world units depending on the layer
+    void draw(const Vec2& pos = {}, int layer = 0, double depth = 0.0);
+
+  private:
+    Vec2 m_size{};
+    double m_scale = 1.0;
+    bool m_worldSpace = false;
+    FilterMode m_filter = FilterMode::Default;
+    RecordFunc m_record;
+
+    std::shared_ptr<Texture> m_texture = nullptr;
+    bool m_valid = false;
+    bool m_recording = false;
+
+    void _record();
+};
+
+#ifdef KRAKEN_ENABLE_PYTHON
+void _bindCachedLayer(nb::module_& subRenderer);
+#endif  // KRAKEN_ENABLE_PYTHON
+}  // namespace renderer
+}  // namespace kn
@@ -5,6 +5,7 @@
 #endif  // KRAKEN_ENABLE_PYTHON
 
 #include "Math.hpp"
+#include "Rect.hpp"
 #include "Transform.hpp"
 
 #ifdef KRAKEN_ENABLE_PYTHON
@@ -25,6 +26,10 @@ class Camera
     void moveScreen(const Vec2& screenDelta);
     void rotate(double delta);
 
+    // Uniform scale from world units to screen pixels. Values above 1 zoom in.
+    void setZoom(double zoom);
+    [[nodiscard]] double getZoom() const;
+
     [[nodiscard]] Vec2 worldToScreen(const Vec2& worldPos) const;
     [[nodiscard]] Vec2 screenToWorld(const Vec2& screenPos) const;
 
@@ -32,10 +37,33 @@ class Camera
     void unset();
 
     static Camera* active;
+
+  private:
+    double m_zoom = 1.0;
 };
 
 namespace camera
 {
+// World to screen mapping of the active camera on the current render target. The snapshot is
+// rebuilt only when the camera, its transform or zoom, or the render target size changes, so
+// per-point conversions skip the render target query and trigonometry.
+struct View
+{
+    Vec2 pos{};
+    double angle = 0.0;
+    double zoom = 1.0;
+    double cos = 1.0;
+    double sin = 0.0;
+    Vec2 center{};      // Screen point that pos maps to
+    Vec2 resolution{};  // Size of the render target the view was built for
+    bool active = false;
+
+    [[nodiscard]] Vec2 worldToScreen(const Vec2& worldPos) const;
+    [[nodiscard]] Vec2 screenToWorld(const Vec2& screenPos) const;
+    // World-space box around the render target. Rotated views are bounded by the screen's half
+    // extents rotated into world space.
+    [[nodiscard]] Rect getWorldBounds() const;
+};
 
 #ifdef KRAKEN_ENABLE_PYTHON
 void _bind(nb::module_& module);
@@ -45,6 +73,9 @@ Camera* _getActiveCamera();
 
 Vec2 getActivePos();
 double getActiveAngle();
+double getActiveZoom();
+
+[[nodiscard]] const View& getView();
 
 [[nodiscard]] Vec2 worldToScreen(const Vec2& worldPos);
 [[nodiscard]] Vec2 screenToWorld(const Vec2& screenPos);
@@ -31,6 +31,59 @@ struct Vertex
     Vec2 texCoord;
 };
 
+namespace draw
+{
+// Float32 vertex data kept between frames in the layout the renderer reads, for meshes drawn
+// every frame. Colors and texture coordinates are optional. Without colors, every vertex uses
+// color.
+class Mesh
+{
+  public:
+    Color color = Color::WHITE;
+
+    Mesh() = default;
+    ~Mesh() = default;
+
+    // Packed [x, y] pairs
+    void setPositions(std::vector<float> positions);
+    // Packed [r, g, b, a] values from 0 to 1, one per vertex, or empty
+    void setColors(std::vector<float> colors);
+    // Packed [u, v] pairs, one per vertex, or empty
+    void setTexCoords(std::vector<float> texCoords);
+    // Triangle indices, or empty to draw the vertices as sequential triangles
+    void setIndices(std::vector<int> indices);
+
+    [[nodiscard]] const std::vector<float>& getPositions() const;
+    [[nodiscard]] const std::vector<float>& getColors() const;
+    [[nodiscard]] const std::vector<float>& getTexCoords() const;
+    [[nodiscard]] const std::vector<int>& getIndices() const;
+
+    [[nodiscard]] size_t getVertexCount() const;
+
+  private:
+    std::vector<float> m_positions;
+    std::vector<float> m_colors;
+    std::vector<float> m_texCoords;
+    std::vector<int> m_indices;
+};
+}  // namespace draw
+
+// How thick strokes meet at the corners of polylines and outlines
+enum class LineJoin
+{
+    Miter,
+    Bevel,
+    Round,
+};
+
+// How thick open strokes end
+enum class LineCap
+{
+    Butt,
+    Square,
+    Round,
+};
+
 namespace draw
 {
 #ifdef KRAKEN_ENABLE_PYTHON
@@ -39,24 +92,30 @@ void _bind(nb::module_& module);
 
 void _init(SDL_Renderer* renderer);
 
-void circle(const Circle& circle, const Color& color, double thickness = 0.0, int numSegments = 24);
+// Untextured shapes are merged into one renderer submission until a sprite, point, line or state
+// change needs the queue submitted. Enabled by default.
+void setBatchingEnabled(bool enabled);
+bool isBatchingEnabled();
+
+// Round shapes pick their segment count from their on-screen radius when numSegments is 0
+void circle(const Circle& circle, const Color& color, double thickness = 0.0, int numSegments = 0);
 void circles(
     const std::vector<Circle>& circles, const Color& color, double thickness = 0.0,
-    int numSegments = 24
+    int numSegments = 0
 );
 
 void capsule(
-    const Capsule& capsule, const Color& color, double thickness = 0.0, int numSegments = 24
+    const Capsule& capsule, const Color& color, double thickness = 0.0, int numSegments = 0
 );
 void capsules(
     const std::vector<Capsule>& capsules, const Color& color, double thickness = 0.0,
-    int numSegments = 24
+    int numSegments = 0
 );
 
-void ellipse(Rect bounds, const Color& color, double thickness = 0.0, int numSegments = 24);
+void ellipse(Rect bounds, const Color& color, double thickness = 0.0, int numSegments = 0);
 void ellipses(
     const std::vector<Rect>& bounds, const Color& color, double thickness = 0.0,
-    int numSegments = 24
+    int numSegments = 0
 );
 
 void point(Vec2 point, const Color& color);
@@ -82,26 +141,45 @@ void rects(
     double radiusBottomRight = -1.0, double radiusBottomLeft = -1.0
 );
 
-void polygon(const Polygon& polygon, const Color& color, bool filled = true);
-void polygons(const std::vector<Polygon>& polygons, const Color& color, bool filled = true);
+// Thick strokes are built as one mesh, with miter joins falling back to bevels past the limit
+void polygon(
+    const Polygon& polygon, const Color& color, bool filled = true, double thickness = 1.0,
+    LineJoin join = LineJoin::Miter
+);
+void polygons(
+    const std::vector<Polygon>& polygons, const Color& color, bool filled = true,
+    double thickness = 1.0, LineJoin join = LineJoin::Miter
+);
 
 void geometry(
     const Texture* texture, const std::vector<Vertex>& vertices,
     const std::vector<int>& indices = {}
 );
 
+// Hands float32 buffers to the renderer in place, with strides in bytes. Positions are only
+// copied when worldSpace is set and a camera is active. Without colors, every vertex uses color.
+void geometryRaw(
+    const Texture* texture, const float* positions, int positionStride, const float* colors,
+    int colorStride, const float* texCoords, int texCoordStride, int vertexCount,
+    const int* indices = nullptr, int indexCount = 0, const Color& color = Color::WHITE,
+    bool worldSpace = true
+);
+
+void mesh(const Mesh& mesh, const Texture* texture = nullptr, bool worldSpace = true);
+
 void bezier(
     const std::vector<Vec2>& controlPoints, const Color& color, double thickness = 1.0,
-    int numSegments = 24
+    int numSegments = 24, LineCap cap = LineCap::Butt
 );
 
 void sector(
     const Circle& circle, double startAngle, double endAngle, const Color& color,
-    double thickness = 0.0, int numSegments = 24
+    double thickness = 0.0, int numSegments = 0
 );
 
 void polyline(
-    const std::vector<Vec2>& points, const Color& color, double thickness = 1.0, bool closed = false
+    const std::vector<Vec2>& points, const Color& color, double thickness = 1.0, bool closed = false,
+    LineJoin join = LineJoin::Miter, LineCap cap = LineCap::Butt, double miterLimit = 4.0
 );
 }  // namespace draw
 }  // namespace kn
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#ifdef KRAKEN_ENABLE_PYTHON
+#include <nanobind/nanobind.h>
+#endif  // KRAKEN_ENABLE_PYTHON
+
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Rect.hpp"
+
+#ifdef KRAKEN_ENABLE_PYTHON
+namespace nb = nanobind;
+#endif  // KRAKEN_ENABLE_PYTHON
+
+namespace kn
+{
+namespace renderer
+{
+// Captures the current render target to image files without encoding on the main thread. Frames
+// wait in a fixed ring of slots for a background writer, so memory stays bounded however far
+// the writer falls behind.
+class FrameCapture
+{
+  public:
+    // When dropWhenFull is set, capture() skips frames while every slot is taken instead of
+    // waiting for the writer
+    explicit FrameCapture(size_t slotCount = 4, bool dropWhenFull = false);
+    ~FrameCapture();
+
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+
+    // Reads the current render target and queues it for writing. The format follows the file
+    // extension, .png or .bmp. Returns false if the frame was dropped.
+    bool capture(const std::filesystem::path& filePath, const Rect& src = {});
+
+    // Blocks until every queued frame has been written
+    void wait();
+
+    [[nodiscard]] size_t getPendingCount() const;
+    [[nodiscard]] size_t getWrittenCount() const;
+    [[nodiscard]] size_t getDroppedCount() const;
+    [[nodiscard]] size_t getSlotCount() const;
+
+  private:
+    enum class Format
+    {
+        PNG,
+        BMP,
+    };
+
+    struct Slot
+    {
+        SDL_Surface* surface = nullptr;
+        std::string path;
+        Format format = Format::PNG;
+    };
+
+    std::vector<Slot> m_slots;
+    size_t m_head = 0;   // Oldest queued slot, being written when m_count > 0
+    size_t m_count = 0;  // Queued slots, including the one being written
+    bool m_dropWhenFull = false;
+
+    size_t m_written = 0;
+    size_t m_dropped = 0;
+    std::string m_error;  // First write failure, rethrown on the main thread
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_queued;
+    std::condition_variable m_freed;
+    bool m_stopping = false;
+    std::thread m_writer;
+
+    void _writerLoop();
+    void _throwPendingError();
+};
+
+#ifdef KRAKEN_ENABLE_PYTHON
+void _bindFrameCapture(nb::module_& subRenderer);
+#endif  // KRAKEN_ENABLE_PYTHON
+}  // namespace renderer
+}  // namespace kn
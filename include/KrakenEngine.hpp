@@ -4,6 +4,7 @@
 #include <string>
 
 #include "AnimationController.hpp"
+#include "CachedLayer.hpp"
 #include "Camera.hpp"
 #include "Capsule.hpp"
 #include "Circle.hpp"
@@ -14,6 +15,7 @@
 #include "Ease.hpp"
 #include "Event.hpp"
 #include "Font.hpp"
+#include "FrameCapture.hpp"
 #include "Gamepad.hpp"
 #include "Input.hpp"
 #include "Key.hpp"
@@ -29,8 +31,10 @@
 #include "Rect.hpp"
 #include "Renderer.hpp"
 #include "Shaders.hpp"
+#include "StaticBatch.hpp"
 #include "Text.hpp"
 #include "Texture.hpp"
+#include "TextureAtlas.hpp"
 #include "TileMap.hpp"
 #include "Time.hpp"
 #include "Transform.hpp"
@@ -4,6 +4,8 @@
 #include <nanobind/nanobind.h>
 #endif  // KRAKEN_ENABLE_PYTHON
 
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "Math.hpp"
@@ -17,8 +19,6 @@ namespace kn
 class Polygon
 {
   public:
-    std::vector<Vec2> points;
-
     Polygon() = default;
     explicit Polygon(const std::vector<Vec2>& points);
     Polygon(uint32_t n, double radius, const Vec2& centroid = Vec2::ZERO);
@@ -47,6 +47,23 @@ class Polygon
     void scaleBy(const Vec2& factor);
     Polygon scaledBy(double factor) const;
     Polygon scaledBy(const Vec2& factor) const;
+
+    [[nodiscard]] const std::vector<Vec2>& getPoints() const;
+
+    // Replacing points drops the cached triangulation
+    void setPoints(const std::vector<Vec2>& newPoints);
+    void setPoint(size_t index, const Vec2& point);
+
+    // Triangle indices into the points, computed with earcut on first use and cached. Rotating,
+    // moving and scaling keep the cache, since an affine transform leaves every triangle valid.
+    // Copies share the cache until either one's points are replaced.
+    [[nodiscard]] const std::vector<uint32_t>& getTriangles() const;
+
+    void invalidateTriangles();
+
+  private:
+    std::vector<Vec2> m_points{};
+    mutable std::shared_ptr<const std::vector<uint32_t>> m_triangles = nullptr;
 };
 
 #ifdef KRAKEN_ENABLE_PYTHON
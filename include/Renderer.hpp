@@ -6,6 +6,7 @@
 #include <nanobind/nanobind.h>
 #endif  // KRAKEN_ENABLE_PYTHON
 
+#include <cstdint>
 #include <optional>
 #include <vector>
 
@@ -21,6 +22,7 @@ namespace nb = nanobind;
 namespace kn
 {
 class Texture;
+class TextureRegion;
 class PixelArray;
 
 enum class RenderBackend
@@ -30,10 +32,44 @@ enum class RenderBackend
     Vulkan,
     Metal,
     Direct3d12,
+    Software,
 };
 
 namespace renderer
 {
+// Caller-owned vertex buffer for drawBatch. Reusing one across frames keeps large batches from
+// reallocating their vertex storage every call.
+class Batcher
+{
+  public:
+    Batcher() = default;
+    ~Batcher() = default;
+
+    void preallocate(size_t nSprites);
+    void free();
+
+    [[nodiscard]] size_t getCapacity() const;
+
+  private:
+    std::vector<SDL_Vertex> m_vertices;
+
+    friend std::vector<SDL_Vertex>& _vertexBuffer(Batcher* batcher);
+};
+
+// Renderer work done during one frame, from one present() to the next
+struct FrameStats
+{
+    uint64_t drawCalls = 0;        // Draw calls made by the user, nested draws excluded
+    uint64_t geometryCalls = 0;    // SDL_RenderGeometry submissions
+    uint64_t primitiveCalls = 0;   // SDL point and line submissions
+    uint64_t vertices = 0;
+    uint64_t indices = 0;
+    uint64_t spritesDrawn = 0;
+    uint64_t spritesCulled = 0;    // Sprites and tiles skipped because they were off screen
+    uint64_t targetSwitches = 0;
+    uint64_t textureSwitches = 0;  // Texture changes between consecutive geometry submissions
+    double cpuTimeMs = 0.0;        // Time spent inside draw calls and queue flushes
+};
 
 #ifdef KRAKEN_ENABLE_PYTHON
 void _bind(nb::module_& module);
@@ -44,6 +80,21 @@ void _quit();
 SDL_Renderer* _get();
 SDL_GPUDevice* _getGPUDevice();
 bool _primaryActive();
+void _flush();
+// Draws quads sharing one texture, or queues them when sorting is enabled
+void _submitBatch(
+    SDL_Texture* texture, const SDL_Vertex* vertices, size_t quadCount, int layer, double depth
+);
+// Queues untextured triangles, merged with the shapes queued around them into one submission
+void _queueShape(
+    const SDL_Vertex* vertices, size_t vertexCount, const int* indices, size_t indexCount
+);
+// Sets the draw color used by points and lines, skipping the call if it is already current
+void _setDrawColor(const Color& color);
+void _onTextureDestroyed(const SDL_Texture* texture) noexcept;
+// Switches straight to an SDL target, nullptr being the window, bypassing the primary target
+void _setTargetSDL(SDL_Texture* target);
+std::vector<SDL_Vertex>& _vertexBuffer(Batcher* batcher);
 
 void setRenderBackend(RenderBackend backend);
 
@@ -65,24 +116,70 @@ FilterMode getDefaultFilterMode();
 
 void setTarget(const Texture* target);
 
+// Stats for the last completed frame. All zero when built without KRAKEN_FRAME_STATS.
+FrameStats getFrameStats();
+bool isFrameStatsEnabled();
+
+// When enabled, queued draws are ordered by (layer, depth, texture, blend mode) instead of call
+// order. Draws with equal keys keep their relative order.
+void setSortingEnabled(bool enabled);
+bool isSortingEnabled();
+
+// Array batches of at least this many instances generate their vertices on the worker threads
+void setParallelBatchThreshold(size_t threshold);
+size_t getParallelBatchThreshold();
+
+// Batches of at least this many instances are binned into a coarse grid over their positions
+// first, so whole cells outside the view are skipped before any per-sprite rotation math
+void setCullGridThreshold(size_t threshold);
+size_t getCullGridThreshold();
+
+// Threads used for large batches, including the calling thread. 0 picks one per logical core.
+void setBatchThreadCount(int count);
+int getBatchThreadCount();
+
 void draw(
     const Texture& texture, const Transform& transform = {}, const Vec2& anchor = Anchor::TOP_LEFT,
-    const Vec2& pivot = Anchor::CENTER
+    const Vec2& pivot = Anchor::CENTER, int layer = 0, double depth = 0.0
 );
 
 void draw(
-    const Texture& texture, Rect dst, double angle = 0.0, const Vec2& pivot = Anchor::CENTER
+    const Texture& texture, Rect dst, double angle = 0.0, const Vec2& pivot = Anchor::CENTER,
+    int layer = 0, double depth = 0.0
+);
+
+// Regions carry their own source area, flip, tint and alpha, so the texture is left untouched.
+// Atlas regions convert implicitly, and throw std::runtime_error once removed from their atlas.
+void draw(
+    const TextureRegion& region, const Transform& transform = {},
+    const Vec2& anchor = Anchor::TOP_LEFT, const Vec2& pivot = Anchor::CENTER, int layer = 0,
+    double depth = 0.0
+);
+
+void draw(
+    const TextureRegion& region, Rect dst, double angle = 0.0, const Vec2& pivot = Anchor::CENTER,
+    int layer = 0, double depth = 0.0
 );
 
 void draw9Slice(
     const Texture& texture, const Rect& dst, const Rect& slice,
-    const Vec2& anchor = Anchor::TOP_LEFT, const Vec2& pivot = Anchor::CENTER
+    const Vec2& anchor = Anchor::TOP_LEFT, const Vec2& pivot = Anchor::CENTER, int layer = 0,
+    double depth = 0.0
 );
 
 void drawBatch(
     const Texture& texture, const std::vector<Transform>& transforms,
     const Vec2& anchor = Anchor::TOP_LEFT, const Vec2& pivot = Anchor::CENTER,
-    const std::optional<std::vector<Rect>>& clipRects = std::nullopt
+    const std::optional<std::vector<Rect>>& clipRects = std::nullopt, Batcher* batcher = nullptr,
+    int layer = 0, double depth = 0.0
+);
+
+// Clip rects passed with a region are relative to the region's top left corner
+void drawBatch(
+    const TextureRegion& region, const std::vector<Transform>& transforms,
+    const Vec2& anchor = Anchor::TOP_LEFT, const Vec2& pivot = Anchor::CENTER,
+    const std::optional<std::vector<Rect>>& clipRects = std::nullopt, Batcher* batcher = nullptr,
+    int layer = 0, double depth = 0.0
 );
 
 }  // namespace renderer
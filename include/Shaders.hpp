@@ -10,6 +10,8 @@
 #include <type_traits>
 #include <vector>
 
+#include "Renderer.hpp"
+
 #ifdef KRAKEN_ENABLE_PYTHON
 namespace nb = nanobind;
 #endif  // KRAKEN_ENABLE_PYTHON
@@ -75,6 +77,7 @@ class Shader
             std::is_trivially_copyable_v<UniformType>, "Uniform data must be trivially copyable."
         );
 
+        renderer::_flush();
         SDL_SetGPURenderStateFragmentUniforms(m_renderState, binding, &data, sizeof(UniformType));
     }
 
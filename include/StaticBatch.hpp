@@ -0,0 +1,140 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#ifdef KRAKEN_ENABLE_PYTHON
+#include <nanobind/nanobind.h>
+#endif  // KRAKEN_ENABLE_PYTHON
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Color.hpp"
+#include "Math.hpp"
+#include "Rect.hpp"
+#include "Texture.hpp"
+#include "Transform.hpp"
+#include "_globals.hpp"
+
+#ifdef KRAKEN_ENABLE_PYTHON
+namespace nb = nanobind;
+#endif  // KRAKEN_ENABLE_PYTHON
+
+namespace kn
+{
+class TextureRegion;
+
+namespace renderer
+{
+// Retained quads for scenery that rarely changes. Instances are turned into world-space vertices
+// once, when added or updated, and stored in a coarse grid of cells. Drawing only applies the
+// active camera to the cells in view, and reuses last frame's vertices while the camera and the
+// contents are unchanged.
+class StaticBatch
+{
+  public:
+    using Handle = uint64_t;
+
+    explicit StaticBatch(std::shared_ptr<Texture> texture, double cellSize = 512.0);
+    ~StaticBatch() = default;
+
+    // Captures the texture's flip, tint and alpha at the time of the call
+    Handle add(
+        const Transform& transform, const Vec2& anchor = Anchor::TOP_LEFT,
+        const Vec2& pivot = Anchor::CENTER, const std::optional<Rect>& clipArea = std::nullopt,
+        const Color& color = Color::WHITE
+    );
+    // The region must be of the batch's texture. Its source area is captured, so instances of
+    // atlas regions need to be updated after the atlas is repacked.
+    Handle add(
+        const TextureRegion& region, const Transform& transform,
+        const Vec2& anchor = Anchor::TOP_LEFT, const Vec2& pivot = Anchor::CENTER
+    );
+
+    void update(
+        Handle handle, const Transform& transform, const Vec2& anchor = Anchor::TOP_LEFT,
+        const Vec2& pivot = Anchor::CENTER, const std::optional<Rect>& clipArea = std::nullopt,
+        const Color& color = Color::WHITE
+    );
+    void update(
+        Handle handle, const TextureRegion& region, const Transform& transform,
+        const Vec2& anchor = Anchor::TOP_LEFT, const Vec2& pivot = Anchor::CENTER
+    );
+
+    void remove(Handle handle);
+    void clear();
+
+    [[nodiscard]] bool contains(Handle handle) const;
+    [[nodiscard]] size_t getCount() const;
+    [[nodiscard]] size_t getCellCount() const;
+    [[nodiscard]] double getCellSize() const;
+    [[nodiscard]] const std::shared_ptr<Texture>& getTexture() const;
+
+    void draw(int layer = 0, double depth = 0.0);
+
+  private:
+    // (row, column), so ordered iteration walks the grid row by row
+    using CellKey = std::pair<int32_t, int32_t>;
+
+    struct Cell
+    {
+        Vec2 origin;                  // Vertex positions are stored relative to this
+        Rect bounds;                  // World-space bounds of everything added since compaction
+        std::vector<SDL_Vertex> vertices{};
+        std::vector<uint32_t> slots{};  // Owning slot per quad, DEAD_QUAD once removed
+        size_t deadQuads = 0;
+    };
+
+    struct Slot
+    {
+        uint32_t generation = 0;
+        bool alive = false;
+        CellKey cell{};
+        uint32_t quad = 0;
+    };
+
+    std::shared_ptr<Texture> m_texture = nullptr;
+    double m_cellSize = 0.0;
+
+    std::map<CellKey, Cell> m_cells{};
+    std::vector<Slot> m_slots{};
+    std::vector<uint32_t> m_freeSlots{};
+    size_t m_count = 0;
+
+    // Largest half extent of any instance, since instances are filed by their center
+    Vec2 m_maxExtent{};
+
+    // Screen-space vertices from the last draw and the view they were built for
+    std::vector<SDL_Vertex> m_screenVertices{};
+    size_t m_screenSprites = 0;  // Live quads among them, excluding removed ones not compacted yet
+    bool m_dirty = true;
+    Vec2 m_viewPos{};
+    double m_viewAngle = 0.0;
+    double m_viewZoom = 1.0;
+    Vec2 m_viewSize{};
+
+    uint32_t _allocateSlot();
+    // quad positions are relative to the origin of the cell holding bounds
+    Handle _insert(const SDL_Vertex (&quad)[4], const Rect& bounds, uint32_t slotIndex);
+    void _erase(Slot& slot);
+    // Overwrites the quad in place while it stays in its cell, otherwise moves it to the new cell
+    void _replace(Slot& slot, const SDL_Vertex (&quad)[4], const Rect& bounds);
+    void _compact(const CellKey& key);
+    Slot& _slot(Handle handle);
+    [[nodiscard]] CellKey _cellKey(const Rect& bounds) const;
+    [[nodiscard]] Vec2 _cellOrigin(const CellKey& key) const;
+    void _buildQuad(
+        SDL_Vertex (&quad)[4], Rect& bounds, const Transform& transform, const Vec2& anchor,
+        const Vec2& pivot, const Rect& clipArea, const Texture::Flip& flip,
+        const SDL_FColor& color
+    ) const;
+};
+
+#ifdef KRAKEN_ENABLE_PYTHON
+void _bindStaticBatch(nb::module_& subRenderer);
+#endif  // KRAKEN_ENABLE_PYTHON
+}  // namespace renderer
+}  // namespace kn
@@ -6,7 +6,9 @@
 #endif  // KRAKEN_ENABLE_PYTHON
 
 #include <filesystem>
+#include <memory>
 
+#include "Color.hpp"
 #include "Math.hpp"
 #include "Rect.hpp"
 #include "_flagenum.hpp"
@@ -19,7 +21,6 @@ namespace nb = nanobind;
 namespace kn
 {
 class PixelArray;
-struct Color;
 
 enum class TextureAccess
 {
@@ -102,6 +103,47 @@ class Texture
     bool _isValidUsage(TextureUsage usage) const;
 };
 
+class AtlasRegion;
+
+// Immutable draw parameters for part of a texture: the source area, flip, tint and alpha. Drawing
+// a region never touches the texture's own clip area, flip or SDL color state, so one texture can
+// back many differently flipped or tinted draws, and those draws still share a batch.
+class TextureRegion
+{
+  public:
+    // An empty srcRect covers the whole texture. There is no default constructor, so every region
+    // holds a drawable texture.
+    explicit TextureRegion(
+        std::shared_ptr<Texture> texture, const Rect& srcRect = {}, const Texture::Flip& flip = {},
+        const Color& tint = Color::WHITE, float alpha = 1.0f
+    );
+    // Snapshot of an atlas region's current placement, flip, tint and alpha. Implicit so draw
+    // calls take atlas handles directly. Throws std::runtime_error if the region was removed.
+    TextureRegion(const AtlasRegion& region);
+    ~TextureRegion() = default;
+
+    [[nodiscard]] const std::shared_ptr<Texture>& getTexture() const;
+    [[nodiscard]] const Rect& getSrcRect() const;
+    [[nodiscard]] const Texture::Flip& getFlip() const;
+    [[nodiscard]] const Color& getTint() const;
+    [[nodiscard]] float getAlpha() const;
+    [[nodiscard]] Vec2 getSize() const;
+
+    // Copies with one parameter changed, sharing the same texture. withSrcRect treats an empty
+    // rect like the constructor does.
+    [[nodiscard]] TextureRegion withSrcRect(const Rect& srcRect) const;
+    [[nodiscard]] TextureRegion withFlip(bool h, bool v) const;
+    [[nodiscard]] TextureRegion withTint(const Color& tint) const;
+    [[nodiscard]] TextureRegion withAlpha(float alpha) const;
+
+  private:
+    std::shared_ptr<Texture> m_texture = nullptr;
+    Rect m_srcRect{};
+    Texture::Flip m_flip{};
+    Color m_tint = Color::WHITE;
+    float m_alpha = 1.0f;
+};
+
 #ifdef KRAKEN_ENABLE_PYTHON
 namespace texture
 {
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#ifdef KRAKEN_ENABLE_PYTHON
+#include <nanobind/nanobind.h>
+#endif  // KRAKEN_ENABLE_PYTHON
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Color.hpp"
+#include "Math.hpp"
+#include "PixelArray.hpp"
+#include "Rect.hpp"
+#include "Texture.hpp"
+#include "_globals.hpp"
+
+#ifdef KRAKEN_ENABLE_PYTHON
+namespace nb = nanobind;
+#endif  // KRAKEN_ENABLE_PYTHON
+
+namespace kn
+{
+class TextureAtlas;
+
+// Lightweight handle to an image packed into a TextureAtlas. Copies share the same placement, so
+// handles stay valid when the atlas is repacked. Flip, tint and alpha are per handle. Drawing goes
+// through the TextureRegion from toRegion(), which bakes them into the vertex data so regions on
+// the same page share a single batch.
+class AtlasRegion
+{
+  public:
+    Texture::Flip flip;
+    Color tint = Color::WHITE;
+    float alpha = 1.0f;
+
+    AtlasRegion() = default;
+    ~AtlasRegion() = default;
+
+    [[nodiscard]] bool isValid() const;
+    [[nodiscard]] std::string getName() const;
+
+    [[nodiscard]] const std::shared_ptr<Texture>& getTexture() const;
+    [[nodiscard]] Rect getClipArea() const;
+
+    [[nodiscard]] int getWidth() const;
+    [[nodiscard]] int getHeight() const;
+    [[nodiscard]] Vec2 getSize() const;
+
+    // Snapshot of the current placement, flip, tint and alpha. Throws if the region was removed.
+    [[nodiscard]] TextureRegion toRegion() const;
+
+  private:
+    struct Slot
+    {
+        std::string name;
+        std::shared_ptr<Texture> page = nullptr;
+        Rect clipArea{};
+        bool valid = true;
+    };
+
+    std::shared_ptr<Slot> m_slot = nullptr;
+
+    explicit AtlasRegion(std::shared_ptr<Slot> slot);
+
+    friend class TextureAtlas;
+};
+
+class TextureAtlas
+{
+  public:
+    explicit TextureAtlas(
+        int pageWidth = 2048, int pageHeight = 2048, int padding = 2, int extrude = 1,
+        FilterMode filter = FilterMode::Default
+    );
+    ~TextureAtlas() = default;
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+    TextureAtlas(TextureAtlas&&) noexcept = default;
+    TextureAtlas& operator=(TextureAtlas&&) noexcept = default;
+
+    AtlasRegion add(const std::string& name, const PixelArray& pixelArray);
+    AtlasRegion add(const std::string& name, const std::filesystem::path& filePath);
+
+    [[nodiscard]] AtlasRegion get(const std::string& name) const;
+    [[nodiscard]] bool contains(const std::string& name) const;
+
+    void remove(const std::string& name);
+    void clear();
+
+    // Packs all live regions from scratch, largest first, into as few pages as possible
+    void repack();
+
+    [[nodiscard]] size_t getRegionCount() const;
+    [[nodiscard]] size_t getPageCount() const;
+    [[nodiscard]] std::shared_ptr<Texture> getPage(size_t index) const;
+    [[nodiscard]] Vec2 getPageSize() const;
+    [[nodiscard]] int getPadding() const;
+    [[nodiscard]] int getExtrude() const;
+
+    // Ratio of page area covered by live regions, useful to decide when to repack
+    [[nodiscard]] double getOccupancy() const;
+
+  private:
+    struct SkylineNode
+    {
+        int x;
+        int y;
+        int width;
+    };
+
+    struct Page
+    {
+        std::shared_ptr<Texture> texture = nullptr;
+        std::vector<SkylineNode> skyline{};
+        size_t regionCount = 0;
+    };
+
+    struct Entry
+    {
+        std::shared_ptr<AtlasRegion::Slot> slot;
+        PixelArray cell;  // Source image with extruded edges, kept for repacking
+        size_t pageIndex = 0;
+    };
+
+    int m_pageWidth = 0;
+    int m_pageHeight = 0;
+    int m_padding = 0;
+    int m_extrude = 0;
+    FilterMode m_filter = FilterMode::Default;
+
+    std::vector<Page> m_pages{};
+    std::unordered_map<std::string, Entry> m_entries{};
+
+    Page _newPage() const;
+    void _resetSkyline(Page& page) const;
+    bool _pack(Page& page, int width, int height, int& outX, int& outY) const;
+    void _place(Entry& entry);
+};
+
+#ifdef KRAKEN_ENABLE_PYTHON
+namespace texture_atlas
+{
+void _bind(const nb::module_& module);
+}  // namespace texture_atlas
+#endif  // KRAKEN_ENABLE_PYTHON
+
+}  // namespace kn
@@ -4,6 +4,7 @@
 #include <nanobind/nanobind.h>
 #endif  // KRAKEN_ENABLE_PYTHON
 
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <optional>
@@ -13,6 +14,7 @@
 
 #include "Color.hpp"
 #include "Math.hpp"
+#include "Polygon.hpp"
 #include "Rect.hpp"
 #include "Texture.hpp"
 #include "Transform.hpp"
@@ -114,6 +116,8 @@ class TileSet
     std::vector<Tile> m_tiles{};
     std::vector<uint32_t> m_tileIndex;
     std::shared_ptr<Texture> m_texture = nullptr;
+    std::filesystem::path m_imagePath{};
+    std::optional<Color> m_colorKey{};
 
     friend class Map;
 };
@@ -153,6 +157,7 @@ class TileLayer : public Layer
         uint8_t m_tilesetIdx = static_cast<uint8_t>(-1);  // -1 = unknown
 
         friend class Map;
+        friend class TileLayer;
 
       public:
         [[nodiscard]] uint32_t getID() const
@@ -177,11 +182,17 @@ class TileLayer : public Layer
         Rect rect;
     };
 
+    // Multiplied into every tile when drawn, like the opacity, so it never rebakes cached chunks
+    Color tint = Color::WHITE;
+
     TileLayer() = default;
     ~TileLayer() = default;
 
     [[nodiscard]] const std::vector<Tile>& getTiles() const;
 
+    // Replaces the tile in grid cell (x, y), or clears it when gid is 0
+    void setTile(int x, int y, uint32_t gid, uint8_t flipFlags = 0);
+
     [[nodiscard]] std::vector<TileResult> getFromArea(const Rect& area) const;
     [[nodiscard]] std::optional<TileResult> getFromPoint(const Vec2& position) const;
 
@@ -189,9 +200,47 @@ class TileLayer : public Layer
     void setOpacity(double value) override;
     double getOpacity() const override;
 
+    // Splits the layer into chunks of chunkSize x chunkSize tiles, each baked once into its own
+    // texture and drawn as a single quad. Only orthogonal maps whose tiles fit their cells are
+    // cached, other layers keep drawing tile by tile.
+    void setCacheEnabled(bool enabled);
+    [[nodiscard]] bool isCacheEnabled() const;
+
+    void setChunkSize(int tiles);
+    [[nodiscard]] int getChunkSize() const;
+
+    // Least recently drawn chunks are evicted while their textures exceed this many bytes
+    void setCacheBudget(size_t bytes);
+    [[nodiscard]] size_t getCacheBudget() const;
+    [[nodiscard]] size_t getCacheSize() const;
+
+    // Releases every chunk, so they are baked again when next drawn
+    void invalidateCache();
+
   private:
+    struct Chunk
+    {
+        std::shared_ptr<Texture> texture = nullptr;
+        size_t bytes = 0;
+        uint64_t lastDrawn = 0;
+        bool valid = false;  // False once a tile in the chunk changes
+    };
+
     std::vector<Tile> m_tiles{};
 
+    bool m_cacheEnabled = false;
+    int m_chunkSize = 32;
+    size_t m_cacheBudget = 64 * 1024 * 1024;
+    size_t m_cacheSize = 0;
+    uint64_t m_drawCount = 0;
+    int m_chunkColumns = 0;
+    std::vector<Chunk> m_chunks{};  // Row-major, allocated on the first cached draw
+
+    void _drawChunks(double angle, const Vec2& pivot, const SDL_FColor& color);
+    void _bakeChunk(Chunk& chunk, int x0, int y0, int columns, int rows);
+    void _releaseChunk(Chunk& chunk);
+    void _evictChunks();
+
     friend class Map;
 };
 
@@ -226,6 +275,8 @@ class MapObject
     [[nodiscard]] uint32_t getTileID() const;
     [[nodiscard]] tmx::Object::Shape getShapeType() const;
     [[nodiscard]] std::vector<Vec2> getVertices() const;
+    // Vertices of a polygon object, triangulated when the map is loaded
+    [[nodiscard]] const Polygon& getPolygon() const;
     [[nodiscard]] const TextProperties& getTextProperties() const;
 
   private:
@@ -236,6 +287,7 @@ class MapObject
     uint32_t m_tileId = 0;
     tmx::Object::Shape m_shape = tmx::Object::Shape::Rectangle;
     std::vector<Vec2> m_vertices{};
+    Polygon m_polygon{};
     TextProperties m_text{};
 
     friend class Map;
@@ -277,6 +329,8 @@ class ImageLayer : public Layer
 
   private:
     std::shared_ptr<Texture> m_texture = nullptr;
+    std::filesystem::path m_imagePath{};
+    std::optional<Color> m_colorKey{};
 
     friend class Map;
 };
@@ -292,6 +346,14 @@ class Map
     void draw(double angle = 0.0, const Vec2& pivot = Vec2{0.5, 0.5});
     void load(const std::filesystem::path& tmxPath);
 
+    // Writes the loaded map to a zstd-compressed binary file that loads without parsing any TMX.
+    // Image paths are stored relative to the compiled file.
+    void saveCompiled(const std::filesystem::path& path) const;
+    void loadCompiled(const std::filesystem::path& path);
+    // Relative image paths resolve against baseDir. The stream is read to its end, not closed.
+    void loadCompiled(SDL_IOStream* stream, const std::filesystem::path& baseDir = {});
+    void loadCompiled(const void* data, size_t size, const std::filesystem::path& baseDir = {});
+
     [[nodiscard]] tmx::Orientation getOrientation() const;
     [[nodiscard]] tmx::RenderOrder getRenderOrder() const;
     [[nodiscard]] Vec2 getMapSize() const;
@@ -319,6 +381,27 @@ class Map
     tmx::StaggerIndex m_staggerIndex = tmx::StaggerIndex::None;
     std::vector<TileSet> m_tileSets{};
     std::vector<std::shared_ptr<Layer>> m_layers{};
+
+    // Everything a tile layer needs to draw a GID, resolved once at load
+    struct TileRef
+    {
+        uint8_t tileSetIndex = static_cast<uint8_t>(-1);  // -1 if no tileset draws the GID
+        Rect clipArea{};
+        float u1 = 0.0f;
+        float v1 = 0.0f;
+        float u2 = 0.0f;
+        float v2 = 0.0f;
+    };
+
+    std::vector<TileRef> m_tileRefs{};  // Indexed by GID
+    bool m_tilesOverlap = false;        // Whether tiles can reach past their own cell
+    double m_maxTileExtent = 0.0;       // Largest side of any tile or map cell
+
+    void _buildTileRefs();
+    [[nodiscard]] std::vector<uint8_t> _writeCompiled(const std::filesystem::path& baseDir) const;
+    void _readCompiled(const uint8_t* data, size_t size, const std::filesystem::path& baseDir);
+
+    friend class TileLayer;
 };
 
 #ifdef KRAKEN_ENABLE_PYTHON
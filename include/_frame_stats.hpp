@@ -0,0 +1,122 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Renderer.hpp"
+
+// Per-frame renderer counters. Without KRAKEN_FRAME_STATS every hook below is an empty inline
+// function, so instrumented draw paths compile to the same code as before.
+namespace kn::renderer::stats
+{
+#ifdef KRAKEN_FRAME_STATS
+inline FrameStats _frame{};
+inline uint64_t _frameTicks = 0;
+inline int _drawDepth = 0;
+inline const SDL_Texture* _lastTexture = nullptr;
+inline bool _hasLastTexture = false;
+
+// Times the outermost draw call on the stack; nested draws are part of their caller
+class TimeScope
+{
+  public:
+    TimeScope()
+    {
+        if (_drawDepth++ == 0)
+            m_start = SDL_GetPerformanceCounter();
+    }
+
+    ~TimeScope()
+    {
+        if (--_drawDepth == 0)
+            _frameTicks += SDL_GetPerformanceCounter() - m_start;
+    }
+
+    TimeScope(const TimeScope&) = delete;
+    TimeScope& operator=(const TimeScope&) = delete;
+
+  private:
+    uint64_t m_start = 0;
+};
+
+// A draw call made by the user, counted once however many draws it makes internally
+class DrawScope
+{
+  public:
+    // m_time has already raised the depth when the body runs, so the outermost draw sees 1
+    DrawScope()
+    {
+        if (_drawDepth == 1)
+            ++_frame.drawCalls;
+    }
+
+    DrawScope(const DrawScope&) = delete;
+    DrawScope& operator=(const DrawScope&) = delete;
+
+  private:
+    TimeScope m_time;
+};
+
+inline void countGeometry(
+    const SDL_Texture* texture, const size_t vertexCount, const size_t indexCount
+)
+{
+    ++_frame.geometryCalls;
+    _frame.vertices += vertexCount;
+    _frame.indices += indexCount;
+
+    if (!_hasLastTexture || texture != _lastTexture)
+        ++_frame.textureSwitches;
+    _lastTexture = texture;
+    _hasLastTexture = true;
+}
+
+// Geometry submitted by another library, such as SDL_ttf, with unknown sizes and texture
+inline void countExternalGeometry()
+{
+    ++_frame.geometryCalls;
+    ++_frame.textureSwitches;
+    _hasLastTexture = false;
+}
+
+inline void countPrimitives(const size_t vertexCount)
+{
+    ++_frame.primitiveCalls;
+    _frame.vertices += vertexCount;
+}
+
+inline void countSprites(const size_t drawn, const size_t culled)
+{
+    _frame.spritesDrawn += drawn;
+    _frame.spritesCulled += culled;
+}
+
+inline void countTargetSwitch()
+{
+    ++_frame.targetSwitches;
+}
+#else
+class TimeScope
+{
+  public:
+    TimeScope() {}
+};
+
+class DrawScope
+{
+  public:
+    DrawScope() {}
+};
+
+inline void countGeometry(const SDL_Texture*, size_t, size_t) {}
+inline void countExternalGeometry() {}
+inline void countPrimitives(size_t) {}
+inline void countSprites(size_t, size_t) {}
+inline void countTargetSwitch() {}
+#endif  // KRAKEN_FRAME_STATS
+
+// Publishes the current counters as the last frame's and starts a new frame
+void _endFrame();
+}  // namespace kn::renderer::stats
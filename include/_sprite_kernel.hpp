@@ -0,0 +1,272 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Vertex generation for large sprite batches. The kernel exists in scalar, SSE4.1 and AVX2 builds,
+// each compiled in its own translation unit with matching instruction set flags, and the widest
+// one the CPU supports is picked at runtime.
+//
+// Helpers in this header are static so every translation unit keeps its own copy. Sharing inline
+// functions between them would let the linker keep an AVX2 encoded body for the scalar path.
+namespace kn::renderer::kernel
+{
+enum class SimdLevel
+{
+    Scalar,
+    SSE41,
+    AVX2,
+};
+
+// Constants shared by every instance in a batch
+struct BatchParams
+{
+    // Camera rotation and zoom, and the screen center. Instance positions arrive already relative
+    // to the camera.
+    float m00 = 1.0f;
+    float m01 = 0.0f;
+    float m10 = 0.0f;
+    float m11 = 1.0f;
+    float tx = 0.0f;
+    float ty = 0.0f;
+    float cameraAngle = 0.0f;
+    float zoom = 1.0f;
+
+    float anchorX = 0.0f;
+    float anchorY = 0.0f;
+    float pivotX = 0.5f;
+    float pivotY = 0.5f;
+
+    float clipX = 0.0f;
+    float clipY = 0.0f;
+    float clipW = 0.0f;
+    float clipH = 0.0f;
+    float invTexW = 1.0f;
+    float invTexH = 1.0f;
+    bool flipH = false;
+    bool flipV = false;
+
+    SDL_FColor color{1.0f, 1.0f, 1.0f, 1.0f};
+    float viewW = 0.0f;
+    float viewH = 0.0f;
+};
+
+// Contiguous float columns for a run of instances. Null columns fall back to their defaults:
+// angle 0, scale 1, scale_y = scale_x and the batch clip area.
+struct InstanceSpan
+{
+    size_t count = 0;
+    const float* x = nullptr;
+    const float* y = nullptr;
+    const float* angle = nullptr;
+    const float* scaleX = nullptr;
+    const float* scaleY = nullptr;
+    const float* clip[4] = {nullptr, nullptr, nullptr, nullptr};
+    const uint8_t* colors = nullptr;
+    int64_t colorStride = 0;
+    int64_t channelStride = 1;
+};
+
+// Writes four vertices per visible instance to out and returns the number of quads written. out
+// must have room for instances.count quads.
+size_t generateQuads(const BatchParams& params, const InstanceSpan& instances, SDL_Vertex* out);
+
+SimdLevel getSimdLevel();
+
+// Overrides the detected level, clamped to what the CPU supports. The benchmark uses it to time
+// each path and the renderer tests to check they agree.
+void setSimdLevel(SimdLevel level);
+
+size_t _generateQuadsScalar(
+    const BatchParams& params, const InstanceSpan& instances, size_t begin, size_t end,
+    SDL_Vertex* out
+);
+size_t _generateQuadsSSE41(
+    const BatchParams& params, const InstanceSpan& instances, size_t begin, size_t end,
+    SDL_Vertex* out
+);
+size_t _generateQuadsAVX2(
+    const BatchParams& params, const InstanceSpan& instances, size_t begin, size_t end,
+    SDL_Vertex* out
+);
+
+// Writes one visible instance given its rotated corners. Returns the next write position, which
+// is unchanged when the per-instance color makes the quad fully transparent.
+static inline SDL_Vertex* _emitQuad(
+    SDL_Vertex* out, const BatchParams& params, const InstanceSpan& instances, const size_t i,
+    const float (&x)[4], const float (&y)[4]
+)
+{
+    SDL_FColor color = params.color;
+    if (instances.colors)
+    {
+        const uint8_t* rgba = instances.colors + static_cast<int64_t>(i) * instances.colorStride;
+        const int64_t step = instances.channelStride;
+        color.r *= static_cast<float>(rgba[0]) * (1.0f / 255.0f);
+        color.g *= static_cast<float>(rgba[step]) * (1.0f / 255.0f);
+        color.b *= static_cast<float>(rgba[step * 2]) * (1.0f / 255.0f);
+        color.a *= static_cast<float>(rgba[step * 3]) * (1.0f / 255.0f);
+        if (color.a == 0.0f)
+            return out;
+    }
+
+    float clipX = params.clipX;
+    float clipY = params.clipY;
+    float clipW = params.clipW;
+    float clipH = params.clipH;
+    if (instances.clip[0])
+    {
+        clipX += instances.clip[0][i];
+        clipY += instances.clip[1][i];
+        clipW = instances.clip[2][i];
+        clipH = instances.clip[3][i];
+    }
+
+    float u1 = clipX * params.invTexW;
+    float v1 = clipY * params.invTexH;
+    float u2 = (clipX + clipW) * params.invTexW;
+    float v2 = (clipY + clipH) * params.invTexH;
+    if (params.flipH)
+    {
+        const float u = u1;
+        u1 = u2;
+        u2 = u;
+    }
+    if (params.flipV)
+    {
+        const float v = v1;
+        v1 = v2;
+        v2 = v;
+    }
+
+    out[0] = {{x[0], y[0]}, color, {u1, v1}};
+    out[1] = {{x[1], y[1]}, color, {u2, v1}};
+    out[2] = {{x[2], y[2]}, color, {u2, v2}};
+    out[3] = {{x[3], y[3]}, color, {u1, v2}};
+    return out + 4;
+}
+
+// Vectorized body shared by the SIMD builds. V wraps one instruction set's float vector and must
+// be declared in an anonymous namespace so each instantiation stays local to its translation unit.
+template <class V>
+static size_t _generateQuadsSimd(
+    const BatchParams& params, const InstanceSpan& instances, const size_t begin,
+    const size_t end, SDL_Vertex* out
+)
+{
+    using F = typename V::Float;
+    constexpr size_t width = V::width;
+
+    SDL_Vertex* const first = out;
+
+    const F m00 = V::set1(params.m00);
+    const F m01 = V::set1(params.m01);
+    const F m10 = V::set1(params.m10);
+    const F m11 = V::set1(params.m11);
+    const F tx = V::set1(params.tx);
+    const F ty = V::set1(params.ty);
+    const F cameraAngle = V::set1(params.cameraAngle);
+    const F anchorX = V::set1(params.anchorX);
+    const F anchorY = V::set1(params.anchorY);
+    const F pivotX = V::set1(params.pivotX);
+    const F pivotY = V::set1(params.pivotY);
+    const F baseClipW = V::set1(params.clipW);
+    const F baseClipH = V::set1(params.clipH);
+    const F zoom = V::set1(params.zoom);
+    const F viewW = V::set1(params.viewW);
+    const F viewH = V::set1(params.viewH);
+    const F zero = V::set1(0.0f);
+    const F one = V::set1(1.0f);
+    const F epsilon = V::set1(1e-8f);
+
+    alignas(32) float xs[4][width];
+    alignas(32) float ys[4][width];
+
+    size_t i = begin;
+    for (; i + width <= end; i += width)
+    {
+        const F worldX = V::load(instances.x + i);
+        const F worldY = V::load(instances.y + i);
+        const F angle =
+            instances.angle ? V::add(V::load(instances.angle + i), cameraAngle) : cameraAngle;
+        const F scaleX = instances.scaleX ? V::load(instances.scaleX + i) : one;
+        const F scaleY = instances.scaleY ? V::load(instances.scaleY + i) : scaleX;
+        const F clipW = instances.clip[2] ? V::load(instances.clip[2] + i) : baseClipW;
+        const F clipH = instances.clip[3] ? V::load(instances.clip[3] + i) : baseClipH;
+
+        const F posX = V::add(V::add(V::mul(m00, worldX), V::mul(m01, worldY)), tx);
+        const F posY = V::add(V::add(V::mul(m10, worldX), V::mul(m11, worldY)), ty);
+
+        const F w = V::mul(V::mul(clipW, scaleX), zoom);
+        const F h = V::mul(V::mul(clipH, scaleY), zoom);
+        const F pivotOffX = V::mul(w, pivotX);
+        const F pivotOffY = V::mul(h, pivotY);
+        const F originX = V::add(V::sub(posX, V::mul(w, anchorX)), pivotOffX);
+        const F originY = V::add(V::sub(posY, V::mul(h, anchorY)), pivotOffY);
+
+        const F left = V::sub(zero, pivotOffX);
+        const F right = V::sub(w, pivotOffX);
+        const F top = V::sub(zero, pivotOffY);
+        const F bottom = V::sub(h, pivotOffY);
+
+        F s, c;
+        V::sincos(angle, s, c);
+
+        const F localX[4] = {left, right, right, left};
+        const F localY[4] = {top, top, bottom, bottom};
+        F cornerX[4], cornerY[4];
+        for (int k = 0; k < 4; ++k)
+        {
+            cornerX[k] = V::add(originX, V::sub(V::mul(localX[k], c), V::mul(localY[k], s)));
+            cornerY[k] = V::add(originY, V::add(V::mul(localX[k], s), V::mul(localY[k], c)));
+        }
+
+        const F minX = V::min(V::min(cornerX[0], cornerX[1]), V::min(cornerX[2], cornerX[3]));
+        const F maxX = V::max(V::max(cornerX[0], cornerX[1]), V::max(cornerX[2], cornerX[3]));
+        const F minY = V::min(V::min(cornerY[0], cornerY[1]), V::min(cornerY[2], cornerY[3]));
+        const F maxY = V::max(V::max(cornerY[0], cornerY[1]), V::max(cornerY[2], cornerY[3]));
+
+        // Same rules as the scalar path: no NaN corner, on screen, non-zero scale and a non-empty
+        // clip area
+        F visible = V::bitAnd(V::cmpGe(maxX, zero), V::cmpLt(minX, viewW));
+        for (int k = 0; k < 4; ++k)
+        {
+            visible = V::bitAnd(visible, V::cmpGe(V::abs(cornerX[k]), zero));
+            visible = V::bitAnd(visible, V::cmpGe(V::abs(cornerY[k]), zero));
+        }
+        visible = V::bitAnd(visible, V::bitAnd(V::cmpGe(maxY, zero), V::cmpLt(minY, viewH)));
+        visible = V::bitAnd(
+            visible, V::bitOr(V::cmpGe(V::abs(scaleX), epsilon), V::cmpGe(V::abs(scaleY), epsilon))
+        );
+        visible = V::bitAnd(visible, V::bitAnd(V::cmpGt(clipW, zero), V::cmpGt(clipH, zero)));
+
+        const int mask = V::movemask(visible);
+        if (mask == 0)
+            continue;
+
+        for (int k = 0; k < 4; ++k)
+        {
+            V::store(xs[k], cornerX[k]);
+            V::store(ys[k], cornerY[k]);
+        }
+
+        for (size_t lane = 0; lane < width; ++lane)
+        {
+            if (!(mask & (1 << lane)))
+                continue;
+
+            const float x[4] = {xs[0][lane], xs[1][lane], xs[2][lane], xs[3][lane]};
+            const float y[4] = {ys[0][lane], ys[1][lane], ys[2][lane], ys[3][lane]};
+            out = _emitQuad(out, params, instances, i + lane, x, y);
+        }
+    }
+
+    if (i < end)
+        out += _generateQuadsScalar(params, instances, i, end, out) * 4;
+
+    return static_cast<size_t>(out - first) / 4;
+}
+}  // namespace kn::renderer::kernel
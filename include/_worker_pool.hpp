@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+// Persistent worker threads for splitting CPU-heavy frame work, such as vertex generation for very
+// large batches. Workers are started on first use and sleep between jobs.
+namespace kn::worker_pool
+{
+// Runs task(0) .. task(taskCount - 1) and returns once all of them have finished. The calling
+// thread takes part, and tasks must not throw. Only meant to be called from the main thread.
+void run(size_t taskCount, const std::function<void(size_t)>& task);
+
+// Total number of threads taking part in run(), including the caller. 0 picks a count from the
+// number of logical cores, and larger counts are clamped to four threads per logical core.
+void setThreadCount(size_t count);
+size_t getThreadCount();
+
+void _quit();
+}  // namespace kn::worker_pool
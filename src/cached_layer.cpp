@@ -0,0 +1,276 @@
+#include "CachedLayer.hpp"
+
+#ifdef KRAKEN_ENABLE_PYTHON
+#include <nanobind/stl/function.h>
+#include <nanobind/stl/shared_ptr.h>
+#endif  // KRAKEN_ENABLE_PYTHON
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Camera.hpp"
+#include "Color.hpp"
+#include "Rect.hpp"
+#include "Renderer.hpp"
+#include "Transform.hpp"
+
+namespace kn::renderer
+{
+static void _checkSize(const Vec2& size)
+{
+    if (!(size.x > 0.0) || !(size.y > 0.0))
+        throw std::invalid_argument("Layer size must be greater than zero");
+}
+
+static void _checkScale(const double scale)
+{
+    if (!(scale > 0.0))
+        throw std::invalid_argument("Layer scale must be greater than zero");
+}
+
+CachedLayer::CachedLayer(
+    const Vec2& size, RecordFunc record, const double scale, const bool worldSpace,
+    const FilterMode filter
+)
+    : m_size(size),
+      m_scale(scale),
+      m_worldSpace(worldSpace),
+      m_filter(filter),
+      m_record(std::move(record))
+{
+    _checkSize(size);
+    _checkScale(scale);
+}
+
+void CachedLayer::invalidate()
+{
+    m_valid = false;
+}
+
+bool CachedLayer::isValid() const
+{
+    return m_valid;
+}
+
+void CachedLayer::setSize(const Vec2& size)
+{
+    _checkSize(size);
+    if (size == m_size)
+        return;
+
+    m_size = size;
+    m_texture = nullptr;
+    m_valid = false;
+}
+
+Vec2 CachedLayer::getSize() const
+{
+    return m_size;
+}
+
+void CachedLayer::setScale(const double scale)
+{
+    _checkScale(scale);
+    if (scale == m_scale)
+        return;
+
+    m_scale = scale;
+    m_texture = nullptr;
+    m_valid = false;
+}
+
+double CachedLayer::getScale() const
+{
+    return m_scale;
+}
+
+void CachedLayer::setWorldSpace(const bool worldSpace)
+{
+    m_worldSpace = worldSpace;
+}
+
+bool CachedLayer::isWorldSpace() const
+{
+    return m_worldSpace;
+}
+
+void CachedLayer::setRecord(RecordFunc record)
+{
+    m_record = std::move(record);
+    m_valid = false;
+}
+
+void CachedLayer::update()
+{
+    if (m_valid)
+        return;
+
+    if (m_recording)
+        throw std::runtime_error("CachedLayer cannot be drawn while it is being recorded");
+
+    _record();
+}
+
+const std::shared_ptr<Texture>& CachedLayer::getTexture()
+{
+    update();
+    return m_texture;
+}
+
+void CachedLayer::draw(const Vec2& pos, const int layer, const double depth)
+{
+    update();
+
+    // The texture holds premultiplied color, so the alpha scales the tint as well
+    const float alpha = m_texture->getAlpha();
+    const Color tint = m_texture->getTint();
+    const auto scaled = [alpha](const uint8_t channel)
+    { return static_cast<uint8_t>(std::lround(channel * alpha)); };
+    const TextureRegion region(
+        m_texture, m_texture->getClipArea(), m_texture->flip,
+        Color{scaled(tint.r), scaled(tint.g), scaled(tint.b), tint.a}, alpha
+    );
+
+    // Drawn at the layer size rather than the texture size, which is rounded up to whole pixels
+    const Vec2 texSize = m_texture->getSize();
+    if (m_worldSpace)
+    {
+        // Pivoting on the anchored corner keeps it in place when the camera rotates
+        const Transform transform{pos, 0.0, Vec2{m_size.x / texSize.x, m_size.y / texSize.y}};
+        renderer::draw(region, transform, Anchor::TOP_LEFT, Anchor::TOP_LEFT, layer, depth);
+    }
+    else
+    {
+        renderer::draw(region, Rect{pos, m_size}, 0.0, Anchor::CENTER, layer, depth);
+    }
+}
+
+void CachedLayer::_record()
+{
+    if (!m_texture)
+    {
+        const auto width = static_cast<int>(std::ceil(m_size.x * m_scale));
+        const auto height = static_cast<int>(std::ceil(m_size.y * m_scale));
+        m_texture = std::make_shared<Texture>(std::max(width, 1), std::max(height, 1), m_filter);
+
+        // Blending onto a cleared target leaves premultiplied color behind
+        if (!SDL_SetTextureBlendMode(m_texture->getSDL(), SDL_BLENDMODE_BLEND_PREMULTIPLIED))
+            throw std::runtime_error(
+                "Failed to set layer blend mode: " + std::string(SDL_GetError())
+            );
+    }
+
+    // Maps layer coordinates onto the texture, so (0, 0) lands on the top left pixel
+    Camera recorder;
+    recorder.transform.pos = m_texture->getSize() / (2.0 * m_scale);
+    recorder.setZoom(m_scale);
+
+    // The previous target keeps its own viewport, so split-screen layouts survive the switch
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(_get());
+    Camera* previousCamera = Camera::active;
+
+    _setTargetSDL(m_texture->getSDL());
+    m_recording = true;
+    try
+    {
+        clear({0, 0, 0, 0});
+        recorder.set();
+        if (m_record)
+            m_record();
+    }
+    catch (...)
+    {
+        m_recording = false;
+        Camera::active = previousCamera;
+        _setTargetSDL(previousTarget);
+        throw;
+    }
+
+    m_recording = false;
+    Camera::active = previousCamera;
+    _setTargetSDL(previousTarget);
+    m_valid = true;
+}
+
+#ifdef KRAKEN_ENABLE_PYTHON
+void _bindCachedLayer(nb::module_& subRenderer)
+{
+    using namespace nb::literals;
+
+    nb::class_<CachedLayer>(subRenderer, "CachedLayer", R"doc(
+A render-to-texture cache for content that rarely changes.
+
+The record callback draws the layer's content into its own texture. Drawing the layer reuses that
+texture as a single quad until invalidate() is called or the size or scale changes.
+
+Content is recorded in layer coordinates, from (0, 0) to the layer size. Screen-space layers are
+drawn in render target pixels, while world-space layers are moved, rotated and zoomed by the
+active camera like a sprite.
+    )doc")
+        .def(
+            nb::init<const Vec2&, CachedLayer::RecordFunc, double, bool, FilterMode>(), "size"_a,
+            "record"_a, "scale"_a = 1.0, "world_space"_a = false,
+            "filter"_a = FilterMode::Default, R"doc(
+Create a cached layer. Nothing is recorded until it is first drawn.
+
+Args:
+    size (Vec2): Size of the layer in pixels, or world units for world-space layers.
+    record (Callable[[], None]): Draws the layer's content in layer coordinates.
+    scale (float, optional): Texture pixels per layer unit. Defaults to 1.0.
+    world_space (bool, optional): Whether the active camera applies when drawing the layer.
+        Defaults to False.
+    filter (FilterMode, optional): Filtering used when the layer is drawn scaled.
+        Defaults to FilterMode.DEFAULT.
+
+Raises:
+    ValueError: If the size or scale is not positive.
+            )doc"
+        )
+        .def("invalidate", &CachedLayer::invalidate, R"doc(
+Mark the content as stale, so it is recorded again on the next draw.
+        )doc")
+        .def("update", &CachedLayer::update, R"doc(
+Record the content now if the layer is invalid, instead of during the next draw.
+
+Recording switches the render target, which flushes queued draws. Updating layers before drawing
+the rest of the frame keeps sorted draws in one queue.
+        )doc")
+        .def(
+            "draw", &CachedLayer::draw, "pos"_a = Vec2{}, "layer"_a = 0, "depth"_a = 0.0,
+            R"doc(
+Draw the layer, recording its content first if it is invalid.
+
+Args:
+    pos (Vec2, optional): Top left corner, in screen pixels or world units for world-space layers.
+        Defaults to (0, 0).
+    layer (int, optional): Sort layer when sorting is enabled. Defaults to 0.
+    depth (float, optional): Sort depth when sorting is enabled. Defaults to 0.0.
+            )doc"
+        )
+        .def("set_record", &CachedLayer::setRecord, "record"_a, R"doc(
+Replace the record callback and invalidate the layer.
+
+Args:
+    record (Callable[[], None]): Draws the layer's content in layer coordinates.
+        )doc")
+        .def_prop_ro("valid", &CachedLayer::isValid, R"doc(
+Whether the cached texture holds up-to-date content.
+        )doc")
+        .def_prop_rw("size", &CachedLayer::getSize, &CachedLayer::setSize, R"doc(
+The size of the layer. Changing it invalidates the layer.
+        )doc")
+        .def_prop_rw("scale", &CachedLayer::getScale, &CachedLayer::setScale, R"doc(
+Texture pixels per layer unit. Changing it invalidates the layer.
+        )doc")
+        .def_prop_rw(
+            "world_space", &CachedLayer::isWorldSpace, &CachedLayer::setWorldSpace, R"doc(
+Whether the active camera applies when drawing the layer.
+            )doc"
+        )
+        .def_prop_ro("texture", &CachedLayer::getTexture, R"doc(
+The cached texture, recorded first if the layer is invalid.
+        )doc");
+}
+#endif  // KRAKEN_ENABLE_PYTHON
+}  // namespace kn::renderer
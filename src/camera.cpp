@@ -1,5 +1,8 @@
 #include "Camera.hpp"
 
+#include <cmath>
+#include <stdexcept>
+
 #include "Math.hpp"
 #include "Renderer.hpp"
 
@@ -20,7 +23,9 @@ void Camera::moveWorld(const Vec2& worldDelta)
 
 void Camera::moveScreen(const Vec2& screenDelta)
 {
-    transform.pos += screenDelta.rotated(-transform.angle);
+    // Same mapping as screenToWorld without the center offset, so dragged content follows the
+    // cursor at any zoom
+    transform.pos += (screenDelta / m_zoom).rotated(-transform.angle);
 }
 
 void Camera::rotate(const double delta)
@@ -28,12 +33,26 @@ void Camera::rotate(const double delta)
     transform.angle += delta;
 }
 
+void Camera::setZoom(const double zoom)
+{
+    if (!(zoom > 0.0))
+        throw std::invalid_argument("Camera zoom must be greater than zero");
+
+    m_zoom = zoom;
+}
+
+double Camera::getZoom() const
+{
+    return m_zoom;
+}
+
 Vec2 Camera::worldToScreen(const Vec2& worldPos) const
 {
     const Vec2 center = renderer::getCurrentResolution() * 0.5;
     Vec2 screenPos = worldPos - transform.pos;
     if (transform.angle != 0.0)
         screenPos.rotate(transform.angle);
+    screenPos *= m_zoom;
     screenPos += center;
 
     return screenPos;
@@ -42,7 +61,7 @@ Vec2 Camera::worldToScreen(const Vec2& worldPos) const
 Vec2 Camera::screenToWorld(const Vec2& screenPos) const
 {
     const Vec2 center = renderer::getCurrentResolution() * 0.5;
-    Vec2 worldPos = screenPos - center;
+    Vec2 worldPos = (screenPos - center) / m_zoom;
     if (transform.angle != 0.0)
         worldPos.rotate(-transform.angle);
     worldPos += transform.pos;
@@ -63,20 +82,86 @@ void Camera::unset()
 
 namespace camera
 {
-Vec2 worldToScreen(const Vec2& worldPos)
+static View _view;
+static const Camera* _viewCamera = nullptr;
+static bool _viewValid = false;
+
+Vec2 View::worldToScreen(const Vec2& worldPos) const
 {
-    if (Camera::active)
-        return Camera::active->worldToScreen(worldPos);
+    if (!active)
+        return worldPos;
 
-    return worldPos;
+    const double x = worldPos.x - pos.x;
+    const double y = worldPos.y - pos.y;
+    return {(x * cos - y * sin) * zoom + center.x, (x * sin + y * cos) * zoom + center.y};
 }
 
-Vec2 screenToWorld(const Vec2& screenPos)
+Vec2 View::screenToWorld(const Vec2& screenPos) const
 {
-    if (Camera::active)
-        return Camera::active->screenToWorld(screenPos);
+    if (!active)
+        return screenPos;
 
-    return screenPos;
+    const double x = (screenPos.x - center.x) / zoom;
+    const double y = (screenPos.y - center.y) / zoom;
+    return {x * cos + y * sin + pos.x, -x * sin + y * cos + pos.y};
+}
+
+Rect View::getWorldBounds() const
+{
+    if (!active)
+        return {0.0, 0.0, resolution};
+
+    const double halfW = (std::abs(center.x * cos) + std::abs(center.y * sin)) / zoom;
+    const double halfH = (std::abs(center.x * sin) + std::abs(center.y * cos)) / zoom;
+    return {pos.x - halfW, pos.y - halfH, halfW * 2.0, halfH * 2.0};
+}
+
+const View& getView()
+{
+    // Cameras are mutated freely through their public transform, so the snapshot is checked
+    // against the live values. That costs a few comparisons instead of sin/cos per point.
+    const Camera* camera = Camera::active;
+    const Vec2 resolution = renderer::getCurrentResolution();
+    if (_viewValid && camera == _viewCamera && resolution.x == _view.resolution.x &&
+        resolution.y == _view.resolution.y)
+    {
+        if (!camera)
+            return _view;
+
+        const Transform& transform = camera->transform;
+        if (transform.pos.x == _view.pos.x && transform.pos.y == _view.pos.y &&
+            transform.angle == _view.angle && camera->getZoom() == _view.zoom)
+        {
+            return _view;
+        }
+    }
+
+    _view = {};
+    _view.resolution = resolution;
+    if (camera)
+    {
+        _view.active = true;
+        _view.pos = camera->transform.pos;
+        _view.angle = camera->transform.angle;
+        _view.zoom = camera->getZoom();
+        _view.cos = std::cos(_view.angle);
+        _view.sin = std::sin(_view.angle);
+        _view.center = resolution * 0.5;
+    }
+
+    _viewCamera = camera;
+    _viewValid = true;
+    return _view;
+}
+
+Vec2 worldToScreen(const Vec2& worldPos)
+{
+    return getView().worldToScreen(worldPos);
+}
+
+Vec2 screenToWorld(const Vec2& screenPos)
+{
+    return getView().screenToWorld(screenPos);
 }
 
 Vec2 getActivePos()
@@ -95,6 +180,14 @@ double getActiveAngle()
     return 0.0;
 }
 
+double getActiveZoom()
+{
+    if (Camera::active)
+        return Camera::active->getZoom();
+
+    return 1.0;
+}
+
 Camera* _getActiveCamera()
 {
     return Camera::active;
@@ -123,6 +216,14 @@ Returns:
     float: The angle of the active camera in radians.
     )doc");
 
+    subCamera.def("get_active_zoom", &camera::getActiveZoom, R"doc(
+Get the zoom of the currently active camera.
+If no camera is active, returns 1.
+
+Returns:
+    float: The zoom of the active camera.
+    )doc");
+
     subCamera.def("world_to_screen", &camera::worldToScreen, "world_pos"_a, R"doc(
 Convert a world position to a screen position using the active camera.
 
@@ -157,7 +258,17 @@ Args:
 
         .def_rw("transform", &Camera::transform, R"doc(
 The camera transform. `transform.pos` is the world point at the center of the view.
-`transform.angle` rotates the rendered view in radians. `transform.scale` is reserved for future zoom support.
+`transform.angle` rotates the rendered view in radians. `transform.scale` is unused, see `zoom`.
+        )doc")
+
+        .def_prop_rw("zoom", &Camera::getZoom, &Camera::setZoom, R"doc(
+Uniform scale from world units to screen pixels. Values above 1 zoom in. Defaults to 1.
+
+Sprites, shapes and tile maps are scaled around the center of the view. Text keeps its size and
+line thickness stays in pixels.
+
+Raises:
+    ValueError: If set to zero or a negative value.
         )doc")
 
         .def("move_world", &Camera::moveWorld, "delta"_a, R"doc(
@@ -169,6 +280,9 @@ Args:
         .def("move_screen", &Camera::moveScreen, "delta"_a, R"doc(
 Move the camera by a delta in screen/camera space.
 
+The delta is scaled by the inverse zoom and rotated by the camera angle, so moving by a mouse
+delta pans the view by exactly that many pixels.
+
 Args:
     delta (Vec2): Screen-space movement delta.
     )doc")
@@ -233,16 +233,17 @@ bool contains(const Circle& circle, const Line& line)
 
 bool overlap(const Polygon& polygon, const Vec2& point)
 {
-    if (polygon.points.size() < 3)
+    const std::vector<Vec2>& points = polygon.getPoints();
+    if (points.size() < 3)
         return false;
 
     bool inside = false;
-    size_t count = polygon.points.size();
+    size_t count = points.size();
 
     for (size_t i = 0, j = count - 1; i < count; j = i++)
     {
-        const Vec2& vi = polygon.points[i];
-        const Vec2& vj = polygon.points[j];
+        const Vec2& vi = points[i];
+        const Vec2& vj = points[j];
 
         bool condition = ((vi.y > point.y) != (vj.y > point.y)) &&
                          (point.x < (vj.x - vi.x) * (point.y - vi.y) / (vj.y - vi.y) + vi.x);
@@ -260,10 +261,10 @@ bool overlap(const Vec2& point, const Polygon& polygon)
 
 bool overlap(const Polygon& polygon, const Rect& rect)
 {
-    if (polygon.points.empty())
+    if (polygon.getPoints().empty())
         return false;
 
-    for (const auto& point : polygon.points)
+    for (const auto& point : polygon.getPoints())
     {
         if (overlap(rect, point))
             return true;
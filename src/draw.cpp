@@ -8,7 +8,9 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <sstream>
+#include <string>
 
 #include "Camera.hpp"
 #include "Capsule.hpp"
@@ -18,7 +20,7 @@
 #include "Rect.hpp"
 #include "Renderer.hpp"
 #include "Texture.hpp"
-#include "mapbox/earcut.hpp"
+#include "_frame_stats.hpp"
 
 #ifndef M_PI
 #define M_PI 3.1415926535897932384626433832795
@@ -33,6 +35,41 @@ void _thickLine(const Line& line, const Color& color, double thickness);
 
 namespace
 {
+bool batchingEnabled = true;
+
+// Scratch geometry reused by the shape builders, as renderShape copies what it is given
+std::vector<SDL_Vertex> shapeVertices;
+std::vector<int> shapeIndices;
+
+// Camera-space copy of raw geometry positions
+std::vector<float> screenPositions;
+
+// Untextured triangles are queued with the shapes drawn around them, unless batching is disabled
+void renderShape(
+    const SDL_Vertex* vertices, const size_t vertexCount, const int* indices,
+    const size_t indexCount, const char* what
+)
+{
+    if (vertexCount == 0)
+        return;
+
+    if (batchingEnabled)
+    {
+        renderer::_queueShape(vertices, vertexCount, indices, indexCount);
+        return;
+    }
+
+    renderer::_flush();
+    renderer::stats::countGeometry(nullptr, vertexCount, indexCount);
+    if (!SDL_RenderGeometry(
+            rend, nullptr, vertices, static_cast<int>(vertexCount), indices,
+            static_cast<int>(indexCount)
+        ))
+    {
+        throw std::runtime_error("Failed to render " + std::string(what) + ": " + SDL_GetError());
+    }
+}
+
 bool isScreenAabbVisible(
     const double minX, const double minY, const double maxX, const double maxY,
     const Vec2& renderSize
@@ -71,26 +108,366 @@ std::vector<Vec2> toScreenPoints(const std::vector<Vec2>& worldPoints)
     return screenPoints;
 }
 
+// Curves are split finely enough that no segment strays further than this from the true curve, in
+// screen pixels, when the segment count is left to the draw call
+constexpr double CURVE_TOLERANCE = 0.25;
+constexpr int MIN_CURVE_SEGMENTS = 8;
+constexpr int MAX_CURVE_SEGMENTS = 512;
+
+// Segments in a full turn at a screen radius, or the caller's count when it gives one. Automatic
+// counts are multiples of 4, so half and quarter turns start and end on table entries.
+int curveSegments(const double radius, const int numSegments)
+{
+    if (numSegments > 0)
+        return std::min(std::max(3, numSegments), MAX_CURVE_SEGMENTS);
+
+    if (!(radius > CURVE_TOLERANCE))
+        return MIN_CURVE_SEGMENTS;
+
+    // A chord spanning 2pi / n strays r * (1 - cos(pi / n)) from the arc
+    const double segments = M_PI / std::acos(1.0 - CURVE_TOLERANCE / radius);
+    if (!(segments < MAX_CURVE_SEGMENTS))
+        return MAX_CURVE_SEGMENTS;
+
+    return std::max(MIN_CURVE_SEGMENTS, static_cast<int>(std::ceil(segments / 4.0)) * 4);
+}
+
+// Points around the unit circle for a segment count, starting at angle 0 and repeating the first
+// point at the end so rings close without wrapping. Built once per count and reused.
+const std::vector<Vec2>& unitCircle(const int segments)
+{
+    static std::vector<std::vector<Vec2>> tables(MAX_CURVE_SEGMENTS + 1);
+
+    std::vector<Vec2>& table = tables[segments];
+    if (table.empty())
+    {
+        table.reserve(static_cast<size_t>(segments) + 1);
+        for (int i = 0; i < segments; ++i)
+        {
+            const double theta =
+                2.0 * M_PI * static_cast<double>(i) / static_cast<double>(segments);
+            table.emplace_back(std::cos(theta), std::sin(theta));
+        }
+        table.push_back(table.front());
+    }
+
+    return table;
+}
+
+// Rotates a unit circle entry by an angle given as its cosine and sine
+Vec2 rotated(const Vec2& point, const Vec2& rotation)
+{
+    return {
+        point.x * rotation.x - point.y * rotation.y,
+        point.x * rotation.y + point.y * rotation.x,
+    };
+}
+
 std::vector<Vec2> getEllipsePoints(
-    const Vec2& center, const double radiusX, const double radiusY, const int numSegments
+    const Vec2& center, const double radiusX, const double radiusY, const int segments
 )
 {
-    const int segments = std::max(8, numSegments);
+    const std::vector<Vec2>& unit = unitCircle(segments);
 
     std::vector<Vec2> points;
     points.reserve(static_cast<size_t>(segments));
 
     for (int i = 0; i < segments; ++i)
+        points.push_back(center + Vec2(unit[i].x * radiusX, unit[i].y * radiusY));
+
+    return points;
+}
+
+// Appends a filled ellipse to the scratch geometry, fanned from its center over the closed ring
+void appendEllipseFill(
+    const Vec2& center, const Vec2& radii, const int segments, const SDL_FColor& color
+)
+{
+    const auto base = static_cast<int>(shapeVertices.size());
+
+    shapeVertices.push_back({static_cast<SDL_FPoint>(center), color, {}});
+    for (const Vec2& dir : unitCircle(segments))
+        shapeVertices.push_back({static_cast<SDL_FPoint>(center + dir * radii), color, {}});
+
+    for (int i = 1; i <= segments; ++i)
+        shapeIndices.insert(shapeIndices.end(), {base, base + i, base + i + 1});
+}
+
+// Appends an ellipse outline to the scratch geometry, a strip between two rings sharing directions
+void appendEllipseRing(
+    const Vec2& center, const Vec2& outerRadii, const Vec2& innerRadii, const int segments,
+    const SDL_FColor& color
+)
+{
+    const auto base = static_cast<int>(shapeVertices.size());
+
+    // Outer and inner vertex for each point of the ring
+    for (const Vec2& dir : unitCircle(segments))
     {
-        const double theta = (2.0 * M_PI * static_cast<double>(i)) / static_cast<double>(segments);
-        points.push_back(center + Vec2(cos(theta) * radiusX, sin(theta) * radiusY));
+        shapeVertices.push_back({static_cast<SDL_FPoint>(center + dir * outerRadii), color, {}});
+        shapeVertices.push_back({static_cast<SDL_FPoint>(center + dir * innerRadii), color, {}});
     }
 
-    return points;
+    // Two triangles between each pair of ring points
+    for (int i = 0; i < segments; ++i)
+    {
+        const int topL = base + i * 2;
+        const int botL = topL + 1;
+        const int topR = topL + 2;
+        const int botR = topL + 3;
+
+        shapeIndices.insert(shapeIndices.end(), {topL, topR, botL, topR, botR, botL});
+    }
+}
+
+// Appends a quad of the given screen width along a segment
+void appendThickLine(const Vec2& a, const Vec2& b, const double thickness, const SDL_FColor& color)
+{
+    Vec2 dir = b - a;
+    const double len = dir.getLength();
+    if (len < 0.0001)
+        return;
+
+    dir /= len;
+    const Vec2 offset = Vec2{-dir.y, dir.x} * (thickness * 0.5);
+    const auto base = static_cast<int>(shapeVertices.size());
+
+    shapeVertices.push_back({static_cast<SDL_FPoint>(a + offset), color, {}});
+    shapeVertices.push_back({static_cast<SDL_FPoint>(a - offset), color, {}});
+    shapeVertices.push_back({static_cast<SDL_FPoint>(b + offset), color, {}});
+    shapeVertices.push_back({static_cast<SDL_FPoint>(b - offset), color, {}});
+
+    shapeIndices.insert(
+        shapeIndices.end(), {base, base + 1, base + 2, base + 2, base + 1, base + 3}
+    );
+}
+
+// Appends a stroke of the given screen width along connected points. Segments share their edge
+// vertices at each join, so translucent strokes have no gaps or doubled coverage at the corners.
+void appendStroke(
+    const std::vector<Vec2>& points, const double thickness, const SDL_FColor& color,
+    const bool closed, const LineJoin join, const LineCap cap, const double miterLimit
+)
+{
+    // Repeated points have no direction to offset along
+    static std::vector<Vec2> path;
+    path.clear();
+    for (const Vec2& point : points)
+    {
+        if (path.empty() || (point - path.back()).getLength() >= 0.0001)
+            path.push_back(point);
+    }
+    if (path.size() > 2 && (path.back() - path.front()).getLength() < 0.0001)
+        path.pop_back();
+
+    const size_t count = path.size();
+    if (count < 2)
+        return;
+
+    const bool loop = closed && count > 2;
+    const size_t segmentCount = loop ? count : count - 1;
+    const double halfWidth = thickness * 0.5;
+
+    static std::vector<Vec2> directions;
+    static std::vector<double> lengths;
+    directions.clear();
+    lengths.clear();
+    for (size_t i = 0; i < segmentCount; ++i)
+    {
+        const Vec2 delta = path[(i + 1) % count] - path[i];
+        const double length = delta.getLength();
+        directions.push_back(delta / length);
+        lengths.push_back(length);
+    }
+
+    const auto vertex = [&color](const Vec2& point) -> int
+    {
+        shapeVertices.push_back({static_cast<SDL_FPoint>(point), color, {}});
+        return static_cast<int>(shapeVertices.size()) - 1;
+    };
+
+    // Fans an arc of the stroke's radius around center, from one existing vertex to another
+    const int arcSegments = curveSegments(halfWidth, 0);
+    const auto arc = [&](const int pivot, const Vec2& center, const int from, const int to,
+                         const Vec2& offset, const double angle) -> void
+    {
+        const int steps = std::max(
+            1, static_cast<int>(std::ceil(std::abs(angle) * arcSegments / (2.0 * M_PI)))
+        );
+        const Vec2 step{std::cos(angle / steps), std::sin(angle / steps)};
+
+        Vec2 current = offset;
+        int previous = from;
+        for (int i = 1; i < steps; ++i)
+        {
+            current = rotated(current, step);
+            const int next = vertex(center + current);
+            shapeIndices.insert(shapeIndices.end(), {pivot, previous, next});
+            previous = next;
+        }
+        shapeIndices.insert(shapeIndices.end(), {pivot, previous, to});
+    };
+
+    // Left and right vertices where each segment starts and ends, left being along +normal
+    struct Edge
+    {
+        int left;
+        int right;
+    };
+    static std::vector<Edge> starts;
+    static std::vector<Edge> ends;
+    starts.resize(segmentCount);
+    ends.resize(segmentCount);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Vec2& point = path[i];
+
+        if (!loop && (i == 0 || i == count - 1))
+        {
+            const bool first = i == 0;
+            const Vec2& dir = directions[first ? 0 : segmentCount - 1];
+            const Vec2 normal = Vec2{-dir.y, dir.x} * halfWidth;
+            const Vec2 end =
+                cap == LineCap::Square ? point + dir * (first ? -halfWidth : halfWidth) : point;
+
+            const Edge edge{vertex(end + normal), vertex(end - normal)};
+            if (first)
+                starts[0] = edge;
+            else
+                ends[segmentCount - 1] = edge;
+
+            // Half a turn around the end, away from the segment
+            if (cap == LineCap::Round)
+            {
+                if (first)
+                    arc(vertex(point), point, edge.left, edge.right, normal, M_PI);
+                else
+                    arc(vertex(point), point, edge.right, edge.left, -normal, M_PI);
+            }
+            continue;
+        }
+
+        const size_t in = (i + segmentCount - 1) % segmentCount;
+        const size_t out = i;
+        const Vec2& dirIn = directions[in];
+        const Vec2& dirOut = directions[out];
+        const Vec2 normalIn{-dirIn.y, dirIn.x};
+        const Vec2 normalOut{-dirOut.y, dirOut.x};
+
+        // The miter runs along the bisector of the normals, lengthening as the turn sharpens
+        Vec2 miter = normalIn + normalOut;
+        const double miterLength = miter.getLength();
+        const double turn = math::cross(dirIn, dirOut);
+        if (miterLength > 0.0001)
+            miter /= miterLength;
+        const double scale = miterLength > 0.0001 ? 1.0 / math::dot(miter, normalIn) : 0.0;
+
+        if (miterLength > 0.0001 &&
+            (std::abs(turn) < 0.0001 || (join == LineJoin::Miter && scale <= miterLimit)))
+        {
+            const Vec2 offset = miter * (halfWidth * scale);
+            ends[in] = starts[out] = {vertex(point + offset), vertex(point - offset)};
+            continue;
+        }
+
+        // The inner side is the one the path turns towards, and the outer side gets the join
+        const double side = turn >= 0.0 ? 1.0 : -1.0;
+        const double reach = halfWidth * std::sqrt(std::max(scale * scale - 1.0, 0.0));
+
+        int innerIn;
+        int innerOut;
+        int pivot;
+        if (miterLength > 0.0001 && reach <= std::min(lengths[in], lengths[out]))
+        {
+            innerIn = innerOut = pivot = vertex(point + miter * (side * halfWidth * scale));
+        }
+        else
+        {
+            // The inner corner would pass the end of a segment, so the segments overlap there
+            innerIn = vertex(point + normalIn * (side * halfWidth));
+            innerOut = vertex(point + normalOut * (side * halfWidth));
+            pivot = vertex(point);
+        }
+
+        const Vec2 outerOffsetIn = normalIn * (-side * halfWidth);
+        const int outerIn = vertex(point + outerOffsetIn);
+        const int outerOut = vertex(point + normalOut * (-side * halfWidth));
+
+        ends[in] = side > 0.0 ? Edge{innerIn, outerIn} : Edge{outerIn, innerIn};
+        starts[out] = side > 0.0 ? Edge{innerOut, outerOut} : Edge{outerOut, innerOut};
+
+        if (join == LineJoin::Round)
+        {
+            const double angle = std::atan2(turn, math::dot(dirIn, dirOut));
+            arc(pivot, point, outerIn, outerOut, outerOffsetIn, angle);
+        }
+        else
+        {
+            shapeIndices.insert(shapeIndices.end(), {pivot, outerIn, outerOut});
+        }
+    }
+
+    for (size_t i = 0; i < segmentCount; ++i)
+    {
+        const Edge& a = starts[i];
+        const Edge& b = ends[i];
+        shapeIndices.insert(
+            shapeIndices.end(), {a.left, a.right, b.left, b.left, a.right, b.right}
+        );
+    }
+}
+
+// Fans a convex outline from its first point, skipping the triangulation a general polygon needs
+void fillConvex(const std::vector<Vec2>& points, const Color& color)
+{
+    if (points.size() < 3)
+        return;
+
+    shapeVertices.clear();
+    shapeIndices.clear();
+
+    const auto fColor = static_cast<SDL_FColor>(color);
+    for (const Vec2& point : points)
+        shapeVertices.push_back({static_cast<SDL_FPoint>(point), fColor, {}});
+
+    for (int i = 1; i + 1 < static_cast<int>(points.size()); ++i)
+        shapeIndices.insert(shapeIndices.end(), {0, i, i + 1});
+
+    renderShape(
+        shapeVertices.data(), shapeVertices.size(), shapeIndices.data(), shapeIndices.size(),
+        "polygon geometry"
+    );
+}
+
+// Outward directions around a capsule, half a turn around p1 followed by half a turn around p2.
+// Fills and outlines build their rings from the same directions.
+const std::vector<Vec2>& capsuleDirections(const Vec2& p1, const Vec2& p2, const int halfSegments)
+{
+    static std::vector<Vec2> directions;
+    directions.clear();
+
+    Vec2 axis = p2 - p1;
+    const double length = axis.getLength();
+    axis = length > 0.0 ? axis / length : Vec2(1.0, 0.0);
+
+    // A quarter turn from the axis, where the end around p1 starts
+    const Vec2 normal{-axis.y, axis.x};
+    const std::vector<Vec2>& unit = unitCircle(halfSegments * 2);
+
+    for (int i = 0; i <= halfSegments; ++i)
+        directions.push_back(rotated(unit[i], normal));
+
+    for (int i = 0; i <= halfSegments; ++i)
+        directions.push_back(rotated(unit[i], -normal));
+
+    return directions;
 }
 
 void drawPolylineScreen(
-    const std::vector<Vec2>& points, const Color& color, const double thickness, const bool closed
+    const std::vector<Vec2>& points, const Color& color, const double thickness, const bool closed,
+    const LineJoin join = LineJoin::Miter, const LineCap cap = LineCap::Butt,
+    const double miterLimit = 4.0
 )
 {
     if (points.size() < 2)
@@ -98,8 +475,8 @@ void drawPolylineScreen(
 
     if (thickness <= 1.0)
     {
-        if (!SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a))
-            throw std::runtime_error("Failed to set draw color: " + std::string(SDL_GetError()));
+        renderer::_flush();
+        renderer::_setDrawColor(color);
 
         std::vector<SDL_FPoint> sdlPoints;
         sdlPoints.reserve(points.size() + (closed ? 1 : 0));
@@ -109,17 +486,23 @@ void drawPolylineScreen(
         if (closed)
             sdlPoints.push_back(sdlPoints.front());
 
+        renderer::stats::countPrimitives(sdlPoints.size());
         if (!SDL_RenderLines(rend, sdlPoints.data(), static_cast<int>(sdlPoints.size())))
             throw std::runtime_error("Failed to render polyline: " + std::string(SDL_GetError()));
 
         return;
     }
 
-    for (size_t i = 0; i < points.size() - 1; ++i)
-        _thickLine(Line(points[i], points[i + 1]), color, thickness);
+    shapeVertices.clear();
+    shapeIndices.clear();
+    appendStroke(
+        points, thickness, static_cast<SDL_FColor>(color), closed, join, cap, miterLimit
+    );
 
-    if (closed)
-        _thickLine(Line(points.back(), points.front()), color, thickness);
+    renderShape(
+        shapeVertices.data(), shapeVertices.size(), shapeIndices.data(), shapeIndices.size(),
+        "polyline geometry"
+    );
 }
 }  // namespace
 
@@ -139,45 +522,52 @@ void _capsuleOutline(const Capsule& capsule, const Color& color, double thicknes
 // Line helper for thick lines
 void _thickLine(const Line& line, const Color& color, double thickness);
 
-// Polygon helper for filled polygons
+// Polygon helper for filled polygons, taking world space points
 void _polygonFilled(const Polygon& polygon, const Color& color);
 
 // Helpers for rounded rectangles
 Polygon _roundedRectPolygon(const Rect& rect, const std::array<double, 4>& radii);
 void _roundedRectOutline(const Rect& rect, const Color& color, const std::array<double, 4>& radii);
 
-std::vector<SDL_FPoint> _ellipsePolyline(
-    const Vec2& center, const double radiusX, const double radiusY, const int numSegments
-);
+void setBatchingEnabled(const bool enabled)
+{
+    if (enabled == batchingEnabled)
+        return;
 
-std::vector<SDL_FPoint> _capsulePolyline(
-    const Vec2& p1, const Vec2& p2, const double radius, const int numSegments
-);
+    renderer::_flush();
+    batchingEnabled = enabled;
+}
+
+bool isBatchingEnabled()
+{
+    return batchingEnabled;
+}
 
 void circle(const Circle& circle, const Color& color, const double thickness, const int numSegments)
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
-    if (circle.radius < 1.0 || color.a == 0)
+    const camera::View& view = camera::getView();
+    const double radius = circle.radius * view.zoom;
+    if (radius < 1.0 || color.a == 0)
         return;
 
-    const Vec2 rendRes = renderer::getCurrentResolution();
-
-    const Vec2 center = camera::worldToScreen(circle.pos);
+    const Vec2 center = view.worldToScreen(circle.pos);
     if (!isScreenAabbVisible(
-            center.x - circle.radius, center.y - circle.radius, center.x + circle.radius,
-            center.y + circle.radius, rendRes
+            center.x - radius, center.y - radius, center.x + radius, center.y + radius,
+            view.resolution
         ))
     {
         return;
     }
 
-    const bool filled = (thickness <= 0.0 || thickness >= circle.radius);
+    const bool filled = (thickness <= 0.0 || thickness >= radius);
     if (filled)
-        _ellipseFilled(center, circle.radius, circle.radius, color, numSegments);
+        _ellipseFilled(center, radius, radius, color, numSegments);
     else
-        _ellipseOutline(center, circle.radius, circle.radius, color, thickness, numSegments);
+        _ellipseOutline(center, radius, radius, color, thickness, numSegments);
 }
 
 void circles(
@@ -185,35 +575,37 @@ void circles(
     const int numSegments
 )
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
     if (circles.empty() || color.a == 0)
         return;
 
-    const Vec2 rendRes = renderer::getCurrentResolution();
+    const camera::View& view = camera::getView();
 
     for (const Circle& circle : circles)
     {
-        if (circle.radius < 1.0)
+        const double radius = circle.radius * view.zoom;
+        if (radius < 1.0)
             continue;
 
-        const Vec2 center = camera::worldToScreen(circle.pos);
+        const Vec2 center = view.worldToScreen(circle.pos);
         if (!isScreenAabbVisible(
-                center.x - circle.radius, center.y - circle.radius, center.x + circle.radius,
-                center.y + circle.radius, rendRes
+                center.x - radius, center.y - radius, center.x + radius, center.y + radius,
+                view.resolution
             ))
         {
             continue;
         }
 
-        if (thickness <= 0.0 || thickness >= circle.radius)
+        if (thickness <= 0.0 || thickness >= radius)
         {
-            _ellipseFilled(center, circle.radius, circle.radius, color, numSegments);
+            _ellipseFilled(center, radius, radius, color, numSegments);
         }
         else
         {
-            _ellipseOutline(center, circle.radius, circle.radius, color, thickness, numSegments);
+            _ellipseOutline(center, radius, radius, color, thickness, numSegments);
         }
     }
 }
@@ -222,17 +614,18 @@ void capsule(
     const Capsule& capsule, const Color& color, const double thickness, const int numSegments
 )
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
-    if (capsule.radius < 1.0 || color.a == 0)
+    const camera::View& view = camera::getView();
+    const double r = capsule.radius * view.zoom;
+    if (r < 1.0 || color.a == 0)
         return;
 
-    const Vec2 rendRes = renderer::getCurrentResolution();
-
-    const double r = capsule.radius;
-    const Vec2 p1 = camera::worldToScreen(capsule.p1);
-    const Vec2 p2 = camera::worldToScreen(capsule.p2);
+    const Vec2& rendRes = view.resolution;
+    const Vec2 p1 = view.worldToScreen(capsule.p1);
+    const Vec2 p2 = view.worldToScreen(capsule.p2);
 
     const double minX = std::min(p1.x, p2.x) - r;
     const double minY = std::min(p1.y, p2.y) - r;
@@ -253,19 +646,21 @@ void capsules(
     const int numSegments
 )
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
-    const Vec2 rendRes = renderer::getCurrentResolution();
+    const camera::View& view = camera::getView();
+    const Vec2& rendRes = view.resolution;
 
     for (const auto& c : capsules)
     {
-        if (c.radius < 1.0 || color.a == 0)
+        const double r = c.radius * view.zoom;
+        if (r < 1.0 || color.a == 0)
             continue;
 
-        const double r = c.radius;
-        const Vec2 p1 = camera::worldToScreen(c.p1);
-        const Vec2 p2 = camera::worldToScreen(c.p2);
+        const Vec2 p1 = view.worldToScreen(c.p1);
+        const Vec2 p2 = view.worldToScreen(c.p2);
 
         const double minX = std::min(p1.x, p2.x) - r;
         const double minY = std::min(p1.y, p2.y) - r;
@@ -284,6 +679,7 @@ void capsules(
 
 void point(Vec2 point, const Color& color)
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
@@ -295,23 +691,25 @@ void point(Vec2 point, const Color& color)
     if (point.x < 0.0 || point.y < 0.0 || point.x >= rendRes.x || point.y >= rendRes.y)
         return;
 
-    if (!SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a))
-        throw std::runtime_error("Failed to set draw color: " + std::string(SDL_GetError()));
+    renderer::_flush();
+    renderer::_setDrawColor(color);
 
+    renderer::stats::countPrimitives(1);
     if (const auto [x, y] = static_cast<SDL_FPoint>(point); !SDL_RenderPoint(rend, x, y))
         throw std::runtime_error("Failed to render point: " + std::string(SDL_GetError()));
 }
 
 void points(const std::vector<Vec2>& points, const Color& color)
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
     if (points.empty() || color.a == 0)
         return;
 
-    if (!SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a))
-        throw std::runtime_error("Failed to set draw color: " + std::string(SDL_GetError()));
+    renderer::_flush();
+    renderer::_setDrawColor(color);
 
     std::vector<SDL_FPoint> sdlPoints;
     sdlPoints.reserve(points.size());
@@ -324,6 +722,7 @@ void points(const std::vector<Vec2>& points, const Color& color)
             sdlPoints.push_back(static_cast<SDL_FPoint>(point));
     }
 
+    renderer::stats::countPrimitives(sdlPoints.size());
     if (!SDL_RenderPoints(rend, sdlPoints.data(), static_cast<int>(sdlPoints.size())))
         throw std::runtime_error("Failed to render points: " + std::string(SDL_GetError()));
 }
@@ -334,6 +733,7 @@ void pointsFromNDArray(
     nb::ndarray<const double, nb::ndim<2>, nb::c_contig, nb::device::cpu> arr, const Color& color
 )
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
@@ -347,8 +747,8 @@ void pointsFromNDArray(
     if (n == 0)
         return;
 
-    if (!SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a))
-        throw std::runtime_error("Failed to set draw color: " + std::string(SDL_GetError()));
+    renderer::_flush();
+    renderer::_setDrawColor(color);
 
     std::vector<SDL_FPoint> sdlPoints;
     sdlPoints.reserve(n);
@@ -363,13 +763,383 @@ void pointsFromNDArray(
             sdlPoints.push_back(static_cast<SDL_FPoint>(pos));
     }
 
+    renderer::stats::countPrimitives(sdlPoints.size());
     if (!SDL_RenderPoints(rend, sdlPoints.data(), static_cast<int>(sdlPoints.size())))
         throw std::runtime_error("Failed to render points: " + std::string(SDL_GetError()));
 }
+
+template <typename T>
+using ShapeArray = nb::ndarray<const T, nb::ndim<2>, nb::c_contig, nb::device::cpu>;
+using RowColorArray = nb::ndarray<const uint8_t, nb::ndim<2>, nb::device::cpu>;
+
+namespace
+{
+// Color of each row, read from an optional (N, 4) uint8 array or shared by every row
+class RowColors
+{
+  public:
+    RowColors(const RowColorArray& colors, const size_t count, const Color& color)
+        : m_color(static_cast<SDL_FColor>(color))
+    {
+        if (!colors.is_valid())
+            return;
+
+        if (colors.shape(0) != count || colors.shape(1) != 4)
+            throw std::invalid_argument("Expected colors array with shape (N, 4)");
+
+        m_data = colors.data();
+        m_rowStride = colors.stride(0);
+        m_channelStride = colors.stride(1);
+    }
+
+    [[nodiscard]] SDL_FColor operator[](const size_t row) const
+    {
+        if (!m_data)
+            return m_color;
+
+        const uint8_t* rgba = m_data + static_cast<int64_t>(row) * m_rowStride;
+        return {
+            static_cast<float>(rgba[0]) / 255.0f,
+            static_cast<float>(rgba[m_channelStride]) / 255.0f,
+            static_cast<float>(rgba[m_channelStride * 2]) / 255.0f,
+            static_cast<float>(rgba[m_channelStride * 3]) / 255.0f,
+        };
+    }
+
+    // True when no row can be visible
+    [[nodiscard]] bool isTransparent() const
+    {
+        return !m_data && m_color.a <= 0.0f;
+    }
+
+  private:
+    SDL_FColor m_color;
+    const uint8_t* m_data = nullptr;
+    int64_t m_rowStride = 0;
+    int64_t m_channelStride = 0;
+};
+}  // namespace
+
+// Rows of [x, y, radius, (thickness)], all submitted as one geometry call
+template <typename T>
+void circlesFromNDArray(
+    ShapeArray<T> arr, const Color& color, const double thickness, const int numSegments,
+    const RowColorArray& colors
+)
+{
+    const renderer::stats::DrawScope drawScope;
+    if (!rend)
+        throw std::runtime_error("Renderer not yet initialized");
+
+    const size_t cols = arr.shape(1);
+    if (cols != 3 && cols != 4)
+        throw std::invalid_argument(
+            "Expected array with 3 or 4 columns: [x, y, radius, (thickness)]"
+        );
+
+    const size_t n = arr.shape(0);
+    const RowColors rowColors(colors, n, color);
+    if (n == 0 || rowColors.isTransparent())
+        return;
+
+    const camera::View& view = camera::getView();
+    const T* data = arr.data();
+
+    shapeVertices.clear();
+    shapeIndices.clear();
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        const T* row = data + i * cols;
+        const double radius = static_cast<double>(row[2]) * view.zoom;
+        if (radius < 1.0)
+            continue;
+
+        const Vec2 center = view.worldToScreen(Vec2{row[0], row[1]});
+        if (!isScreenAabbVisible(
+                center.x - radius, center.y - radius, center.x + radius, center.y + radius,
+                view.resolution
+            ))
+        {
+            continue;
+        }
+
+        const SDL_FColor rowColor = rowColors[i];
+        if (rowColor.a <= 0.0f)
+            continue;
+
+        const double rowThickness = cols == 4 ? static_cast<double>(row[3]) : thickness;
+        const int segments = curveSegments(radius, numSegments);
+        if (rowThickness <= 0.0 || rowThickness >= radius)
+            appendEllipseFill(center, {radius, radius}, segments, rowColor);
+        else
+            appendEllipseRing(
+                center, {radius, radius}, {radius - rowThickness, radius - rowThickness},
+                segments, rowColor
+            );
+    }
+
+    renderShape(
+        shapeVertices.data(), shapeVertices.size(), shapeIndices.data(), shapeIndices.size(),
+        "circle geometry"
+    );
+}
+
+// Rows of [x, y, w, h, (thickness)], all submitted as one geometry call
+template <typename T>
+void rectsFromNDArray(
+    ShapeArray<T> arr, const Color& color, const double thickness, const RowColorArray& colors
+)
+{
+    const renderer::stats::DrawScope drawScope;
+    if (!rend)
+        throw std::runtime_error("Renderer not yet initialized");
+
+    const size_t cols = arr.shape(1);
+    if (cols != 4 && cols != 5)
+        throw std::invalid_argument(
+            "Expected array with 4 or 5 columns: [x, y, w, h, (thickness)]"
+        );
+
+    const size_t n = arr.shape(0);
+    const RowColors rowColors(colors, n, color);
+    if (n == 0 || rowColors.isTransparent())
+        return;
+
+    const camera::View& view = camera::getView();
+    const T* data = arr.data();
+
+    shapeVertices.clear();
+    shapeIndices.clear();
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        const T* row = data + i * cols;
+        const Rect rect{row[0], row[1], row[2], row[3]};
+        if (rect.w < 1.0 || rect.h < 1.0)
+            continue;
+
+        const SDL_FColor rowColor = rowColors[i];
+        if (rowColor.a <= 0.0f)
+            continue;
+
+        const double rowThickness = cols == 5 ? static_cast<double>(row[4]) : thickness;
+        const bool filled =
+            rowThickness <= 0.0 || rowThickness > rect.w / 2.0 || rowThickness > rect.h / 2.0;
+
+        // Outlines are centered on the edges, like draw.rect, with the thickness in screen pixels
+        const double inset = filled ? 0.0 : rowThickness * 0.5 / view.zoom;
+        const Rect outer{
+            rect.x - inset, rect.y - inset, rect.w + inset * 2.0, rect.h + inset * 2.0
+        };
+
+        const auto outerCorners = outer.getCorners();
+        std::array<Vec2, 4> screenOuter;
+        for (int k = 0; k < 4; ++k)
+            screenOuter[k] = view.worldToScreen(outerCorners[k]);
+
+        auto [minX, minY] = screenOuter[0];
+        auto [maxX, maxY] = screenOuter[0];
+        for (const Vec2& corner : screenOuter)
+        {
+            minX = std::min(minX, corner.x);
+            minY = std::min(minY, corner.y);
+            maxX = std::max(maxX, corner.x);
+            maxY = std::max(maxY, corner.y);
+        }
+        if (!isScreenAabbVisible(minX, minY, maxX, maxY, view.resolution))
+            continue;
+
+        const auto base = static_cast<int>(shapeVertices.size());
+        for (const Vec2& corner : screenOuter)
+            shapeVertices.push_back({static_cast<SDL_FPoint>(corner), rowColor, {}});
+
+        if (filled)
+        {
+            shapeIndices.insert(
+                shapeIndices.end(), {base, base + 1, base + 2, base, base + 2, base + 3}
+            );
+            continue;
+        }
+
+        const Rect inner{
+            rect.x + inset, rect.y + inset, rect.w - inset * 2.0, rect.h - inset * 2.0
+        };
+        for (const Vec2& corner : inner.getCorners())
+            shapeVertices.push_back(
+                {static_cast<SDL_FPoint>(view.worldToScreen(corner)), rowColor, {}}
+            );
+
+        // A mitred frame, one quad between each outer edge and its inner edge
+        for (int k = 0; k < 4; ++k)
+        {
+            const int o0 = base + k;
+            const int o1 = base + (k + 1) % 4;
+            const int i0 = o0 + 4;
+            const int i1 = o1 + 4;
+
+            shapeIndices.insert(shapeIndices.end(), {o0, o1, i1, o0, i1, i0});
+        }
+    }
+
+    renderShape(
+        shapeVertices.data(), shapeVertices.size(), shapeIndices.data(), shapeIndices.size(),
+        "rect geometry"
+    );
+}
+
+// Rows of [x1, y1, x2, y2, (thickness)], all submitted as one geometry call. Thin lines become
+// one pixel wide quads so they share the submission.
+template <typename T>
+void linesFromNDArray(
+    ShapeArray<T> arr, const Color& color, const double thickness, const RowColorArray& colors
+)
+{
+    const renderer::stats::DrawScope drawScope;
+    if (!rend)
+        throw std::runtime_error("Renderer not yet initialized");
+
+    const size_t cols = arr.shape(1);
+    if (cols != 4 && cols != 5)
+        throw std::invalid_argument(
+            "Expected array with 4 or 5 columns: [x1, y1, x2, y2, (thickness)]"
+        );
+
+    const size_t n = arr.shape(0);
+    const RowColors rowColors(colors, n, color);
+    if (n == 0 || rowColors.isTransparent())
+        return;
+
+    const camera::View& view = camera::getView();
+    const T* data = arr.data();
+
+    shapeVertices.clear();
+    shapeIndices.clear();
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        const T* row = data + i * cols;
+        const SDL_FColor rowColor = rowColors[i];
+        if (rowColor.a <= 0.0f)
+            continue;
+
+        const Vec2 a = view.worldToScreen(Vec2{row[0], row[1]});
+        const Vec2 b = view.worldToScreen(Vec2{row[2], row[3]});
+        const double width = std::max(1.0, cols == 5 ? static_cast<double>(row[4]) : thickness);
+
+        const double pad = width * 0.5;
+        if (!isScreenAabbVisible(
+                std::min(a.x, b.x) - pad, std::min(a.y, b.y) - pad, std::max(a.x, b.x) + pad,
+                std::max(a.y, b.y) + pad, view.resolution
+            ))
+        {
+            continue;
+        }
+
+        appendThickLine(a, b, width, rowColor);
+    }
+
+    renderShape(
+        shapeVertices.data(), shapeVertices.size(), shapeIndices.data(), shapeIndices.size(),
+        "line geometry"
+    );
+}
+
+using VertexArray = nb::ndarray<const float, nb::ndim<2>, nb::device::cpu>;
+using IndexArray = nb::ndarray<const int, nb::ndim<1>, nb::c_contig, nb::device::cpu>;
+
+namespace
+{
+void checkVertexArray(
+    const VertexArray& arr, const size_t count, const size_t columns, const char* name
+)
+{
+    if (arr.shape(0) != count || arr.shape(1) != columns)
+        throw std::invalid_argument(
+            std::string("Expected ") + name + " array with shape (N, " + std::to_string(columns) +
+            ")"
+        );
+}
+
+// Byte stride between rows, which the renderer reads in place. Each row's values must be adjacent.
+int rowStride(const VertexArray& arr, const size_t count, const size_t columns, const char* name)
+{
+    checkVertexArray(arr, count, columns, name);
+    if (count > 0 && arr.stride(1) != 1)
+        throw std::invalid_argument(
+            std::string("The values in each row of ") + name + " must be adjacent in memory"
+        );
+
+    return static_cast<int>(arr.stride(0) * static_cast<int64_t>(sizeof(float)));
+}
+
+// Copies rows into a packed buffer for a Mesh, whatever the array's strides
+std::vector<float> packRows(
+    const VertexArray& arr, const size_t count, const size_t columns, const char* name
+)
+{
+    std::vector<float> packed;
+    if (!arr.is_valid())
+        return packed;
+
+    checkVertexArray(arr, count, columns, name);
+    packed.resize(count * columns);
+
+    const float* data = arr.data();
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t j = 0; j < columns; ++j)
+            packed[i * columns + j] = data[static_cast<int64_t>(i) * arr.stride(0) +
+                                           static_cast<int64_t>(j) * arr.stride(1)];
+    }
+
+    return packed;
+}
+}  // namespace
+
+void geometryFromNDArray(
+    const Texture* texture, const VertexArray& positions, const VertexArray& colors,
+    const VertexArray& texCoords, const IndexArray& indices, const Color& color,
+    const bool worldSpace
+)
+{
+    const size_t count = positions.shape(0);
+    const int positionStride = rowStride(positions, count, 2, "positions");
+    const int colorStride = colors.is_valid() ? rowStride(colors, count, 4, "colors") : 0;
+    const int texCoordStride =
+        texCoords.is_valid() ? rowStride(texCoords, count, 2, "tex_coords") : 0;
+
+    geometryRaw(
+        texture, positions.data(), positionStride, colors.is_valid() ? colors.data() : nullptr,
+        colorStride, texCoords.is_valid() ? texCoords.data() : nullptr, texCoordStride,
+        static_cast<int>(count), indices.is_valid() ? indices.data() : nullptr,
+        indices.is_valid() ? static_cast<int>(indices.shape(0)) : 0, color, worldSpace
+    );
+}
+
+void setMeshData(
+    Mesh& mesh, const VertexArray& positions, const VertexArray& colors,
+    const VertexArray& texCoords, const IndexArray& indices
+)
+{
+    if (positions.shape(1) != 2)
+        throw std::invalid_argument("Expected positions array with shape (N, 2)");
+
+    const size_t count = positions.shape(0);
+    mesh.setPositions(packRows(positions, count, 2, "positions"));
+    mesh.setColors(packRows(colors, count, 4, "colors"));
+    mesh.setTexCoords(packRows(texCoords, count, 2, "tex_coords"));
+    mesh.setIndices(
+        indices.is_valid()
+            ? std::vector<int>(indices.data(), indices.data() + indices.shape(0))
+            : std::vector<int>{}
+    );
+}
 #endif  // KRAKEN_ENABLE_PYTHON
 
 void ellipse(Rect bounds, const Color& color, const double thickness, const int numSegments)
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
@@ -379,8 +1149,10 @@ void ellipse(Rect bounds, const Color& color, const double thickness, const int
     const Vec2 center = bounds.getCenter();
     const double radiusX = bounds.w / 2.0;
     const double radiusY = bounds.h / 2.0;
+    const int segments =
+        curveSegments(std::max(radiusX, radiusY) * camera::getView().zoom, numSegments);
     const std::vector<Vec2> screenPoints = toScreenPoints(
-        getEllipsePoints(center, radiusX, radiusY, numSegments)
+        getEllipsePoints(center, radiusX, radiusY, segments)
     );
 
     if (!arePointsVisible(screenPoints, renderer::getCurrentResolution()))
@@ -388,7 +1160,7 @@ void ellipse(Rect bounds, const Color& color, const double thickness, const int
 
     const bool filled = (thickness <= 0.0 || (thickness >= radiusX && thickness >= radiusY));
     if (filled)
-        _polygonFilled(Polygon(screenPoints), color);
+        fillConvex(screenPoints, color);
     else
         drawPolylineScreen(screenPoints, color, thickness, true);
 }
@@ -398,12 +1170,14 @@ void ellipses(
     const int numSegments
 )
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
     if (bounds.empty() || color.a == 0)
         return;
 
+    const double zoom = camera::getView().zoom;
     for (const auto& rect : bounds)
     {
         if (rect.w < 1 || rect.h < 1)
@@ -412,15 +1186,16 @@ void ellipses(
         const Vec2 center = rect.getCenter();
         const double radiusX = rect.w / 2.0;
         const double radiusY = rect.h / 2.0;
+        const int segments = curveSegments(std::max(radiusX, radiusY) * zoom, numSegments);
         const std::vector<Vec2> screenPoints = toScreenPoints(
-            getEllipsePoints(center, radiusX, radiusY, numSegments)
+            getEllipsePoints(center, radiusX, radiusY, segments)
         );
 
         if (!arePointsVisible(screenPoints, renderer::getCurrentResolution()))
             continue;
 
         if (thickness <= 0.0 || (thickness >= radiusX && thickness >= radiusY))
-            _polygonFilled(Polygon(screenPoints), color);
+            fillConvex(screenPoints, color);
         else
             drawPolylineScreen(screenPoints, color, thickness, true);
     }
@@ -428,6 +1203,7 @@ void ellipses(
 
 void line(Line line, const Color& color, const double thickness)
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
@@ -442,8 +1218,9 @@ void line(Line line, const Color& color, const double thickness)
         const auto a = static_cast<SDL_FPoint>(screenA);
         const auto b = static_cast<SDL_FPoint>(screenB);
 
-        if (!SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a))
-            throw std::runtime_error("Failed to set draw color: " + std::string(SDL_GetError()));
+        renderer::_flush();
+        renderer::_setDrawColor(color);
+        renderer::stats::countPrimitives(2);
         if (!SDL_RenderLine(rend, a.x, a.y, b.x, b.y))
             throw std::runtime_error("Failed to render line: " + std::string(SDL_GetError()));
     }
@@ -455,6 +1232,7 @@ void line(Line line, const Color& color, const double thickness)
 
 void lines(const std::vector<Line>& lines, const Color& color, const double thickness)
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
@@ -463,28 +1241,35 @@ void lines(const std::vector<Line>& lines, const Color& color, const double thic
 
     if (thickness <= 1.0)
     {
-        if (!SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a))
-            throw std::runtime_error("Failed to set draw color: " + std::string(SDL_GetError()));
+        renderer::_flush();
+        renderer::_setDrawColor(color);
 
         for (const auto& line : lines)
         {
             const auto a = static_cast<SDL_FPoint>(camera::worldToScreen(line.getA()));
             const auto b = static_cast<SDL_FPoint>(camera::worldToScreen(line.getB()));
 
+            renderer::stats::countPrimitives(2);
             if (!SDL_RenderLine(rend, a.x, a.y, b.x, b.y))
                 throw std::runtime_error("Failed to render line: " + std::string(SDL_GetError()));
         }
     }
     else
     {
+        shapeVertices.clear();
+        shapeIndices.clear();
+
+        const auto fColor = static_cast<SDL_FColor>(color);
         for (const auto& line : lines)
-            _thickLine(
-                {
-                    camera::worldToScreen(line.getA()),
-                    camera::worldToScreen(line.getB()),
-                },
-                color, thickness
+            appendThickLine(
+                camera::worldToScreen(line.getA()), camera::worldToScreen(line.getB()), thickness,
+                fColor
             );
+
+        renderShape(
+            shapeVertices.data(), shapeVertices.size(), shapeIndices.data(), shapeIndices.size(),
+            "thick lines"
+        );
     }
 }
 
@@ -493,6 +1278,7 @@ void rect(
     double radiusTopLeft, double radiusTopRight, double radiusBottomRight, double radiusBottomLeft
 )
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
@@ -520,7 +1306,7 @@ void rect(
             std::clamp(radiusBottomRight, 0.0, maxRadius),
             std::clamp(radiusBottomLeft, 0.0, maxRadius),
         };
-        worldPoints = _roundedRectPolygon(rect, radii).points;
+        worldPoints = _roundedRectPolygon(rect, radii).getPoints();
     }
     else
     {
@@ -533,7 +1319,7 @@ void rect(
         return;
 
     if (thickness <= 0 || thickness > rect.w / 2.0 || thickness > rect.h / 2.0)
-        _polygonFilled(Polygon(screenPoints), color);
+        fillConvex(screenPoints, color);
     else
         drawPolylineScreen(screenPoints, color, static_cast<double>(thickness), true);
 }
@@ -544,6 +1330,7 @@ void rects(
     double radiusBottomRight, double radiusBottomLeft
 )
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
@@ -568,25 +1355,29 @@ void rects(
         );
 }
 
-void polygon(const Polygon& polygon, const Color& color, const bool filled)
+void polygon(
+    const Polygon& polygon, const Color& color, const bool filled, const double thickness,
+    const LineJoin join
+)
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
     if (color.a == 0)
         return;
 
-    const size_t size = polygon.points.size();
+    const std::vector<Vec2>& points = polygon.getPoints();
+    const size_t size = points.size();
     if (size == 0)
         return;
 
-    // If will be drawn as point or line, set color now
-    if ((size <= 2 || !filled) && !SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a))
-        throw std::runtime_error("Failed to set draw color: " + std::string(SDL_GetError()));
-
     if (size == 1)
     {
-        const auto [x, y] = static_cast<SDL_FPoint>(camera::worldToScreen(polygon.points.at(0)));
+        const auto [x, y] = static_cast<SDL_FPoint>(camera::worldToScreen(points.at(0)));
+        renderer::_flush();
+        renderer::_setDrawColor(color);
+        renderer::stats::countPrimitives(1);
         if (!SDL_RenderPoint(rend, x, y))
             throw std::runtime_error("Failed to render point: " + std::string(SDL_GetError()));
 
@@ -595,60 +1386,51 @@ void polygon(const Polygon& polygon, const Color& color, const bool filled)
 
     if (size == 2)
     {
-        const auto a = static_cast<SDL_FPoint>(camera::worldToScreen(polygon.points.at(0)));
-        const auto b = static_cast<SDL_FPoint>(camera::worldToScreen(polygon.points.at(1)));
+        const auto a = static_cast<SDL_FPoint>(camera::worldToScreen(points.at(0)));
+        const auto b = static_cast<SDL_FPoint>(camera::worldToScreen(points.at(1)));
 
+        renderer::_flush();
+        renderer::_setDrawColor(color);
+        renderer::stats::countPrimitives(2);
         if (!SDL_RenderLine(rend, a.x, a.y, b.x, b.y))
             throw std::runtime_error("Failed to render line: " + std::string(SDL_GetError()));
 
         return;
     }
 
-    Polygon cameraPolygon(toScreenPoints(polygon.points));
-
-    // Just draw lines if not filled
-    if (!filled)
-    {
-        std::vector<SDL_FPoint> points;
-        points.reserve(cameraPolygon.points.size() + 1);
-        for (const auto& p : cameraPolygon.points)
-            points.push_back(static_cast<SDL_FPoint>(p));
-        points.push_back(points.front());
-
-        if (!SDL_RenderLines(rend, points.data(), static_cast<int>(points.size())))
-        {
-            throw std::runtime_error(
-                "Failed to render polygon outline: " + std::string(SDL_GetError())
-            );
-        }
-
-        return;
-    }
-
-    _polygonFilled(cameraPolygon, color);
+    if (filled)
+        _polygonFilled(polygon, color);
+    else
+        drawPolylineScreen(toScreenPoints(points), color, thickness, true, join);
 }
 
-void polygons(const std::vector<Polygon>& polygons, const Color& color, const bool filled)
+void polygons(
+    const std::vector<Polygon>& polygons, const Color& color, const bool filled,
+    const double thickness, const LineJoin join
+)
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
     if (color.a == 0)
         return;
 
-    if (!SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a))
-        throw std::runtime_error("Failed to set draw color: " + std::string(SDL_GetError()));
-
     for (const Polygon& polygon : polygons)
     {
-        const size_t size = polygon.points.size();
+        const std::vector<Vec2>& points = polygon.getPoints();
+        const size_t size = points.size();
         if (size == 0)
             continue;
         if (size == 1)
         {
             const auto [x, y] = static_cast<SDL_FPoint>(
-                camera::worldToScreen(polygon.points.at(0))
+                camera::worldToScreen(points.at(0))
             );
+            // Filled polygons before this one may still be queued
+            renderer::_flush();
+            renderer::_setDrawColor(color);
+            renderer::stats::countPrimitives(1);
             if (!SDL_RenderPoint(rend, x, y))
                 throw std::runtime_error("Failed to render point: " + std::string(SDL_GetError()));
 
@@ -656,34 +1438,22 @@ void polygons(const std::vector<Polygon>& polygons, const Color& color, const bo
         }
         if (size == 2)
         {
-            const auto a = static_cast<SDL_FPoint>(camera::worldToScreen(polygon.points.at(0)));
-            const auto b = static_cast<SDL_FPoint>(camera::worldToScreen(polygon.points.at(1)));
+            const auto a = static_cast<SDL_FPoint>(camera::worldToScreen(points.at(0)));
+            const auto b = static_cast<SDL_FPoint>(camera::worldToScreen(points.at(1)));
 
+            renderer::_flush();
+            renderer::_setDrawColor(color);
+            renderer::stats::countPrimitives(2);
             if (!SDL_RenderLine(rend, a.x, a.y, b.x, b.y))
                 throw std::runtime_error("Failed to render line: " + std::string(SDL_GetError()));
 
             continue;
         }
 
-        Polygon cameraPolygon(toScreenPoints(polygon.points));
-
-        if (!filled)
-        {
-            std::vector<SDL_FPoint> points;
-            points.reserve(cameraPolygon.points.size() + 1);
-            for (const auto& p : cameraPolygon.points)
-                points.push_back(static_cast<SDL_FPoint>(p));
-            points.push_back(points.front());
-
-            if (!SDL_RenderLines(rend, points.data(), static_cast<int>(points.size())))
-                throw std::runtime_error(
-                    "Failed to render polygon outline: " + std::string(SDL_GetError())
-                );
-
-            continue;
-        }
-
-        _polygonFilled(cameraPolygon, color);
+        if (filled)
+            _polygonFilled(polygon, color);
+        else
+            drawPolylineScreen(toScreenPoints(points), color, thickness, true, join);
     }
 }
 
@@ -691,6 +1461,7 @@ void geometry(
     const Texture* texture, const std::vector<Vertex>& vertices, const std::vector<int>& indices
 )
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
@@ -712,19 +1483,174 @@ void geometry(
         sdlVertices.push_back(vert);
     }
 
+    if (!texture)
+    {
+        renderShape(
+            sdlVertices.data(), sdlVertices.size(), indices.empty() ? nullptr : indices.data(),
+            indices.size(), "geometry"
+        );
+        return;
+    }
+
+    SDL_Texture* sdlTexture = texture->getSDL();
+
+    renderer::_flush();
+    renderer::stats::countGeometry(sdlTexture, sdlVertices.size(), indices.size());
     if (!SDL_RenderGeometry(
-            rend, texture ? texture->getSDL() : nullptr, sdlVertices.data(),
-            static_cast<int>(sdlVertices.size()), indices.empty() ? nullptr : indices.data(),
-            static_cast<int>(indices.size())
+            rend, sdlTexture, sdlVertices.data(), static_cast<int>(sdlVertices.size()),
+            indices.empty() ? nullptr : indices.data(), static_cast<int>(indices.size())
         ))
         throw std::runtime_error("Failed to draw geometry: " + std::string(SDL_GetError()));
 }
 
+void geometryRaw(
+    const Texture* texture, const float* positions, const int positionStride, const float* colors,
+    const int colorStride, const float* texCoords, const int texCoordStride, const int vertexCount,
+    const int* indices, const int indexCount, const Color& color, const bool worldSpace
+)
+{
+    const renderer::stats::DrawScope drawScope;
+    if (!rend)
+        throw std::runtime_error("Renderer not yet initialized");
+
+    if (vertexCount <= 0)
+        return;
+
+    if (!positions)
+        throw std::invalid_argument("Geometry needs positions");
+
+    if (texture)
+    {
+        if (!texture->hasUsage(TextureUsage::Drawable))
+            throw std::runtime_error("Texture is not drawable");
+        if (!texCoords)
+            throw std::invalid_argument("Textured geometry needs texture coordinates");
+    }
+
+    const float* xy = positions;
+    int xyStride = positionStride;
+
+    // Only positions depend on the camera, so they are all that gets copied
+    const camera::View& view = camera::getView();
+    if (worldSpace && view.active)
+    {
+        screenPositions.resize(static_cast<size_t>(vertexCount) * 2);
+
+        const auto* bytes = reinterpret_cast<const char*>(positions);
+        for (int i = 0; i < vertexCount; ++i)
+        {
+            const auto* point = reinterpret_cast<const float*>(
+                bytes + static_cast<ptrdiff_t>(i) * positionStride
+            );
+            const Vec2 screen = view.worldToScreen({point[0], point[1]});
+            screenPositions[i * 2] = static_cast<float>(screen.x);
+            screenPositions[i * 2 + 1] = static_cast<float>(screen.y);
+        }
+
+        xy = screenPositions.data();
+        xyStride = 2 * sizeof(float);
+    }
+
+    // A zero stride reads the same color for every vertex
+    const auto uniformColor = static_cast<SDL_FColor>(color);
+    const auto* sdlColors = colors ? reinterpret_cast<const SDL_FColor*>(colors) : &uniformColor;
+    SDL_Texture* sdlTexture = texture ? texture->getSDL() : nullptr;
+
+    renderer::_flush();
+    renderer::stats::countGeometry(
+        sdlTexture, static_cast<size_t>(vertexCount), static_cast<size_t>(indexCount)
+    );
+    if (!SDL_RenderGeometryRaw(
+            rend, sdlTexture, xy, xyStride, sdlColors, colors ? colorStride : 0,
+            texture ? texCoords : nullptr, texCoordStride, vertexCount,
+            indexCount > 0 ? indices : nullptr, indexCount, sizeof(int)
+        ))
+        throw std::runtime_error("Failed to draw geometry: " + std::string(SDL_GetError()));
+}
+
+void Mesh::setPositions(std::vector<float> positions)
+{
+    if (positions.size() % 2 != 0)
+        throw std::invalid_argument("Mesh positions must be [x, y] pairs");
+
+    m_positions = std::move(positions);
+}
+
+void Mesh::setColors(std::vector<float> colors)
+{
+    if (colors.size() % 4 != 0)
+        throw std::invalid_argument("Mesh colors must be [r, g, b, a] values");
+
+    m_colors = std::move(colors);
+}
+
+void Mesh::setTexCoords(std::vector<float> texCoords)
+{
+    if (texCoords.size() % 2 != 0)
+        throw std::invalid_argument("Mesh texture coordinates must be [u, v] pairs");
+
+    m_texCoords = std::move(texCoords);
+}
+
+void Mesh::setIndices(std::vector<int> indices)
+{
+    m_indices = std::move(indices);
+}
+
+const std::vector<float>& Mesh::getPositions() const
+{
+    return m_positions;
+}
+
+const std::vector<float>& Mesh::getColors() const
+{
+    return m_colors;
+}
+
+const std::vector<float>& Mesh::getTexCoords() const
+{
+    return m_texCoords;
+}
+
+const std::vector<int>& Mesh::getIndices() const
+{
+    return m_indices;
+}
+
+size_t Mesh::getVertexCount() const
+{
+    return m_positions.size() / 2;
+}
+
+void mesh(const Mesh& mesh, const Texture* texture, const bool worldSpace)
+{
+    const size_t vertexCount = mesh.getVertexCount();
+    if (vertexCount == 0)
+        return;
+
+    const std::vector<float>& colors = mesh.getColors();
+    const std::vector<float>& texCoords = mesh.getTexCoords();
+    if (!colors.empty() && colors.size() != vertexCount * 4)
+        throw std::invalid_argument("Mesh needs one color per vertex");
+    if (!texCoords.empty() && texCoords.size() != vertexCount * 2)
+        throw std::invalid_argument("Mesh needs one texture coordinate per vertex");
+
+    const std::vector<int>& indices = mesh.getIndices();
+    geometryRaw(
+        texture, mesh.getPositions().data(), 2 * sizeof(float),
+        colors.empty() ? nullptr : colors.data(), 4 * sizeof(float),
+        texCoords.empty() ? nullptr : texCoords.data(), 2 * sizeof(float),
+        static_cast<int>(vertexCount), indices.data(), static_cast<int>(indices.size()),
+        mesh.color, worldSpace
+    );
+}
+
 void bezier(
     const std::vector<Vec2>& controlPoints, const Color& color, const double thickness,
-    const int numSegments
+    const int numSegments, const LineCap cap
 )
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
@@ -757,23 +1683,7 @@ void bezier(
         points.push_back(camera::worldToScreen(p));
     }
 
-    if (thickness > 1.0)
-    {
-        for (size_t i = 0; i < points.size() - 1; ++i)
-            _thickLine({points[i], points[i + 1]}, color, thickness);
-        return;
-    }
-
-    std::vector<SDL_FPoint> sdlPoints;
-    sdlPoints.reserve(points.size());
-    for (const auto& p : points)
-        sdlPoints.push_back(static_cast<SDL_FPoint>(p));
-
-    if (!SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a))
-        throw std::runtime_error("Failed to set draw color: " + std::string(SDL_GetError()));
-
-    if (!SDL_RenderLines(rend, sdlPoints.data(), static_cast<int>(sdlPoints.size())))
-        throw std::runtime_error("Failed to render bezier lines: " + std::string(SDL_GetError()));
+    drawPolylineScreen(points, color, thickness, false, LineJoin::Miter, cap);
 }
 
 void sector(
@@ -781,217 +1691,147 @@ void sector(
     int numSegments
 )
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
-    if (circle.radius < 1.0 || color.a == 0)
+    const camera::View& view = camera::getView();
+    const double radius = circle.radius * view.zoom;
+    if (radius < 1.0 || color.a == 0)
         return;
 
-    const Vec2 rendRes = renderer::getCurrentResolution();
-    const Vec2 center = camera::worldToScreen(circle.pos);
-    const double cameraAngle = camera::getActiveAngle();
+    const Vec2& rendRes = view.resolution;
+    const Vec2 center = view.worldToScreen(circle.pos);
+    const double cameraAngle = view.angle;
 
     // Basic culling
-    if (center.x + circle.radius < 0.0 || center.y + circle.radius < 0.0 ||
-        center.x - circle.radius >= rendRes.x || center.y - circle.radius >= rendRes.y)
-        return;
-
-    const auto fColor = static_cast<SDL_FColor>(color);
-    const int segments = std::max(1, numSegments);
+    if (center.x + radius < 0.0 || center.y + radius < 0.0 || center.x - radius >= rendRes.x ||
+        center.y - radius >= rendRes.y)
+        return;
 
-    if (thickness <= 0.0 || thickness >= circle.radius)
+    // Without a count, the arc gets its share of the segments a full circle would use
+    const double sweep = endAngle - startAngle;
+    const int segments = numSegments > 0
+                             ? numSegments
+                             : std::max(
+                                   1, static_cast<int>(std::ceil(
+                                          curveSegments(radius, 0) * std::abs(sweep) / (2.0 * M_PI)
+                                      ))
+                               );
+
+    // The start and end angles are arbitrary, so the arc steps by one fixed rotation instead of
+    // reading a table. Fill and outline share these directions.
+    static std::vector<Vec2> arc;
+    arc.clear();
+
+    const double step = sweep / static_cast<double>(segments);
+    const Vec2 stepRotation{std::cos(step), std::sin(step)};
+    Vec2 direction{std::cos(startAngle + cameraAngle), std::sin(startAngle + cameraAngle)};
+    for (int i = 0; i <= segments; ++i)
     {
-        // Filled sector (pie slice)
-        std::vector<SDL_Vertex> vertices;
-        vertices.reserve(segments + 2);
+        arc.push_back(direction);
+        direction = rotated(direction, stepRotation);
+    }
 
-        // Center point
-        vertices.push_back({static_cast<SDL_FPoint>(center), fColor, {}});
+    const auto fColor = static_cast<SDL_FColor>(color);
+    shapeVertices.clear();
+    shapeIndices.clear();
 
-        // Edge points
-        for (int i = 0; i <= segments; ++i)
-        {
-            double t = static_cast<double>(i) / static_cast<double>(segments);
-            double theta = startAngle + (endAngle - startAngle) * t + cameraAngle;
-            Vec2 p = center + Vec2(cos(theta), sin(theta)) * circle.radius;
-            vertices.push_back({static_cast<SDL_FPoint>(p), fColor, {}});
-        }
+    if (thickness <= 0.0 || thickness >= radius)
+    {
+        // Filled sector (pie slice), fanned from the center
+        shapeVertices.push_back({static_cast<SDL_FPoint>(center), fColor, {}});
+        for (const Vec2& dir : arc)
+            shapeVertices.push_back({static_cast<SDL_FPoint>(center + dir * radius), fColor, {}});
 
-        std::vector<int> indices;
-        indices.reserve(segments * 3);
         for (int i = 1; i <= segments; ++i)
-        {
-            indices.push_back(0);
-            indices.push_back(i);
-            indices.push_back(i + 1);
-        }
+            shapeIndices.insert(shapeIndices.end(), {0, i, i + 1});
 
-        if (!SDL_RenderGeometry(
-                rend, nullptr, vertices.data(), static_cast<int>(vertices.size()), indices.data(),
-                static_cast<int>(indices.size())
-            ))
-            throw std::runtime_error(
-                std::string("Failed to render sector geometry: ") + SDL_GetError()
-            );
+        renderShape(
+            shapeVertices.data(), shapeVertices.size(), shapeIndices.data(), shapeIndices.size(),
+            "sector geometry"
+        );
 
         return;
     }
 
-    // Outline arc with thickness
-    std::vector<SDL_Vertex> vertices;
-    vertices.reserve((segments + 1) * 2);
-
-    for (int i = 0; i <= segments; ++i)
+    // Outline arc with thickness, an outer and inner vertex per direction
+    const double innerRadius = radius - thickness;
+    for (const Vec2& dir : arc)
     {
-        double t = static_cast<double>(i) / static_cast<double>(segments);
-        double theta = startAngle + (endAngle - startAngle) * t + cameraAngle;
-        double cosT = cos(theta);
-        double sinT = sin(theta);
-
-        // Outer vertex
-        vertices.push_back({
-            static_cast<SDL_FPoint>(center + Vec2(cosT, sinT) * circle.radius),
-            fColor,
-            {},
-        });
-        // Inner vertex
-        vertices.push_back({
-            static_cast<SDL_FPoint>(center + Vec2(cosT, sinT) * (circle.radius - thickness)),
-            fColor,
-            {},
-        });
+        shapeVertices.push_back({static_cast<SDL_FPoint>(center + dir * radius), fColor, {}});
+        shapeVertices.push_back({static_cast<SDL_FPoint>(center + dir * innerRadius), fColor, {}});
     }
 
-    std::vector<int> indices;
-    indices.reserve(segments * 6);
     for (int i = 0; i < segments; ++i)
     {
-        int topL = i * 2;
-        int botL = i * 2 + 1;
-        int topR = (i + 1) * 2;
-        int botR = (i + 1) * 2 + 1;
-
-        indices.push_back(topL);
-        indices.push_back(topR);
-        indices.push_back(botL);
-
-        indices.push_back(topR);
-        indices.push_back(botR);
-        indices.push_back(botL);
+        const int topL = i * 2;
+        const int botL = i * 2 + 1;
+        const int topR = (i + 1) * 2;
+        const int botR = (i + 1) * 2 + 1;
+
+        shapeIndices.insert(shapeIndices.end(), {topL, topR, botL, topR, botR, botL});
     }
 
-    if (!SDL_RenderGeometry(
-            rend, nullptr, vertices.data(), static_cast<int>(vertices.size()), indices.data(),
-            static_cast<int>(indices.size())
-        ))
-        throw std::runtime_error(std::string("Failed to render sector outline: ") + SDL_GetError());
+    renderShape(
+        shapeVertices.data(), shapeVertices.size(), shapeIndices.data(), shapeIndices.size(),
+        "sector outline"
+    );
 }
 
 void polyline(
-    const std::vector<Vec2>& points, const Color& color, const double thickness, const bool closed
+    const std::vector<Vec2>& points, const Color& color, const double thickness, const bool closed,
+    const LineJoin join, const LineCap cap, const double miterLimit
 )
 {
+    const renderer::stats::DrawScope drawScope;
     if (!rend)
         throw std::runtime_error("Renderer not yet initialized");
 
     if (points.size() < 2 || color.a == 0)
         return;
 
-    std::vector<SDL_FPoint> sdlPoints;
-    sdlPoints.reserve(points.size() + (closed ? 1 : 0));
-    for (const auto& p : points)
-        sdlPoints.push_back(static_cast<SDL_FPoint>(camera::worldToScreen(p)));
-
-    if (closed && !sdlPoints.empty())
-        sdlPoints.push_back(sdlPoints.front());
-
-    if (thickness <= 1.0)
-    {
-        if (!SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a))
-            throw std::runtime_error("Failed to set draw color: " + std::string(SDL_GetError()));
-
-        if (!SDL_RenderLines(rend, sdlPoints.data(), static_cast<int>(sdlPoints.size())))
-            throw std::runtime_error("Failed to render polyline: " + std::string(SDL_GetError()));
-    }
-    else
-    {
-        const size_t count = sdlPoints.size();
-        for (size_t i = 0; i < count - 1; ++i)
-        {
-            const Vec2 a{sdlPoints[i].x, sdlPoints[i].y};
-            const Vec2 b{sdlPoints[i + 1].x, sdlPoints[i + 1].y};
-            _thickLine(Line(a, b), color, thickness);
-        }
-    }
+    drawPolylineScreen(
+        toScreenPoints(points), color, thickness, closed, join, cap, std::max(miterLimit, 1.0)
+    );
 }
 
 void _polygonFilled(const Polygon& polygon, const Color& color)
 {
-    std::vector<std::vector<kn::Vec2>> vertices;
-    vertices.push_back(polygon.points);
-
-    std::vector<uint32_t> indices = mapbox::earcut<uint32_t>(vertices);
+    // The camera maps world to screen affinely, so triangles cached in world space stay valid
+    const std::vector<uint32_t>& indices = polygon.getTriangles();
+    if (indices.empty())
+        return;
 
     const auto fColor = static_cast<SDL_FColor>(color);
-    std::vector<SDL_Vertex> sdlVertices;
-    sdlVertices.reserve(polygon.points.size());
+    shapeVertices.clear();
+    shapeVertices.reserve(polygon.getPoints().size());
 
-    for (const auto& point : polygon.points)
-        sdlVertices.push_back({static_cast<SDL_FPoint>(point), fColor, {}});
-
-    if (!SDL_RenderGeometry(
-            rend, nullptr, sdlVertices.data(), static_cast<int>(sdlVertices.size()),
-            reinterpret_cast<const int*>(indices.data()), static_cast<int>(indices.size())
-        ))
-    {
-        throw std::runtime_error(
-            std::string("Failed to render polygon geometry: ") + SDL_GetError()
+    for (const auto& point : polygon.getPoints())
+        shapeVertices.push_back(
+            {static_cast<SDL_FPoint>(camera::worldToScreen(point)), fColor, {}}
         );
-    }
+
+    renderShape(
+        shapeVertices.data(), shapeVertices.size(), reinterpret_cast<const int*>(indices.data()),
+        indices.size(), "polygon geometry"
+    );
 }
 
 void _ellipseFilled(
     const Vec2& center, double radiusX, double radiusY, const Color& color, int numSegments
 )
 {
-    std::vector<SDL_Vertex> vertices;
-    vertices.reserve(numSegments + 2);
-
-    const auto fColor = static_cast<SDL_FColor>(color);
-
-    // Center point
-    vertices.push_back({static_cast<SDL_FPoint>(center), fColor, {0.0f, 0.0f}});
-
-    // Edge points
-    for (int i = 0; i <= numSegments; ++i)
-    {
-        auto theta = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(numSegments);
-        Vec2 p{
-            center.x + radiusX * cos(theta),
-            center.y + radiusY * sin(theta),
-        };
-        vertices.push_back({static_cast<SDL_FPoint>(p), fColor, {}});
-    }
+    const int segments = curveSegments(std::max(radiusX, radiusY), numSegments);
 
-    // Create triangle fan
-    std::vector<int> indices;
-    indices.reserve(numSegments * 3);
-    for (int i = 1; i <= numSegments; ++i)
-    {
-        indices.push_back(0);      // Center
-        indices.push_back(i);      // Current edge
-        indices.push_back(i + 1);  // Next edge
-    }
+    shapeVertices.clear();
+    shapeIndices.clear();
+    appendEllipseFill(center, {radiusX, radiusY}, segments, static_cast<SDL_FColor>(color));
 
-    if (!SDL_RenderGeometry(
-            rend, nullptr, vertices.data(), static_cast<int>(vertices.size()), indices.data(),
-            static_cast<int>(indices.size())
-        ))
-    {
-        throw std::runtime_error(
-            std::string("Failed to render ellipse geometry: ") + SDL_GetError()
-        );
-    }
+    renderShape(
+        shapeVertices.data(), shapeVertices.size(), shapeIndices.data(), shapeIndices.size(),
+        "ellipse geometry"
+    );
 }
 
 void _ellipseOutline(
@@ -999,275 +1839,154 @@ void _ellipseOutline(
     int numSegments
 )
 {
-    const auto fColor = static_cast<SDL_FColor>(color);
-
-    // We need 2 vertices per segment (inner and outer)
-    std::vector<SDL_Vertex> vertices;
-    vertices.reserve((numSegments + 1) * 2);
-
-    for (int i = 0; i <= numSegments; ++i)
-    {
-        auto theta = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(numSegments);
-        double cosT = cos(theta);
-        double sinT = sin(theta);
-
-        // Outer vertex
-        Vec2 outerPoint{
-            center.x + radiusX * cosT,
-            center.y + radiusY * sinT,
-        };
-        vertices.push_back({static_cast<SDL_FPoint>(outerPoint), fColor, {}});
-
-        // Inner vertex
-        Vec2 innerPoint{
-            center.x + (radiusX - thickness) * cosT,
-            center.y + (radiusY - thickness) * sinT,
-        };
-        vertices.push_back({static_cast<SDL_FPoint>(innerPoint), fColor, {}});
-    }
+    const int segments = curveSegments(std::max(radiusX, radiusY), numSegments);
 
-    // Indices for the triangles (forming a quad between each segment)
-    std::vector<int> indices;
-    indices.reserve(numSegments * 6);
-
-    for (int i = 0; i < numSegments; ++i)
-    {
-        int topL = i * 2;
-        int botL = i * 2 + 1;
-        int topR = (i + 1) * 2;
-        int botR = (i + 1) * 2 + 1;
-
-        // Triangle 1
-        indices.push_back(topL);
-        indices.push_back(topR);
-        indices.push_back(botL);
-
-        // Triangle 2
-        indices.push_back(topR);
-        indices.push_back(botR);
-        indices.push_back(botL);
-    }
+    shapeVertices.clear();
+    shapeIndices.clear();
+    appendEllipseRing(
+        center, {radiusX, radiusY}, {radiusX - thickness, radiusY - thickness}, segments,
+        static_cast<SDL_FColor>(color)
+    );
 
-    if (!SDL_RenderGeometry(
-            rend, nullptr, vertices.data(), static_cast<int>(vertices.size()), indices.data(),
-            static_cast<int>(indices.size())
-        ))
-    {
-        throw std::runtime_error(
-            std::string("Failed to render ellipse outline: ") + SDL_GetError()
-        );
-    }
+    renderShape(
+        shapeVertices.data(), shapeVertices.size(), shapeIndices.data(), shapeIndices.size(),
+        "ellipse outline"
+    );
 }
 
 void _capsuleFilled(const Capsule& capsule, const Color& color, int numSegments)
 {
-    const Vec2 p1 = camera::worldToScreen(capsule.p1);
-    const Vec2 p2 = camera::worldToScreen(capsule.p2);
-
-    const double radius = capsule.radius;
-    const auto fColor = static_cast<SDL_FColor>(color);
-
-    const double angle = atan2(p2.y - p1.y, p2.x - p1.x);
-
-    std::vector<Vec2> points;
-    points.reserve(numSegments + 2);
-
-    // Semicircle around p1
-    for (int i = 0; i <= numSegments / 2; ++i)
-    {
-        double theta = angle + M_PI / 2.0 + (M_PI * i) / (numSegments / 2.0);
-        points.push_back(p1 + Vec2(cos(theta), sin(theta)) * radius);
-    }
-
-    // Semicircle around p2
-    for (int i = 0; i <= numSegments / 2; ++i)
-    {
-        double theta = angle - M_PI / 2.0 + (M_PI * i) / (numSegments / 2.0);
-        points.push_back(p2 + Vec2(cos(theta), sin(theta)) * radius);
-    }
+    const camera::View& view = camera::getView();
+    const Vec2 p1 = view.worldToScreen(capsule.p1);
+    const Vec2 p2 = view.worldToScreen(capsule.p2);
+    const double radius = capsule.radius * view.zoom;
 
-    std::vector<std::vector<Vec2>> polygon = {points};
-    std::vector<uint32_t> indices = mapbox::earcut<uint32_t>(polygon);
+    const int halfSegments = std::max(2, curveSegments(radius, numSegments) / 2);
+    const std::vector<Vec2>& directions = capsuleDirections(p1, p2, halfSegments);
 
-    std::vector<SDL_Vertex> vertices;
-    vertices.reserve(points.size());
-    for (const auto& p : points)
-        vertices.push_back({static_cast<SDL_FPoint>(p), fColor, {}});
+    static std::vector<Vec2> points;
+    points.clear();
+    for (int i = 0; i < static_cast<int>(directions.size()); ++i)
+        points.push_back((i <= halfSegments ? p1 : p2) + directions[i] * radius);
 
-    if (!SDL_RenderGeometry(
-            rend, nullptr, vertices.data(), static_cast<int>(vertices.size()),
-            reinterpret_cast<const int*>(indices.data()), static_cast<int>(indices.size())
-        ))
-    {
-        throw std::runtime_error(
-            std::string("Failed to render capsule geometry: ") + SDL_GetError()
-        );
-    }
+    fillConvex(points, color);
 }
 
 void _capsuleOutline(const Capsule& capsule, const Color& color, double thickness, int numSegments)
 {
-    const Vec2 p1 = camera::worldToScreen(capsule.p1);
-    const Vec2 p2 = camera::worldToScreen(capsule.p2);
+    const camera::View& view = camera::getView();
+    const Vec2 p1 = view.worldToScreen(capsule.p1);
+    const Vec2 p2 = view.worldToScreen(capsule.p2);
 
-    const double rOuter = capsule.radius;
-    const double rInner = capsule.radius - thickness;
+    const double rOuter = capsule.radius * view.zoom;
+    const double rInner = rOuter - thickness;
 
     if (rOuter <= 0.0 || rInner <= 0.0 || thickness <= 0.0)
         return;
 
+    const int halfSegments = std::max(2, curveSegments(rOuter, numSegments) / 2);
+    const std::vector<Vec2>& directions = capsuleDirections(p1, p2, halfSegments);
+    const auto count = static_cast<int>(directions.size());
     const auto fColor = static_cast<SDL_FColor>(color);
 
-    std::vector<SDL_FPoint> outer = _capsulePolyline(p1, p2, rOuter, numSegments);
-    std::vector<SDL_FPoint> inner = _capsulePolyline(p1, p2, rInner, numSegments);
-
-    if (outer.size() < 3 || inner.size() != outer.size())
-        return;
-
-    const auto ensureClosed = [](std::vector<SDL_FPoint>& pts) -> void
-    {
-        if (pts.empty())
-            return;
-        const SDL_FPoint& a = pts.front();
-        const SDL_FPoint& b = pts.back();
-        if (a.x != b.x || a.y != b.y)
-            pts.push_back(a);
-    };
-    ensureClosed(outer);
-    ensureClosed(inner);
-
-    const size_t n = outer.size();
-    if (inner.size() != n || n < 4)
-        return;
+    shapeVertices.clear();
+    shapeIndices.clear();
 
-    std::vector<SDL_Vertex> verts;
-    verts.reserve(n * 2);
-    for (size_t i = 0; i < n; ++i)
+    // Outer and inner vertex for each direction, repeating the first to close the ring
+    for (int i = 0; i <= count; ++i)
     {
-        verts.push_back({outer[i], fColor, {}});
-        verts.push_back({inner[i], fColor, {}});
+        const int d = i % count;
+        const Vec2& end = d <= halfSegments ? p1 : p2;
+        const Vec2& dir = directions[d];
+        shapeVertices.push_back({static_cast<SDL_FPoint>(end + dir * rOuter), fColor, {}});
+        shapeVertices.push_back({static_cast<SDL_FPoint>(end + dir * rInner), fColor, {}});
     }
 
-    std::vector<int> indices;
-    indices.reserve((n - 1) * 6);
-
-    for (size_t i = 0; i < n - 1; ++i)
+    for (int i = 0; i < count; ++i)
     {
-        const int o0 = static_cast<int>(i * 2);
+        const int o0 = i * 2;
         const int i0 = o0 + 1;
-        const int o1 = static_cast<int>((i + 1) * 2);
+        const int o1 = (i + 1) * 2;
         const int i1 = o1 + 1;
 
-        indices.push_back(o0);
-        indices.push_back(o1);
-        indices.push_back(i0);
-        indices.push_back(o1);
-        indices.push_back(i1);
-        indices.push_back(i0);
+        shapeIndices.insert(shapeIndices.end(), {o0, o1, i0, o1, i1, i0});
     }
 
-    if (!SDL_RenderGeometry(
-            rend, nullptr, verts.data(), static_cast<int>(verts.size()), indices.data(),
-            static_cast<int>(indices.size())
-        ))
-    {
-        throw std::runtime_error(
-            std::string("Failed to render capsule outline: ") + SDL_GetError()
-        );
-    }
+    renderShape(
+        shapeVertices.data(), shapeVertices.size(), shapeIndices.data(), shapeIndices.size(),
+        "capsule outline"
+    );
 }
 
 void _thickLine(const Line& line, const Color& color, double thickness)
 {
-    const Vec2 a = line.getA();
-    const Vec2 b = line.getB();
-    Vec2 dir = b - a;
-
-    double len = dir.getLength();
-    if (len < 0.0001)
-        return;
-
-    dir /= len;
-    const Vec2 norm = {-dir.y, dir.x};
-    const Vec2 offset = norm * (thickness * 0.5);
-
-    SDL_Vertex vertices[4];
-    const auto fColor = static_cast<SDL_FColor>(color);
-
-    vertices[0] = {static_cast<SDL_FPoint>(a + offset), fColor, {}};
-    vertices[1] = {static_cast<SDL_FPoint>(a - offset), fColor, {}};
-    vertices[2] = {static_cast<SDL_FPoint>(b + offset), fColor, {}};
-    vertices[3] = {static_cast<SDL_FPoint>(b - offset), fColor, {}};
+    shapeVertices.clear();
+    shapeIndices.clear();
+    appendThickLine(line.getA(), line.getB(), thickness, static_cast<SDL_FColor>(color));
 
-    static constexpr int indices[6] = {0, 1, 2, 2, 1, 3};
-
-    if (!SDL_RenderGeometry(rend, nullptr, vertices, 4, indices, 6))
-        throw std::runtime_error(std::string("Failed to render thick line: ") + SDL_GetError());
+    renderShape(
+        shapeVertices.data(), shapeVertices.size(), shapeIndices.data(), shapeIndices.size(),
+        "thick line"
+    );
 }
 
 Polygon _roundedRectPolygon(const Rect& rect, const std::array<double, 4>& radii)
 {
-    const auto appendArcPoints = [](std::vector<Vec2>& points, const Vec2& center,
-                                    const double radius, const double startAngle,
-                                    const double endAngle, const int segments) -> void
+    const auto [radiusTopLeft, radiusTopRight, radiusBottomRight, radiusBottomLeft] = radii;
+    const double maxRadius = std::
+        max(std::max(radiusTopLeft, radiusTopRight), std::max(radiusBottomRight, radiusBottomLeft));
+
+    // Corners are quarters of one table, sized for the largest corner as it appears on screen
+    const int segments = curveSegments(maxRadius * camera::getView().zoom, 0);
+    const int cornerSegments = segments / 4;
+    const std::vector<Vec2>& unit = unitCircle(segments);
+
+    const auto appendArcPoints = [&unit, cornerSegments](std::vector<Vec2>& points,
+                                                         const Vec2& center, const double radius,
+                                                         const int quarter) -> void
     {
         if (radius <= 0.0)
             return;
 
-        for (int i = 1; i <= segments; ++i)
-        {
-            const double t = static_cast<double>(i) / static_cast<double>(segments);
-            const double angle = startAngle + (endAngle - startAngle) * t;
-            points.push_back(center + Vec2(cos(angle), sin(angle)) * radius);
-        }
+        for (int i = 1; i <= cornerSegments; ++i)
+            points.push_back(center + unit[quarter * cornerSegments + i] * radius);
     };
 
-    const auto [radiusTopLeft, radiusTopRight, radiusBottomRight, radiusBottomLeft] = radii;
-    const double maxRadius = std::
-        max(std::max(radiusTopLeft, radiusTopRight), std::max(radiusBottomRight, radiusBottomLeft));
-    const int cornerSegments =
-        std::max(4, std::min(24, static_cast<int>(std::ceil(maxRadius / 3.0))));
-
     std::vector<Vec2> points;
     points.reserve(static_cast<size_t>(cornerSegments) * 4 + 8);
 
     points.push_back({rect.x + radiusTopLeft, rect.y});
     points.push_back({rect.x + rect.w - radiusTopRight, rect.y});
     appendArcPoints(
-        points, {rect.x + rect.w - radiusTopRight, rect.y + radiusTopRight}, radiusTopRight,
-        -M_PI / 2.0, 0.0, cornerSegments
+        points, {rect.x + rect.w - radiusTopRight, rect.y + radiusTopRight}, radiusTopRight, 3
     );
 
     points.push_back({rect.x + rect.w, rect.y + rect.h - radiusBottomRight});
     appendArcPoints(
         points, {rect.x + rect.w - radiusBottomRight, rect.y + rect.h - radiusBottomRight},
-        radiusBottomRight, 0.0, M_PI / 2.0, cornerSegments
+        radiusBottomRight, 0
     );
 
     points.push_back({rect.x + radiusBottomLeft, rect.y + rect.h});
     appendArcPoints(
-        points, {rect.x + radiusBottomLeft, rect.y + rect.h - radiusBottomLeft}, radiusBottomLeft,
-        M_PI / 2.0, M_PI, cornerSegments
+        points, {rect.x + radiusBottomLeft, rect.y + rect.h - radiusBottomLeft}, radiusBottomLeft, 1
     );
 
     points.push_back({rect.x, rect.y + radiusTopLeft});
-    appendArcPoints(
-        points, {rect.x + radiusTopLeft, rect.y + radiusTopLeft}, radiusTopLeft, M_PI,
-        3.0 * M_PI / 2.0, cornerSegments
-    );
+    appendArcPoints(points, {rect.x + radiusTopLeft, rect.y + radiusTopLeft}, radiusTopLeft, 2);
 
     return Polygon(points);
 }
 
 void _roundedRectOutline(const Rect& rect, const Color& color, const std::array<double, 4>& radii)
 {
-    if (!SDL_SetRenderDrawColor(rend, color.r, color.g, color.b, color.a))
-        throw std::runtime_error("Failed to set draw color: " + std::string(SDL_GetError()));
+    renderer::_flush();
+    renderer::_setDrawColor(color);
 
     const Polygon polygon = _roundedRectPolygon(rect, radii);
     std::vector<SDL_FPoint> points;
-    points.reserve(polygon.points.size() + 1);
-    for (const Vec2& point : polygon.points)
+    points.reserve(polygon.getPoints().size() + 1);
+    for (const Vec2& point : polygon.getPoints())
         points.push_back(static_cast<SDL_FPoint>(point));
 
     if (!points.empty())
@@ -1276,61 +1995,13 @@ void _roundedRectOutline(const Rect& rect, const Color& color, const std::array<
     if (points.empty())
         return;
 
+    renderer::stats::countPrimitives(points.size());
     if (!SDL_RenderLines(rend, points.data(), static_cast<int>(points.size())))
         throw std::runtime_error(
             "Failed to render rounded rectangle: " + std::string(SDL_GetError())
         );
 }
 
-std::vector<SDL_FPoint> _ellipsePolyline(
-    const Vec2& center, const double radiusX, const double radiusY, const int numSegments
-)
-{
-    const int segments = std::max(3, numSegments);
-    std::vector<SDL_FPoint> points;
-    points.reserve(static_cast<size_t>(segments) + 1);
-
-    for (int i = 0; i <= segments; ++i)
-    {
-        const double theta = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(segments);
-        points.push_back(
-            static_cast<SDL_FPoint>(
-                Vec2{center.x + radiusX * cos(theta), center.y + radiusY * sin(theta)}
-            )
-        );
-    }
-
-    return points;
-}
-
-std::vector<SDL_FPoint> _capsulePolyline(
-    const Vec2& p1, const Vec2& p2, const double radius, const int numSegments
-)
-{
-    const int halfSegments = std::max(2, numSegments / 2);
-    const double angle = atan2(p2.y - p1.y, p2.x - p1.x);
-
-    std::vector<SDL_FPoint> points;
-    points.reserve(static_cast<size_t>(halfSegments) * 2 + 3);
-
-    for (int i = 0; i <= halfSegments; ++i)
-    {
-        const double theta = angle + M_PI / 2.0 + (M_PI * i) / static_cast<double>(halfSegments);
-        points.push_back(static_cast<SDL_FPoint>(p1 + Vec2(cos(theta), sin(theta)) * radius));
-    }
-
-    for (int i = 0; i <= halfSegments; ++i)
-    {
-        const double theta = angle - M_PI / 2.0 + (M_PI * i) / static_cast<double>(halfSegments);
-        points.push_back(static_cast<SDL_FPoint>(p2 + Vec2(cos(theta), sin(theta)) * radius));
-    }
-
-    if (!points.empty())
-        points.push_back(points.front());
-
-    return points;
-}
-
 void _init(SDL_Renderer* renderer)
 {
     rend = renderer;
@@ -1376,8 +2047,41 @@ Args:
             }
         );
 
+    nb::enum_<LineJoin>(module, "LineJoin", R"doc(
+How thick strokes meet at the corners of polylines and outlines.
+    )doc")
+        .value("MITER", LineJoin::Miter, "Extend the edges to a sharp point, up to the miter limit")
+        .value("BEVEL", LineJoin::Bevel, "Cut the corner off flat")
+        .value("ROUND", LineJoin::Round, "Round the corner with an arc");
+
+    nb::enum_<LineCap>(module, "LineCap", R"doc(
+How thick open strokes end.
+    )doc")
+        .value("BUTT", LineCap::Butt, "End flat at the end points")
+        .value("SQUARE", LineCap::Square, "End flat, half the thickness past the end points")
+        .value("ROUND", LineCap::Round, "End with a half circle around the end points");
+
     auto subDraw = module.def_submodule("draw", "Functions for drawing shape objects");
 
+    subDraw.def("set_batching_enabled", &setBatchingEnabled, "enabled"_a, R"doc(
+Enable or disable batching of filled and thick shapes.
+
+When enabled, the triangles of consecutive circles, rects, polygons, ellipses, capsules, sectors,
+thick lines and untextured geometry are merged into a single submission. Drawing a sprite, text,
+thin lines or points, or changing render state submits the shapes queued so far, so draw order is
+kept. Enabled by default.
+
+Args:
+    enabled (bool): Whether to batch shapes.
+    )doc");
+
+    subDraw.def("is_batching_enabled", &isBatchingEnabled, R"doc(
+Check whether filled and thick shapes are batched into shared submissions.
+
+Returns:
+    bool: True if batching is enabled.
+    )doc");
+
     subDraw.def("point", &point, "point"_a, "color"_a, R"doc(
 Draw a single point to the renderer.
 
@@ -1420,19 +2124,103 @@ Raises:
     );
 
     subDraw.def(
-        "circle", &circle, "circle"_a, "color"_a, "thickness"_a = 0, "num_segments"_a = 24, R"doc(
+        "circles_from_ndarray", &circlesFromNDArray<double>, "circles"_a, "color"_a,
+        "thickness"_a = 0.0, "num_segments"_a = 0, "colors"_a.none() = nb::none(),
+        nb::call_guard<nb::gil_scoped_release>(), R"doc(
+Batch draw circles from a NumPy array in a single geometry submission.
+
+Args:
+    circles (numpy.ndarray): float32 or float64 array with shape ``(N, 3|4)`` of
+        ``[x, y, radius, (thickness)]`` rows.
+    color (Color): The color of every circle without a per-row color.
+    thickness (float, optional): The line thickness for rows without a thickness column. If <= 0
+        or >= radius, draws filled circles. Defaults to 0 (filled).
+    num_segments (int, optional): Number of segments to approximate each circle. Defaults to 0,
+        which picks a count from each circle's on-screen radius.
+    colors (numpy.ndarray, optional): uint8 array with shape ``(N, 4)`` of per-row RGBA values
+        used instead of color.
+
+Raises:
+    ValueError: If the array does not have 3 or 4 columns, or colors is not ``(N, 4)``.
+    RuntimeError: If circle rendering fails.
+    )doc"
+    );
+
+    subDraw.def(
+        "circles_from_ndarray", &circlesFromNDArray<float>, "circles"_a, "color"_a,
+        "thickness"_a = 0.0, "num_segments"_a = 0, "colors"_a.none() = nb::none(),
+        nb::call_guard<nb::gil_scoped_release>()
+    );
+
+    subDraw.def(
+        "rects_from_ndarray", &rectsFromNDArray<double>, "rects"_a, "color"_a, "thickness"_a = 0.0,
+        "colors"_a.none() = nb::none(), nb::call_guard<nb::gil_scoped_release>(), R"doc(
+Batch draw rectangles from a NumPy array in a single geometry submission.
+
+Outlines are centered on the rectangle edges and joined with mitred corners.
+
+Args:
+    rects (numpy.ndarray): float32 or float64 array with shape ``(N, 4|5)`` of
+        ``[x, y, w, h, (thickness)]`` rows.
+    color (Color): The color of every rectangle without a per-row color.
+    thickness (float, optional): The border thickness for rows without a thickness column. If <= 0
+        or > half the width or height, draws filled rectangles. Defaults to 0 (filled).
+    colors (numpy.ndarray, optional): uint8 array with shape ``(N, 4)`` of per-row RGBA values
+        used instead of color.
+
+Raises:
+    ValueError: If the array does not have 4 or 5 columns, or colors is not ``(N, 4)``.
+    RuntimeError: If rectangle rendering fails.
+    )doc"
+    );
+
+    subDraw.def(
+        "rects_from_ndarray", &rectsFromNDArray<float>, "rects"_a, "color"_a, "thickness"_a = 0.0,
+        "colors"_a.none() = nb::none(), nb::call_guard<nb::gil_scoped_release>()
+    );
+
+    subDraw.def(
+        "lines_from_ndarray", &linesFromNDArray<double>, "lines"_a, "color"_a, "thickness"_a = 1.0,
+        "colors"_a.none() = nb::none(), nb::call_guard<nb::gil_scoped_release>(), R"doc(
+Batch draw line segments from a NumPy array in a single geometry submission.
+
+Every segment is drawn as a quad at least one pixel wide, so thin and thick lines share the
+submission.
+
+Args:
+    lines (numpy.ndarray): float32 or float64 array with shape ``(N, 4|5)`` of
+        ``[x1, y1, x2, y2, (thickness)]`` rows.
+    color (Color): The color of every line without a per-row color.
+    thickness (float, optional): The line thickness in pixels for rows without a thickness
+        column. Defaults to 1.0.
+    colors (numpy.ndarray, optional): uint8 array with shape ``(N, 4)`` of per-row RGBA values
+        used instead of color.
+
+Raises:
+    ValueError: If the array does not have 4 or 5 columns, or colors is not ``(N, 4)``.
+    RuntimeError: If line rendering fails.
+    )doc"
+    );
+
+    subDraw.def(
+        "lines_from_ndarray", &linesFromNDArray<float>, "lines"_a, "color"_a, "thickness"_a = 1.0,
+        "colors"_a.none() = nb::none(), nb::call_guard<nb::gil_scoped_release>()
+    );
+
+    subDraw.def(
+        "circle", &circle, "circle"_a, "color"_a, "thickness"_a = 0, "num_segments"_a = 0, R"doc(
 Draw a circle to the renderer.
 
 Args:
     circle (Circle): The circle to draw.
     color (Color): The color of the circle.
     thickness (float, optional): The line thickness. If <= 0 or >= radius, draws filled circle. Defaults to 0 (filled).
-    num_segments (int, optional): Number of segments to approximate the circle. Higher values yield smoother circles. Defaults to 24.
+    num_segments (int, optional): Number of segments to approximate the circle. Defaults to 0, which picks a count from the on-screen radius.
     )doc"
     );
 
     subDraw.def(
-        "circles", &circles, "circles"_a, "color"_a, "thickness"_a = 0, "num_segments"_a = 24,
+        "circles", &circles, "circles"_a, "color"_a, "thickness"_a = 0, "num_segments"_a = 0,
         R"doc(
 Draw an array of circles in bulk to the renderer.
 
@@ -1440,12 +2228,12 @@ Args:
     circles (Sequence[Circle]): The circles to draw in bulk.
     color (Color): The color of the circles.
     thickness (float, optional): The line thickness. If <= 0 or >= radius, draws filled circle. Defaults to 0 (filled).
-    num_segments (int, optional): Number of segments to approximate each circle. Higher values yield smoother circles. Defaults to 24.
+    num_segments (int, optional): Number of segments to approximate each circle. Defaults to 0, which picks a count from the on-screen radius.
     )doc"
     );
 
     subDraw.def(
-        "capsule", &capsule, "capsule"_a, "color"_a, "thickness"_a = 0, "num_segments"_a = 24,
+        "capsule", &capsule, "capsule"_a, "color"_a, "thickness"_a = 0, "num_segments"_a = 0,
         R"doc(
 Draw a capsule to the renderer.
 
@@ -1453,12 +2241,12 @@ Args:
     capsule (Capsule): The capsule to draw.
     color (Color): The color of the capsule.
     thickness (float, optional): The line thickness. If <= 0 or >= radius, draws filled capsule. Defaults to 0 (filled).
-    num_segments (int, optional): Number of segments to approximate the capsule ends. Higher values yield smoother capsules. Defaults to 24.
+    num_segments (int, optional): Number of segments to approximate the capsule ends. Defaults to 0, which picks a count from the on-screen radius.
     )doc"
     );
 
     subDraw.def(
-        "capsules", &capsules, "capsules"_a, "color"_a, "thickness"_a = 0, "num_segments"_a = 24,
+        "capsules", &capsules, "capsules"_a, "color"_a, "thickness"_a = 0, "num_segments"_a = 0,
         R"doc(
 Draw an array of capsules in bulk to the renderer.
 
@@ -1466,12 +2254,12 @@ Args:
     capsules (Sequence[Capsule]): The capsules to draw in bulk.
     color (Color): The color of the capsules.
     thickness (float, optional): The line thickness. If <= 0 or >= radius, draws filled capsules. Defaults to 0 (filled).
-    num_segments (int, optional): Number of segments to approximate each capsule end. Higher values yield smoother capsules. Defaults to 24.
+    num_segments (int, optional): Number of segments to approximate each capsule end. Defaults to 0, which picks a count from the on-screen radius.
     )doc"
     );
 
     subDraw.def(
-        "ellipse", &ellipse, "bounds"_a, "color"_a, "thickness"_a = 0.0, "num_segments"_a = 24,
+        "ellipse", &ellipse, "bounds"_a, "color"_a, "thickness"_a = 0.0, "num_segments"_a = 0,
         R"doc(
 Draw an ellipse to the renderer.
 
@@ -1479,12 +2267,12 @@ Args:
     bounds (Rect): The bounding box of the ellipse.
     color (Color): The color of the ellipse.
     thickness (float, optional): The line thickness. If <= 0 or >= radius, draws filled ellipse. Defaults to 0 (filled).
-    num_segments (int, optional): Number of segments to approximate the ellipse. Higher values yield smoother ellipses. Defaults to 24.
+    num_segments (int, optional): Number of segments to approximate the ellipse. Defaults to 0, which picks a count from the on-screen size.
     )doc"
     );
 
     subDraw.def(
-        "ellipses", &ellipses, "bounds"_a, "color"_a, "thickness"_a = 0.0, "num_segments"_a = 24,
+        "ellipses", &ellipses, "bounds"_a, "color"_a, "thickness"_a = 0.0, "num_segments"_a = 0,
         R"doc(
 Draw an array of ellipses in bulk to the renderer.
 
@@ -1492,7 +2280,7 @@ Args:
     bounds (Sequence[Rect]): The bounding boxes of the ellipses to draw in bulk.
     color (Color): The color of the ellipses.
     thickness (float, optional): The line thickness. If <= 0 or >= radius, draws filled ellipses. Defaults to 0 (filled).
-    num_segments (int, optional): Number of segments to approximate each ellipse. Higher values yield smoother ellipses. Defaults to 24.
+    num_segments (int, optional): Number of segments to approximate each ellipse. Defaults to 0, which picks a count from the on-screen size.
     )doc"
     );
 
@@ -1559,7 +2347,8 @@ Args:
     );
 
     subDraw.def(
-        "polygon", &polygon, "polygon"_a, "color"_a, "filled"_a = true,
+        "polygon", &polygon, "polygon"_a, "color"_a, "filled"_a = true, "thickness"_a = 1.0,
+        "join"_a = LineJoin::Miter,
         R"doc(
 Draw a polygon to the renderer.
 
@@ -1567,11 +2356,14 @@ Args:
     polygon (Polygon): The polygon to draw.
     color (Color): The color of the polygon.
     filled (bool, optional): Whether to draw a filled polygon or just the outline. Defaults to True.
+    thickness (float, optional): The outline thickness in pixels. Defaults to 1.0.
+    join (LineJoin, optional): How thick outline edges meet at the corners. Miter joins sharper than a miter limit of 4 are beveled. Defaults to LineJoin.MITER.
     )doc"
     );
 
     subDraw.def(
-        "polygons", &polygons, "polygons"_a, "color"_a, "filled"_a = true,
+        "polygons", &polygons, "polygons"_a, "color"_a, "filled"_a = true, "thickness"_a = 1.0,
+        "join"_a = LineJoin::Miter,
         R"doc(
 Draw an array of polygons in bulk to the renderer.
 
@@ -1579,6 +2371,8 @@ Args:
     polygons (Sequence[Polygon]): The polygons to draw in bulk.
     color (Color): The color of the polygons.
     filled (bool, optional): Whether to draw filled polygons or just the outlines. Defaults to True (filled).
+    thickness (float, optional): The outline thickness in pixels. Defaults to 1.0.
+    join (LineJoin, optional): How thick outline edges meet at the corners. Defaults to LineJoin.MITER.
     )doc"
     );
 
@@ -1592,25 +2386,125 @@ Args:
     vertices (Sequence[Vertex]): A list of Vertex objects.
     indices (Sequence[int] | None): A list of indices defining the primitives.
                                    If None or empty, vertices are drawn sequentially.
+
+Raises:
+    ValueError: If an index of untextured geometry is outside the vertex list.
         )doc"
     );
 
+    subDraw.def(
+        "geometry_from_ndarray", &geometryFromNDArray, "texture"_a.none(), "positions"_a,
+        "colors"_a.none() = nb::none(), "tex_coords"_a.none() = nb::none(),
+        "indices"_a.none() = nb::none(), "color"_a = Color::WHITE, "world_space"_a = true,
+        nb::call_guard<nb::gil_scoped_release>(), R"doc(
+Draw geometry from float32 arrays, which the renderer reads in place without building vertices.
+
+Any object with the buffer protocol works. Columns sliced from one interleaved array, such as
+data[:, 0:2] and data[:, 2:6], are read through their row stride without a copy.
+
+Args:
+    texture (Texture | None): The texture to apply to the geometry. Can be None.
+    positions (ndarray): Float32 array of shape (N, 2) with the vertex positions.
+    colors (ndarray, optional): Float32 array of shape (N, 4) with RGBA values from 0 to 1.
+        Defaults to None, which uses color for every vertex.
+    tex_coords (ndarray, optional): Float32 array of shape (N, 2). Required with a texture.
+    indices (ndarray, optional): Int32 array of triangle indices. Defaults to None, which draws
+        the vertices as sequential triangles.
+    color (Color, optional): Color of every vertex when colors is None. Defaults to white.
+    world_space (bool, optional): Whether positions are moved through the active camera. Only
+        this case copies the positions. Defaults to True.
+
+Raises:
+    ValueError: If an array has the wrong shape, or a texture is given without tex_coords.
+    RuntimeError: If the geometry cannot be drawn.
+    )doc"
+    );
+
+    nb::class_<Mesh>(subDraw, "Mesh", R"doc(
+Float32 vertex data kept between frames for geometry drawn every frame.
+
+The data is copied once when it is set, in the layout the renderer reads, so drawing the mesh
+copies nothing unless the active camera has to move its positions.
+    )doc")
+        .def(
+            "__init__",
+            [](Mesh* self, const VertexArray& positions, const VertexArray& colors,
+               const VertexArray& texCoords, const IndexArray& indices, const Color& color) -> void
+            {
+                new (self) Mesh();
+                self->color = color;
+                setMeshData(*self, positions, colors, texCoords, indices);
+            },
+            "positions"_a, "colors"_a.none() = nb::none(), "tex_coords"_a.none() = nb::none(),
+            "indices"_a.none() = nb::none(), "color"_a = Color::WHITE, R"doc(
+Create a mesh from float32 arrays.
+
+Args:
+    positions (ndarray): Float32 array of shape (N, 2) with the vertex positions.
+    colors (ndarray, optional): Float32 array of shape (N, 4) with RGBA values from 0 to 1.
+        Defaults to None, which uses color for every vertex.
+    tex_coords (ndarray, optional): Float32 array of shape (N, 2). Required to draw with a texture.
+    indices (ndarray, optional): Int32 array of triangle indices. Defaults to None, which draws
+        the vertices as sequential triangles.
+    color (Color, optional): Color of every vertex when there are no colors. Defaults to white.
+
+Raises:
+    ValueError: If an array has the wrong shape.
+            )doc"
+        )
+        .def(
+            "set_data", &setMeshData, "positions"_a, "colors"_a.none() = nb::none(),
+            "tex_coords"_a.none() = nb::none(), "indices"_a.none() = nb::none(), R"doc(
+Replace the mesh data, with the same arguments as the constructor.
+
+Raises:
+    ValueError: If an array has the wrong shape.
+            )doc"
+        )
+        .def_rw("color", &Mesh::color, R"doc(
+Color of every vertex when the mesh has no per-vertex colors.
+        )doc")
+        .def_prop_ro("vertex_count", &Mesh::getVertexCount, R"doc(
+The number of vertices in the mesh.
+        )doc");
+
+    subDraw.def(
+        "mesh", &mesh, "mesh"_a, "texture"_a.none() = nb::none(), "world_space"_a = true,
+        R"doc(
+Draw a mesh.
+
+Args:
+    mesh (Mesh): The mesh to draw.
+    texture (Texture | None, optional): The texture to apply. Defaults to None.
+    world_space (bool, optional): Whether positions are moved through the active camera.
+        Defaults to True.
+
+Raises:
+    ValueError: If the mesh has a texture but no tex_coords, or its arrays disagree in length.
+        An untextured mesh also raises it for an index outside its vertices.
+    RuntimeError: If the mesh cannot be drawn.
+    )doc"
+    );
+
     subDraw.def(
         "bezier", &bezier, "control_points"_a, "color"_a, "thickness"_a = 1.0,
-        "num_segments"_a = 24, R"doc(
+        "num_segments"_a = 24, "cap"_a = LineCap::Butt, R"doc(
 Draw a Bezier curve with 3 or 4 control points.
 
+Thick curves are stroked as one mesh with mitered joins between segments.
+
 Args:
     control_points (Sequence[Vec2]): The control points (3 for quadratic, 4 for cubic).
     color (Color): The color of the curve.
     thickness (float, optional): The line thickness. Defaults to 1.0.
     num_segments (int, optional): Number of segments to approximate the curve. Defaults to 24.
+    cap (LineCap, optional): How a thick curve ends. Defaults to LineCap.BUTT.
     )doc"
     );
 
     subDraw.def(
         "sector", &sector, "circle"_a, "start_angle"_a, "end_angle"_a, "color"_a,
-        "thickness"_a = 0.0, "num_segments"_a = 24,
+        "thickness"_a = 0.0, "num_segments"_a = 0,
         R"doc(
 Draw a circular sector or arc.
 
@@ -1620,20 +2514,28 @@ Args:
     end_angle (float): The end angle in radians.
     color (Color): The color of the sector.
     thickness (float, optional): The line thickness. If <= 0 or >= radius, draws filled sector. Defaults to 0 (filled).
-    num_segments (int, optional): Number of segments to approximate the arc. Defaults to 24.
+    num_segments (int, optional): Number of segments to approximate the arc. Defaults to 0, which picks a count from the on-screen radius and the arc length.
     )doc"
     );
 
     subDraw.def(
         "polyline", &polyline, "points"_a, "color"_a, "thickness"_a = 1.0, "closed"_a = false,
+        "join"_a = LineJoin::Miter, "cap"_a = LineCap::Butt, "miter_limit"_a = 4.0,
         R"doc(
 Draw connected line segments through a sequence of points.
 
+Thick polylines are stroked as one mesh and submitted once, with segments sharing vertices at the
+joins so translucent lines have no gaps or overlaps there.
+
 Args:
     points (Sequence[Vec2]): The vertices of the polyline (must have at least 2).
     color (Color): The color of the polyline.
     thickness (float, optional): The line thickness in pixels. Defaults to 1.0.
     closed (bool, optional): If True, connects the last point back to the first. Defaults to False.
+    join (LineJoin, optional): How thick segments meet. Defaults to LineJoin.MITER.
+    cap (LineCap, optional): How the ends of a thick open polyline look. Defaults to LineCap.BUTT.
+    miter_limit (float, optional): Longest miter, as a multiple of the thickness, before a miter
+        join is beveled instead. Defaults to 4.0.
     )doc"
     );
 }
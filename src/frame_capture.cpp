@@ -0,0 +1,245 @@
+#include "FrameCapture.hpp"
+
+#include <SDL3_image/SDL_image.h>
+
+#ifdef KRAKEN_ENABLE_PYTHON
+#include <nanobind/stl/filesystem.h>
+#endif  // KRAKEN_ENABLE_PYTHON
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+#include "Log.hpp"
+#include "Renderer.hpp"
+
+namespace kn::renderer
+{
+FrameCapture::FrameCapture(const size_t slotCount, const bool dropWhenFull)
+    : m_dropWhenFull(dropWhenFull)
+{
+    if (slotCount == 0)
+        throw std::invalid_argument("Frame capture needs at least one slot");
+
+    m_slots.resize(slotCount);
+    m_writer = std::thread(&FrameCapture::_writerLoop, this);
+}
+
+FrameCapture::~FrameCapture()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_queued.notify_one();
+    m_writer.join();
+
+    if (!m_error.empty())
+        log::warn("Frame capture: {}", m_error);
+}
+
+bool FrameCapture::capture(const std::filesystem::path& filePath, const Rect& src)
+{
+    _throwPendingError();
+
+    if (src.w < 0.0 || src.h < 0.0)
+        throw std::invalid_argument("Source rectangle must have positive width and height");
+
+    std::string extension = filePath.extension().string();
+    std::transform(
+        extension.begin(), extension.end(), extension.begin(),
+        [](const unsigned char c) { return static_cast<char>(std::tolower(c)); }
+    );
+
+    Format format;
+    if (extension == ".png")
+        format = Format::PNG;
+    else if (extension == ".bmp")
+        format = Format::BMP;
+    else
+        throw std::invalid_argument("Unsupported capture format, use a .png or .bmp path");
+
+    // Wait for a slot before reading back, so a dropped frame costs nothing
+    {
+        std::unique_lock lock(m_mutex);
+        if (m_count == m_slots.size())
+        {
+            if (m_dropWhenFull)
+            {
+                ++m_dropped;
+                return false;
+            }
+            m_freed.wait(lock, [this] { return m_count < m_slots.size(); });
+        }
+    }
+
+    _flush();
+
+    const auto sdlRect = static_cast<SDL_Rect>(src);
+    const bool hasSize = (src.w > 0.0 && src.h > 0.0);
+
+    SDL_Surface* surface = SDL_RenderReadPixels(_get(), hasSize ? &sdlRect : nullptr);
+    if (!surface)
+        throw std::runtime_error("Failed to read pixels: " + std::string(SDL_GetError()));
+
+    // Only this thread queues frames, so the slot found free above is still free
+    {
+        std::lock_guard lock(m_mutex);
+        Slot& slot = m_slots[(m_head + m_count) % m_slots.size()];
+        slot.surface = surface;
+        slot.path = filePath.string();
+        slot.format = format;
+        ++m_count;
+    }
+    m_queued.notify_one();
+
+    return true;
+}
+
+void FrameCapture::wait()
+{
+    {
+        std::unique_lock lock(m_mutex);
+        m_freed.wait(lock, [this] { return m_count == 0; });
+    }
+
+    _throwPendingError();
+}
+
+size_t FrameCapture::getPendingCount() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_count;
+}
+
+size_t FrameCapture::getWrittenCount() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_written;
+}
+
+size_t FrameCapture::getDroppedCount() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_dropped;
+}
+
+size_t FrameCapture::getSlotCount() const
+{
+    return m_slots.size();
+}
+
+void FrameCapture::_writerLoop()
+{
+    std::unique_lock lock(m_mutex);
+    while (true)
+    {
+        m_queued.wait(lock, [this] { return m_stopping || m_count > 0; });
+
+        // Queued frames are still written when stopping
+        if (m_count == 0)
+            return;
+
+        // The head slot is not touched by capture() until it is released below
+        Slot& slot = m_slots[m_head];
+        lock.unlock();
+
+        const bool saved = slot.format == Format::PNG
+                               ? IMG_SavePNG(slot.surface, slot.path.c_str())
+                               : SDL_SaveBMP(slot.surface, slot.path.c_str());
+        const std::string error =
+            saved ? std::string() : "Failed to write " + slot.path + ": " + SDL_GetError();
+
+        SDL_DestroySurface(slot.surface);
+        slot.surface = nullptr;
+
+        lock.lock();
+        if (saved)
+            ++m_written;
+        else if (m_error.empty())
+            m_error = error;
+
+        m_head = (m_head + 1) % m_slots.size();
+        --m_count;
+        m_freed.notify_all();
+    }
+}
+
+void FrameCapture::_throwPendingError()
+{
+    std::string error;
+    {
+        std::lock_guard lock(m_mutex);
+        error.swap(m_error);
+    }
+
+    if (!error.empty())
+        throw std::runtime_error(error);
+}
+
+#ifdef KRAKEN_ENABLE_PYTHON
+void _bindFrameCapture(nb::module_& subRenderer)
+{
+    using namespace nb::literals;
+
+    nb::class_<FrameCapture>(subRenderer, "FrameCapture", R"doc(
+Captures the current render target to image files on a background thread.
+
+Each capture reads the render target on the calling thread, then hands the pixels to a writer
+thread that encodes and saves them. Frames wait in a fixed number of slots, so memory stays
+bounded when the writer falls behind. Works with every backend, including
+RenderBackend.SOFTWARE for headless capture.
+
+Capture after drawing and before present(), as the back buffer is undefined after presenting.
+    )doc")
+        .def(
+            nb::init<size_t, bool>(), "slot_count"_a = 4, "drop_when_full"_a = false, R"doc(
+Create a frame capture with its own writer thread.
+
+Args:
+    slot_count (int, optional): Frames that can wait for the writer at once. Defaults to 4.
+    drop_when_full (bool, optional): Skip frames while every slot is taken instead of waiting
+        for the writer. Defaults to False.
+
+Raises:
+    ValueError: If slot_count is 0.
+            )doc"
+        )
+        .def(
+            "capture", &FrameCapture::capture, nb::call_guard<nb::gil_scoped_release>(),
+            "file_path"_a, "src"_a = Rect{}, R"doc(
+Read the current render target and queue it to be written.
+
+Args:
+    file_path (str | PathLike): Destination file. The format follows the extension, .png or .bmp.
+    src (Rect, optional): Area to capture. Defaults to the whole render target.
+
+Returns:
+    bool: False if the frame was dropped because every slot was taken.
+
+Raises:
+    ValueError: If the extension is not supported or src has a negative size.
+    RuntimeError: If reading the pixels fails, or an earlier frame failed to be written.
+            )doc"
+        )
+        .def("wait", &FrameCapture::wait, nb::call_guard<nb::gil_scoped_release>(), R"doc(
+Block until every queued frame has been written.
+
+Raises:
+    RuntimeError: If a queued frame failed to be written.
+        )doc")
+        .def_prop_ro("pending", &FrameCapture::getPendingCount, R"doc(
+The number of frames waiting to be written, including the one being written.
+        )doc")
+        .def_prop_ro("written", &FrameCapture::getWrittenCount, R"doc(
+The number of frames written so far.
+        )doc")
+        .def_prop_ro("dropped", &FrameCapture::getDroppedCount, R"doc(
+The number of frames skipped because every slot was taken.
+        )doc")
+        .def_prop_ro("slot_count", &FrameCapture::getSlotCount, R"doc(
+The number of frames that can wait for the writer at once.
+        )doc");
+}
+#endif  // KRAKEN_ENABLE_PYTHON
+}  // namespace kn::renderer
@@ -1,6 +1,5 @@
 #include "physics/bodies/Body.hpp"
 
-#include "../../mapbox/earcut.hpp"
 #include "Capsule.hpp"
 #include "Circle.hpp"
 #include "Polygon.hpp"
@@ -50,7 +49,8 @@ void Body::addCollider(
 )
 {
     _checkValid();
-    const size_t numPoints = polygon.points.size();
+    const std::vector<Vec2>& points = polygon.getPoints();
+    const size_t numPoints = points.size();
     if (numPoints < 3)
         throw std::runtime_error("Polygon must have at least 3 points");
 
@@ -58,7 +58,7 @@ void Body::addCollider(
     {
         std::vector<b2Vec2> b2Points;
         b2Points.reserve(numPoints);
-        for (const auto& p : polygon.points)
+        for (const auto& p : points)
             b2Points.push_back(static_cast<b2Vec2>(p));
 
         b2Hull hull = b2ComputeHull(b2Points.data(), static_cast<int>(numPoints));
@@ -76,16 +76,15 @@ void Body::addCollider(
     }
     else
     {
-        // Concave: triangulate using earcut
-        const std::vector<std::vector<Vec2>> vertList = {polygon.points};
-        const auto indices = mapbox::earcut<uint32_t>(vertList);
+        // Concave: split into the polygon's cached triangles
+        const std::vector<uint32_t>& indices = polygon.getTriangles();
 
         for (size_t i = 0; i < indices.size(); i += 3)
         {
             b2Vec2 triangle[3];
-            triangle[0] = static_cast<b2Vec2>(polygon.points[indices[i]]);
-            triangle[1] = static_cast<b2Vec2>(polygon.points[indices[i + 1]]);
-            triangle[2] = static_cast<b2Vec2>(polygon.points[indices[i + 2]]);
+            triangle[0] = static_cast<b2Vec2>(points[indices[i]]);
+            triangle[1] = static_cast<b2Vec2>(points[indices[i + 1]]);
+            triangle[2] = static_cast<b2Vec2>(points[indices[i + 2]]);
 
             b2Hull hull = b2ComputeHull(triangle, 3);
             b2Polygon poly = b2MakePolygon(&hull, 0.f);
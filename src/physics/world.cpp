@@ -105,7 +105,7 @@ static void _drawCircle(b2Vec2 center, float radius, b2HexColor color, void* con
 
     draw::circle(
         Circle{{center.x, center.y}, std::max(radius, 1.0f)}, _resolveDebugColor(color, context),
-        1.0, 24
+        1.0
     );
 }
 
@@ -116,7 +116,7 @@ static void _drawSolidCircle(b2Transform transform, float radius, b2HexColor col
 
     draw::circle(
         Circle{{transform.p.x, transform.p.y}, std::max(radius, 1.0f)},
-        _resolveDebugColor(color, context), _drawFilled(context) ? 0.0 : 1.0, 24
+        _resolveDebugColor(color, context), _drawFilled(context) ? 0.0 : 1.0
     );
 }
 
@@ -127,7 +127,7 @@ static void _drawSolidCapsule(b2Vec2 p1, b2Vec2 p2, float radius, b2HexColor col
 
     draw::capsule(
         Capsule{{p1.x, p1.y}, {p2.x, p2.y}, std::max(radius, 1.0f)},
-        _resolveDebugColor(color, context), _drawFilled(context) ? 0.0 : 1.0, 24
+        _resolveDebugColor(color, context), _drawFilled(context) ? 0.0 : 1.0
     );
 }
 
@@ -594,12 +594,13 @@ std::vector<CastHit> World::shapeCast(
 )
 {
     _checkValid();
-    if (polygon.points.size() < 3)
+    const std::vector<Vec2>& points = polygon.getPoints();
+    if (points.size() < 3)
         return {};
 
     std::vector<b2Vec2> b2Points;
-    b2Points.reserve(polygon.points.size());
-    for (const auto& p : polygon.points)
+    b2Points.reserve(points.size());
+    for (const auto& p : points)
         b2Points.push_back(static_cast<b2Vec2>(p));
 
     b2Hull hull = b2ComputeHull(b2Points.data(), static_cast<int>(b2Points.size()));
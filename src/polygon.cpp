@@ -7,10 +7,12 @@
 
 #include <cmath>
 #include <limits>
+#include <stdexcept>
 
 #include "Math.hpp"
 #include "Rect.hpp"
 #include "_globals.hpp"
+#include "mapbox/earcut.hpp"
 
 #ifndef M_PI
 #define M_PI 3.1415926535897932384626433832795
@@ -19,7 +21,7 @@
 namespace kn
 {
 Polygon::Polygon(const std::vector<Vec2>& points)
-    : points(points)
+    : m_points(points)
 {
 }
 
@@ -28,12 +30,12 @@ Polygon::Polygon(const uint32_t n, const double radius, const Vec2& centroid)
     if (n == 0)
         return;
 
-    points.reserve(n);
+    m_points.reserve(n);
     const double angleStep = 2.0 * M_PI / n;
     for (uint32_t i = 0; i < n; ++i)
     {
         const double angle = i * angleStep;
-        points.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+        m_points.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
     }
 
     setCentroid(centroid);
@@ -41,19 +43,19 @@ Polygon::Polygon(const uint32_t n, const double radius, const Vec2& centroid)
 
 Polygon Polygon::copy() const
 {
-    return Polygon{points};
+    return *this;
 }
 
 double Polygon::getPerimeter() const
 {
-    if (points.size() < 2)
+    if (m_points.size() < 2)
         return 0.0;
 
     double distance = 0.0;
-    for (size_t i = 0; i < points.size(); ++i)
+    for (size_t i = 0; i < m_points.size(); ++i)
     {
-        const Vec2& current = points[i];
-        const Vec2& next = points[(i + 1) % points.size()];
+        const Vec2& current = m_points[i];
+        const Vec2& next = m_points[(i + 1) % m_points.size()];
         distance += current.distanceTo(next);
     }
 
@@ -62,14 +64,14 @@ double Polygon::getPerimeter() const
 
 double Polygon::getArea() const
 {
-    if (points.size() < 3)
+    if (m_points.size() < 3)
         return 0.0;
 
     double sum = 0.0;
-    for (size_t i = 0; i < points.size(); ++i)
+    for (size_t i = 0; i < m_points.size(); ++i)
     {
-        const Vec2& current = points[i];
-        const Vec2& next = points[(i + 1) % points.size()];
+        const Vec2& current = m_points[i];
+        const Vec2& next = m_points[(i + 1) % m_points.size()];
         sum += math::cross(current, next);
     }
 
@@ -78,22 +80,22 @@ double Polygon::getArea() const
 
 Vec2 Polygon::getCentroid() const
 {
-    if (points.empty())
+    if (m_points.empty())
         return {};
-    const size_t n = points.size();
+    const size_t n = m_points.size();
 
     if (n == 1)
-        return points[0];
+        return m_points[0];
     if (n == 2)
-        return {(points[0].x + points[1].x) * 0.5, (points[0].y + points[1].y) * 0.5};
+        return {(m_points[0].x + m_points[1].x) * 0.5, (m_points[0].y + m_points[1].y) * 0.5};
 
     Vec2 centroid{0.0, 0.0};
     double signedArea = 0.0;
 
     for (size_t i = 0; i < n; ++i)
     {
-        const Vec2& current = points[i];
-        const Vec2& next = points[(i + 1) % n];
+        const Vec2& current = m_points[i];
+        const Vec2& next = m_points[(i + 1) % n];
         const double cross = math::cross(current, next);
         signedArea += cross;
         centroid += (current + next) * cross;
@@ -103,7 +105,7 @@ Vec2 Polygon::getCentroid() const
     if (std::abs(signedArea) < 1e-10)
     {
         Vec2 sum{0.0, 0.0};
-        for (const auto& point : points)
+        for (const auto& point : m_points)
             sum += point;
         return sum / n;
     }
@@ -121,18 +123,18 @@ void Polygon::setCentroid(const Vec2& centroid)
 
 bool Polygon::isConvex() const
 {
-    if (points.size() < 3)
+    if (m_points.size() < 3)
         return false;
 
     bool initialized = false;
     bool positive = false;
-    const size_t n = points.size();
+    const size_t n = m_points.size();
 
     for (size_t i = 0; i < n; ++i)
     {
-        const Vec2& p1 = points[i];
-        const Vec2& p2 = points[(i + 1) % n];
-        const Vec2& p3 = points[(i + 2) % n];
+        const Vec2& p1 = m_points[i];
+        const Vec2& p2 = m_points[(i + 1) % n];
+        const Vec2& p3 = m_points[(i + 2) % n];
 
         double cp = math::cross(p2 - p1, p3 - p2);
         if (std::abs(cp) > 1e-10)  // Ignore very small cross products
@@ -159,7 +161,7 @@ bool Polygon::isConcave() const
 
 Rect Polygon::getRect() const
 {
-    if (points.empty())
+    if (m_points.empty())
         return {};
 
     double minX = std::numeric_limits<double>::max();
@@ -167,7 +169,7 @@ Rect Polygon::getRect() const
     double maxX = std::numeric_limits<double>::lowest();
     double maxY = std::numeric_limits<double>::lowest();
 
-    for (const auto& point : points)
+    for (const auto& point : m_points)
     {
         minX = std::min(minX, point.x);
         minY = std::min(minY, point.y);
@@ -181,7 +183,7 @@ Rect Polygon::getRect() const
 void Polygon::rotate(double angle)
 {
     const Vec2 absPivot = getCentroid();
-    for (auto& point : points)
+    for (auto& point : m_points)
         point = absPivot + (point - absPivot).rotated(angle);
 }
 
@@ -194,7 +196,7 @@ Polygon Polygon::rotated(double angle) const
 
 void Polygon::move(const Vec2& offset)
 {
-    for (auto& point : points)
+    for (auto& point : m_points)
         point += offset;
 }
 
@@ -208,14 +210,14 @@ Polygon Polygon::moved(const Vec2& offset) const
 void Polygon::scaleBy(double factor)
 {
     const Vec2 absPivot = getCentroid();
-    for (auto& point : points)
+    for (auto& point : m_points)
         point = absPivot + (point - absPivot) * factor;
 }
 
 void Polygon::scaleBy(const Vec2& factor)
 {
     const Vec2 absPivot = getCentroid();
-    for (auto& point : points)
+    for (auto& point : m_points)
         point = absPivot + (point - absPivot) * factor;
 }
 
@@ -233,6 +235,41 @@ Polygon Polygon::scaledBy(const Vec2& factor) const
     return p;
 }
 
+const std::vector<Vec2>& Polygon::getPoints() const
+{
+    return m_points;
+}
+
+void Polygon::setPoints(const std::vector<Vec2>& newPoints)
+{
+    m_points = newPoints;
+    m_triangles = nullptr;
+}
+
+void Polygon::setPoint(const size_t index, const Vec2& point)
+{
+    if (index >= m_points.size())
+        throw std::out_of_range("Polygon point index out of range");
+
+    m_points[index] = point;
+    m_triangles = nullptr;
+}
+
+const std::vector<uint32_t>& Polygon::getTriangles() const
+{
+    if (m_triangles)
+        return *m_triangles;
+
+    const std::vector<std::vector<Vec2>> rings{m_points};
+    m_triangles = std::make_shared<const std::vector<uint32_t>>(mapbox::earcut<uint32_t>(rings));
+    return *m_triangles;
+}
+
+void Polygon::invalidateTriangles()
+{
+    m_triangles = nullptr;
+}
+
 #ifdef KRAKEN_ENABLE_PYTHON
 namespace polygon
 {
@@ -267,8 +304,23 @@ Args:
         )doc"
         )
 
-        .def_rw("points", &Polygon::points, R"doc(
+        .def_prop_rw(
+            "points", &Polygon::getPoints, &Polygon::setPoints, R"doc(
 The list of Vec2 points that define the polygon vertices.
+
+Returns a copy, so assign a new list or set a single point by index to change them. Either
+drops the cached triangulation used for filled drawing.
+            )doc"
+        )
+        .def_prop_ro(
+            "triangles", [](const Polygon& polygon) { return polygon.getTriangles(); }, R"doc(
+Triangle indices into points, three per triangle, as used to draw the filled polygon.
+
+Computed on first use and kept while the polygon is rotated, moved or scaled.
+            )doc"
+        )
+        .def("invalidate_triangles", &Polygon::invalidateTriangles, R"doc(
+Drop the cached triangulation, so the next fill or triangles access computes it again.
         )doc")
         .def_prop_rw("centroid", &Polygon::getCentroid, &Polygon::setCentroid, R"doc(
 Get or set the centroid of the polygon.
@@ -382,8 +434,9 @@ Returns:
             "__iter__",
             [](const Polygon& polygon) -> nb::iterator
             {
+                const std::vector<Vec2>& points = polygon.getPoints();
                 return nb::make_iterator(
-                    nb::type<Polygon>(), "iterator", polygon.points.begin(), polygon.points.end()
+                    nb::type<Polygon>(), "iterator", points.begin(), points.end()
                 );
             },
             nb::keep_alive<0, 1>()
@@ -392,13 +445,25 @@ Returns:
             "__getitem__",
             [](const Polygon& polygon, const size_t i) -> Vec2
             {
-                if (i >= polygon.points.size())
+                if (i >= polygon.getPoints().size())
                     throw nb::index_error("Index out of range");
-                return polygon.points[i];
+                return polygon.getPoints()[i];
             },
             "index"_a
         )
-        .def("__len__", [](const Polygon& polygon) -> size_t { return polygon.points.size(); });
+        .def(
+            "__setitem__",
+            [](Polygon& polygon, const size_t i, const Vec2& point)
+            {
+                if (i >= polygon.getPoints().size())
+                    throw nb::index_error("Index out of range");
+                polygon.setPoint(i, point);
+            },
+            "index"_a, "point"_a
+        )
+        .def(
+            "__len__", [](const Polygon& polygon) -> size_t { return polygon.getPoints().size(); }
+        );
 }
 }  // namespace polygon
 #endif  // KRAKEN_ENABLE_PYTHON
@@ -30,6 +30,7 @@ Tear down the Kraken engine subsystems.
     kn::rect::_bind(m);
     kn::pixel_array::_bind(m);
     kn::texture::_bind(m);
+    kn::texture_atlas::_bind(m);
     kn::polygon::_bind(m);
     kn::camera::_bind(m);
     kn::line::_bind(m);
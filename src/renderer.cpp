@@ -6,13 +6,24 @@
 #include <nanobind/stl/vector.h>
 #endif  // KRAKEN_ENABLE_PYTHON
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <limits>
+#include <type_traits>
+#include <unordered_map>
 
+#include "CachedLayer.hpp"
 #include "Camera.hpp"
+#include "FrameCapture.hpp"
 #include "Log.hpp"
 #include "PixelArray.hpp"
+#include "StaticBatch.hpp"
 #include "Texture.hpp"
+#include "TextureAtlas.hpp"
+#include "_frame_stats.hpp"
+#include "_sprite_kernel.hpp"
+#include "_worker_pool.hpp"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -67,11 +78,674 @@ static RenderBackend _forcedBackend = RenderBackend::Auto;
 
 static Vec2 _size{};
 
+// Deferred sprite queue. In call order mode, consecutive draws sampling the same texture are
+// merged into a single SDL_RenderGeometry submission. Tint and alpha are baked into the vertex
+// colors so they never split a run, and blend mode changes flush the queue from Texture::make*().
+//
+// In sorted mode every draw becomes an item with a 64-bit key laid out (MSB to LSB) as
+// layer:16 | depth:24 | texture id:20 | blend mode:4. Items are radix sorted on flush, which is
+// stable, so draws with equal keys keep their call order.
+struct QueueItem
+{
+    uint64_t key;
+    SDL_Texture* texture;
+    uint32_t firstQuad;
+    uint32_t quadCount;
+};
+
+static bool _sortingEnabled = false;
+static SDL_Texture* _queueTexture = nullptr;
+static std::vector<SDL_Vertex> _queueVertices;
+static std::vector<QueueItem> _queueItems;
+static std::vector<int> _quadIndices;
+
+static SDL_Texture* _lastKeyTexture = nullptr;
+static uint32_t _lastKeyTextureId = 0;
+static std::unordered_map<SDL_Texture*, uint32_t> _queueTextureIds;
+
+// Untextured shapes from the draw module, kept apart from the quad queue because they bring their
+// own indices. Only one of the two holds draws at a time, as queueing into either submits the
+// other first, so call order is kept across sprites and shapes.
+static std::vector<SDL_Vertex> _shapeVertices;
+static std::vector<int> _shapeIndices;
+
+// Last color passed to SDL_SetRenderDrawColor, cleared when the renderer is recreated
+static Color _drawColor;
+static bool _drawColorValid = false;
+
+static size_t _parallelBatchThreshold = 32768;
+static size_t _cullGridThreshold = 16384;
+
+// Size of the current render target, refreshed after every target change
+static Vec2 _targetSize;
+static bool _targetSizeValid = false;
+
+static const int* _getQuadIndices(const size_t quadCount)
+{
+    for (auto quad = static_cast<int>(_quadIndices.size() / 6); quad < static_cast<int>(quadCount);
+         ++quad)
+    {
+        const int base = quad * 4;
+        _quadIndices.insert(
+            _quadIndices.end(), {base, base + 1, base + 2, base, base + 2, base + 3}
+        );
+    }
+    return _quadIndices.data();
+}
+
+static uint64_t _sortKey(SDL_Texture* texture, const int layer, const double depth)
+{
+    // Ids are handed out in first-seen order and only need to be unique within one flush
+    if (texture != _lastKeyTexture)
+    {
+        const auto [it, inserted] = _queueTextureIds.try_emplace(
+            texture, static_cast<uint32_t>(_queueTextureIds.size())
+        );
+        _lastKeyTexture = texture;
+        _lastKeyTextureId = std::min<uint32_t>(it->second, 0xFFFFF);
+    }
+
+    SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+    SDL_GetTextureBlendMode(texture, &blendMode);
+
+    uint64_t blendBits;
+    switch (blendMode)
+    {
+    case SDL_BLENDMODE_NONE:
+        blendBits = 0;
+        break;
+    case SDL_BLENDMODE_BLEND:
+        blendBits = 1;
+        break;
+    case SDL_BLENDMODE_ADD:
+        blendBits = 2;
+        break;
+    case SDL_BLENDMODE_MUL:
+        blendBits = 3;
+        break;
+    case SDL_BLENDMODE_MOD:
+        blendBits = 4;
+        break;
+    default:
+        blendBits = 15;
+        break;
+    }
+
+    const auto layerBits = static_cast<uint64_t>(
+        std::clamp(layer, static_cast<int>(INT16_MIN), static_cast<int>(INT16_MAX)) + 0x8000
+    );
+
+    // Map the float bit pattern to an unsigned integer with the same ordering
+    uint32_t depthBits;
+    const auto depthF = static_cast<float>(depth);
+    std::memcpy(&depthBits, &depthF, sizeof(depthBits));
+    depthBits = (depthBits & 0x80000000u) ? ~depthBits : (depthBits | 0x80000000u);
+
+    return (layerBits << 48) | (static_cast<uint64_t>(depthBits >> 8) << 24) |
+           (static_cast<uint64_t>(_lastKeyTextureId) << 4) | blendBits;
+}
+
+static void _queueQuads(
+    SDL_Texture* texture, const SDL_Vertex* quads, const size_t quadCount, const int layer,
+    const double depth
+)
+{
+    if (quadCount == 0)
+        return;
+
+    if (!_shapeVertices.empty())
+        _flush();
+
+    if (_sortingEnabled)
+    {
+        const auto firstQuad = static_cast<uint32_t>(_queueVertices.size() / 4);
+        _queueItems.push_back(
+            {_sortKey(texture, layer, depth), texture, firstQuad, static_cast<uint32_t>(quadCount)}
+        );
+    }
+    else if (texture != _queueTexture)
+    {
+        _flush();
+        _queueTexture = texture;
+    }
+
+    _queueVertices.insert(_queueVertices.end(), quads, quads + quadCount * 4);
+}
+
+static void _queueQuad(
+    SDL_Texture* texture, const SDL_Vertex (&quad)[4], const int layer, const double depth
+)
+{
+    _queueQuads(texture, quad, 1, layer, depth);
+}
+
+// Large batches skip the copy into the queue unless they need to take part in sorting
+void _submitBatch(
+    SDL_Texture* texture, const SDL_Vertex* vertices, const size_t quadCount, const int layer,
+    const double depth
+)
+{
+    if (quadCount == 0)
+        return;
+
+    if (_sortingEnabled)
+    {
+        _queueQuads(texture, vertices, quadCount, layer, depth);
+        return;
+    }
+
+    _flush();
+
+    stats::countGeometry(texture, quadCount * 4, quadCount * 6);
+    if (!SDL_RenderGeometry(
+            _renderer, texture, vertices, static_cast<int>(quadCount * 4),
+            _getQuadIndices(quadCount), static_cast<int>(quadCount * 6)
+        ))
+    {
+        throw std::runtime_error("Failed to render geometry: " + std::string(SDL_GetError()));
+    }
+}
+
+void _queueShape(
+    const SDL_Vertex* vertices, const size_t vertexCount, const int* indices,
+    const size_t indexCount
+)
+{
+    if (vertexCount == 0)
+        return;
+
+    // Checked up front, since a bad index would otherwise reach into other queued shapes
+    if (indices)
+    {
+        for (size_t i = 0; i < indexCount; ++i)
+        {
+            if (indices[i] < 0 || static_cast<size_t>(indices[i]) >= vertexCount)
+            {
+                throw std::invalid_argument(
+                    "Geometry index " + std::to_string(indices[i]) + " is out of range for " +
+                    std::to_string(vertexCount) + " vertices"
+                );
+            }
+        }
+    }
+
+    if (!_queueVertices.empty())
+        _flush();
+
+    const auto base = static_cast<int>(_shapeVertices.size());
+    _shapeVertices.insert(_shapeVertices.end(), vertices, vertices + vertexCount);
+
+    if (indices)
+    {
+        _shapeIndices.reserve(_shapeIndices.size() + indexCount);
+        for (size_t i = 0; i < indexCount; ++i)
+            _shapeIndices.push_back(base + indices[i]);
+    }
+    else
+    {
+        // Without indices, every three vertices make a triangle
+        for (size_t i = 0; i < vertexCount / 3 * 3; ++i)
+            _shapeIndices.push_back(base + static_cast<int>(i));
+    }
+}
+
+static void _flushShapes()
+{
+    const stats::TimeScope timeScope;
+    bool submitted = true;
+    if (_renderer && !_shapeIndices.empty())
+    {
+        stats::countGeometry(nullptr, _shapeVertices.size(), _shapeIndices.size());
+        submitted = SDL_RenderGeometry(
+            _renderer, nullptr, _shapeVertices.data(), static_cast<int>(_shapeVertices.size()),
+            _shapeIndices.data(), static_cast<int>(_shapeIndices.size())
+        );
+    }
+
+    _shapeVertices.clear();
+    _shapeIndices.clear();
+
+    if (!submitted)
+        throw std::runtime_error("Failed to render shape geometry: " + std::string(SDL_GetError()));
+}
+
+void _setDrawColor(const Color& color)
+{
+    if (_drawColorValid && color == _drawColor)
+        return;
+
+    if (!SDL_SetRenderDrawColor(_renderer, color.r, color.g, color.b, color.a))
+    {
+        _drawColorValid = false;
+        throw std::runtime_error("Failed to set draw color: " + std::string(SDL_GetError()));
+    }
+
+    _drawColor = color;
+    _drawColorValid = true;
+}
+
+static void _radixSort(std::vector<QueueItem>& items)
+{
+    static std::vector<QueueItem> scratch;
+    scratch.resize(items.size());
+
+    // One pass over the keys builds all eight byte histograms at once
+    size_t counts[8][256] = {};
+    for (const QueueItem& item : items)
+    {
+        for (int byte = 0; byte < 8; ++byte)
+            ++counts[byte][(item.key >> (byte * 8)) & 0xFF];
+    }
+
+    QueueItem* src = items.data();
+    QueueItem* dst = scratch.data();
+    for (int byte = 0; byte < 8; ++byte)
+    {
+        // Skip bytes every key shares, a common case for layer and blend bits
+        size_t* histogram = counts[byte];
+        if (histogram[(src[0].key >> (byte * 8)) & 0xFF] == items.size())
+            continue;
+
+        size_t offset = 0;
+        for (int bucket = 0; bucket < 256; ++bucket)
+        {
+            const size_t count = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += count;
+        }
+
+        for (size_t i = 0; i < items.size(); ++i)
+            dst[histogram[(src[i].key >> (byte * 8)) & 0xFF]++] = src[i];
+
+        std::swap(src, dst);
+    }
+
+    if (src != items.data())
+        std::copy(src, src + items.size(), items.data());
+}
+
+static bool _submitQuads(SDL_Texture* texture, const int* indices, const size_t indexCount)
+{
+    stats::countGeometry(texture, indexCount / 6 * 4, indexCount);
+    return SDL_RenderGeometry(
+        _renderer, texture, _queueVertices.data(), static_cast<int>(_queueVertices.size()), indices,
+        static_cast<int>(indexCount)
+    );
+}
+
+void _flush()
+{
+    if (!_shapeVertices.empty())
+        _flushShapes();
+
+    if (_queueVertices.empty())
+        return;
+
+    const stats::TimeScope timeScope;
+    bool submitted = true;
+    if (_renderer && !_sortingEnabled)
+    {
+        const size_t quadCount = _queueVertices.size() / 4;
+        submitted = _submitQuads(_queueTexture, _getQuadIndices(quadCount), quadCount * 6);
+    }
+    else if (_renderer)
+    {
+        static std::vector<int> runIndices;
+        _radixSort(_queueItems);
+        const int* quadIndices = _getQuadIndices(_queueVertices.size() / 4);
+
+        // Concatenate the index ranges of adjacent items until the texture changes
+        SDL_Texture* runTexture = nullptr;
+        runIndices.clear();
+        for (const QueueItem& item : _queueItems)
+        {
+            if (item.texture != runTexture && !runIndices.empty())
+            {
+                submitted =
+                    _submitQuads(runTexture, runIndices.data(), runIndices.size()) && submitted;
+                runIndices.clear();
+            }
+            runTexture = item.texture;
+
+            runIndices.insert(
+                runIndices.end(), quadIndices + item.firstQuad * 6,
+                quadIndices + (item.firstQuad + item.quadCount) * 6
+            );
+        }
+
+        if (!runIndices.empty())
+            submitted =
+                _submitQuads(runTexture, runIndices.data(), runIndices.size()) && submitted;
+    }
+
+    _queueVertices.clear();
+    _queueItems.clear();
+    _queueTexture = nullptr;
+    _queueTextureIds.clear();
+    _lastKeyTexture = nullptr;
+
+    if (!submitted)
+        throw std::runtime_error("Failed to render geometry: " + std::string(SDL_GetError()));
+}
+
+void _onTextureDestroyed(const SDL_Texture* texture) noexcept
+{
+    const bool queued =
+        _sortingEnabled ? _queueTextureIds.contains(const_cast<SDL_Texture*>(texture))
+                        : texture == _queueTexture;
+    if (!queued)
+        return;
+
+    // Queued quads still reference the texture, submit them while it is alive
+    try
+    {
+        _flush();
+    }
+    catch (const std::exception& e)
+    {
+        log::warn("Dropped queued draws for destroyed texture: {}", e.what());
+    }
+}
+
+void setSortingEnabled(const bool enabled)
+{
+    if (enabled == _sortingEnabled)
+        return;
+
+    _flush();
+    _sortingEnabled = enabled;
+}
+
+bool isSortingEnabled()
+{
+    return _sortingEnabled;
+}
+
+void setParallelBatchThreshold(const size_t threshold)
+{
+    _parallelBatchThreshold = threshold;
+}
+
+size_t getParallelBatchThreshold()
+{
+    return _parallelBatchThreshold;
+}
+
+void setCullGridThreshold(const size_t threshold)
+{
+    _cullGridThreshold = threshold;
+}
+
+size_t getCullGridThreshold()
+{
+    return _cullGridThreshold;
+}
+
+void setBatchThreadCount(const int count)
+{
+    if (count < 0)
+        throw std::invalid_argument("Batch thread count cannot be negative");
+
+    worker_pool::setThreadCount(static_cast<size_t>(count));
+}
+
+int getBatchThreadCount()
+{
+    return static_cast<int>(worker_pool::getThreadCount());
+}
+
+static FrameStats _lastFrameStats{};
+
+void stats::_endFrame()
+{
+#ifdef KRAKEN_FRAME_STATS
+    const auto frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+    _frame.cpuTimeMs = static_cast<double>(_frameTicks) * 1000.0 / frequency;
+    _lastFrameStats = _frame;
+
+    _frame = {};
+    _frameTicks = 0;
+    _hasLastTexture = false;
+#endif  // KRAKEN_FRAME_STATS
+}
+
+FrameStats getFrameStats()
+{
+    return _lastFrameStats;
+}
+
+bool isFrameStatsEnabled()
+{
+#ifdef KRAKEN_FRAME_STATS
+    return true;
+#else
+    return false;
+#endif  // KRAKEN_FRAME_STATS
+}
+
+void Batcher::preallocate(const size_t nSprites)
+{
+    m_vertices.reserve(nSprites * 4);
+}
+
+void Batcher::free()
+{
+    m_vertices.clear();
+    m_vertices.shrink_to_fit();
+}
+
+size_t Batcher::getCapacity() const
+{
+    return m_vertices.capacity() / 4;
+}
+
+std::vector<SDL_Vertex>& _vertexBuffer(Batcher* batcher)
+{
+    // Without a caller-owned buffer, batches share one scratch buffer that only ever grows
+    static std::vector<SDL_Vertex> scratch;
+    return batcher ? batcher->m_vertices : scratch;
+}
+
+static SDL_FColor _vertexColor(const Texture& texture, const float alpha)
+{
+    auto color = static_cast<SDL_FColor>(texture.getTint());
+    color.a = alpha;
+    return color;
+}
+
+static SDL_FColor _vertexColor(const TextureRegion& region)
+{
+    auto color = static_cast<SDL_FColor>(region.getTint());
+    color.a = region.getAlpha();
+    return color;
+}
+
+// Builds a rotated, textured quad in screen space. Returns false when the quad lies entirely
+// outside the current render target.
+static bool _buildQuad(
+    SDL_Vertex (&quad)[4], const Rect& dstRect, const double angle, const Vec2& pivot,
+    const Rect& clipArea, const Texture& texture, const Texture::Flip& flip,
+    const SDL_FColor& color, const Vec2& rendRes
+)
+{
+    const double pivotX = dstRect.w * pivot.x;
+    const double pivotY = dstRect.h * pivot.y;
+    const double originX = dstRect.x + pivotX;
+    const double originY = dstRect.y + pivotY;
+
+    const double localX[4] = {-pivotX, dstRect.w - pivotX, dstRect.w - pivotX, -pivotX};
+    const double localY[4] = {-pivotY, -pivotY, dstRect.h - pivotY, dstRect.h - pivotY};
+
+    double c = 1.0;
+    double s = 0.0;
+    if (angle != 0.0)
+    {
+        c = std::cos(angle);
+        s = std::sin(angle);
+    }
+
+    double x[4], y[4];
+    double minX = std::numeric_limits<double>::infinity();
+    double minY = std::numeric_limits<double>::infinity();
+    double maxX = -std::numeric_limits<double>::infinity();
+    double maxY = -std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 4; ++i)
+    {
+        x[i] = originX + localX[i] * c - localY[i] * s;
+        y[i] = originY + localX[i] * s + localY[i] * c;
+
+        minX = std::min(minX, x[i]);
+        minY = std::min(minY, y[i]);
+        maxX = std::max(maxX, x[i]);
+        maxY = std::max(maxY, y[i]);
+    }
+
+    if (maxX < 0.0 || minX >= rendRes.x || maxY < 0.0 || minY >= rendRes.y)
+        return false;
+
+    const double texW = texture.getWidth();
+    const double texH = texture.getHeight();
+
+    auto u1 = static_cast<float>(clipArea.x / texW);
+    auto v1 = static_cast<float>(clipArea.y / texH);
+    auto u2 = static_cast<float>(clipArea.getRight() / texW);
+    auto v2 = static_cast<float>(clipArea.getBottom() / texH);
+
+    if (flip.h)
+        std::swap(u1, u2);
+    if (flip.v)
+        std::swap(v1, v2);
+
+    const float u[4] = {u1, u2, u2, u1};
+    const float v[4] = {v1, v1, v2, v2};
+    for (int i = 0; i < 4; ++i)
+    {
+        quad[i] = {{static_cast<float>(x[i]), static_cast<float>(y[i])}, color, {u[i], v[i]}};
+    }
+
+    return true;
+}
+
+// Grid cells hold this many instances on average, up to a 64x64 grid
+constexpr size_t CULL_GRID_CELL_INSTANCES = 256;
+constexpr size_t CULL_GRID_MAX_AXIS = 64;
+
+// Largest distance from an instance's position to a corner of its quad, per unit of scaled size.
+// The anchor offset and the rotation about the pivot are bounded separately, without trig.
+static Vec2 _extentFactors(const Vec2& anchor, const Vec2& pivot)
+{
+    return {
+        std::abs(pivot.x - anchor.x) + std::max(std::abs(pivot.x), std::abs(1.0 - pivot.x)),
+        std::abs(pivot.y - anchor.y) + std::max(std::abs(pivot.y), std::abs(1.0 - pivot.y)),
+    };
+}
+
+// Bins a batch into a uniform grid over its instance positions and rejects the cells whose
+// bounds, grown by the largest extent binned into them, miss the view. getPos(i) returns an
+// instance's world position and getExtent(i) a world-space bound on its distance to any corner.
+//
+// Writes the instances of the remaining cells to visible, in instance order so draw order is
+// kept. Returns false without writing when no cell could be rejected.
+template <typename PosFn, typename ExtentFn>
+static bool _cullGrid(
+    const size_t count, const camera::View& view, PosFn getPos, ExtentFn getExtent,
+    std::vector<uint32_t>& visible
+)
+{
+    struct Cell
+    {
+        double minX = std::numeric_limits<double>::infinity();
+        double minY = std::numeric_limits<double>::infinity();
+        double maxX = -std::numeric_limits<double>::infinity();
+        double maxY = -std::numeric_limits<double>::infinity();
+    };
+
+    static std::vector<uint32_t> cellOf;
+    static std::vector<Cell> cells;
+    static std::vector<uint8_t> cellVisible;
+
+    if (count > std::numeric_limits<uint32_t>::max())
+        return false;
+
+    double minX = std::numeric_limits<double>::infinity();
+    double minY = std::numeric_limits<double>::infinity();
+    double maxX = -std::numeric_limits<double>::infinity();
+    double maxY = -std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Vec2 pos = getPos(i);
+        minX = std::min(minX, pos.x);
+        minY = std::min(minY, pos.y);
+        maxX = std::max(maxX, pos.x);
+        maxY = std::max(maxY, pos.y);
+    }
+    if (!(minX <= maxX && minY <= maxY))
+        return false;
+
+    const auto axis = std::clamp<size_t>(
+        static_cast<size_t>(std::sqrt(static_cast<double>(count / CULL_GRID_CELL_INSTANCES))), 1,
+        CULL_GRID_MAX_AXIS
+    );
+    const double spanX = maxX - minX;
+    const double spanY = maxY - minY;
+    const double toColumn = spanX > 0.0 ? static_cast<double>(axis) / spanX : 0.0;
+    const double toRow = spanY > 0.0 ? static_cast<double>(axis) / spanY : 0.0;
+
+    cellOf.resize(count);
+    cells.assign(axis * axis, Cell{});
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Vec2 pos = getPos(i);
+
+        // Non-finite positions land in the first cell rather than an out of range one
+        const double fx = (pos.x - minX) * toColumn;
+        const double fy = (pos.y - minY) * toRow;
+        const size_t column = fx > 0.0 ? std::min(static_cast<size_t>(fx), axis - 1) : 0;
+        const size_t row = fy > 0.0 ? std::min(static_cast<size_t>(fy), axis - 1) : 0;
+        const size_t index = row * axis + column;
+        cellOf[i] = static_cast<uint32_t>(index);
+
+        const double extent = getExtent(i);
+        Cell& cell = cells[index];
+        cell.minX = std::min(cell.minX, pos.x - extent);
+        cell.minY = std::min(cell.minY, pos.y - extent);
+        cell.maxX = std::max(cell.maxX, pos.x + extent);
+        cell.maxY = std::max(cell.maxY, pos.y + extent);
+    }
+
+    const Rect bounds = view.getWorldBounds();
+    cellVisible.resize(cells.size());
+    bool rejected = false;
+    for (size_t i = 0; i < cells.size(); ++i)
+    {
+        const Cell& cell = cells[i];
+        const bool empty = !(cell.minX <= cell.maxX);
+        const bool outside = cell.maxX < bounds.x || cell.minX > bounds.getRight() ||
+                             cell.maxY < bounds.y || cell.minY > bounds.getBottom();
+        cellVisible[i] = !outside;
+        rejected |= outside && !empty;
+    }
+    if (!rejected)
+        return false;
+
+    visible.clear();
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (cellVisible[cellOf[i]])
+            visible.push_back(static_cast<uint32_t>(i));
+    }
+
+    return true;
+}
+
 void _init(SDL_Window* window, const int width, const int height)
 {
     _size = {width, height};
+    _targetSizeValid = false;
 
-    if (_forcedBackend != RenderBackend::Legacy)
+    const bool gpuBackend =
+        _forcedBackend != RenderBackend::Legacy && _forcedBackend != RenderBackend::Software;
+    if (gpuBackend)
     {
         SDL_GPUShaderFormat format = SDL_GPU_SHADERFORMAT_SPIRV | SDL_GPU_SHADERFORMAT_MSL |
                                      SDL_GPU_SHADERFORMAT_DXIL;
@@ -118,12 +792,15 @@ void _init(SDL_Window* window, const int width, const int height)
     // Fallback to legacy renderer
     if (!_renderer)
     {
-        if (_forcedBackend != RenderBackend::Legacy)
+        if (gpuBackend)
             log::warn("GPU backend failed: {}. Falling back to LEGACY renderer.", SDL_GetError());
+        else if (_forcedBackend == RenderBackend::Software)
+            log::info("Using SOFTWARE renderer backend.");
         else
             log::info("Using LEGACY renderer backend.");
 
-        _renderer = SDL_CreateRenderer(window, nullptr);
+        const bool software = _forcedBackend == RenderBackend::Software;
+        _renderer = SDL_CreateRenderer(window, software ? SDL_SOFTWARE_RENDERER : nullptr);
 
         if (!_renderer)
             throw std::runtime_error("Renderer failed to create: " + std::string(SDL_GetError()));
@@ -164,6 +841,18 @@ void _init(SDL_Window* window, const int width, const int height)
 
 void _quit()
 {
+    worker_pool::_quit();
+    _targetSizeValid = false;
+
+    _queueVertices.clear();
+    _queueItems.clear();
+    _queueTexture = nullptr;
+    _queueTextureIds.clear();
+    _lastKeyTexture = nullptr;
+    _shapeVertices.clear();
+    _shapeIndices.clear();
+    _drawColorValid = false;
+
     if (_primaryTarget)
     {
         delete _primaryTarget;
@@ -190,8 +879,8 @@ void setRenderBackend(const RenderBackend backend)
 
 void clear(const Color& color)
 {
-    if (!SDL_SetRenderDrawColor(_renderer, color.r, color.g, color.b, color.a))
-        throw std::runtime_error("Failed to set render draw color: " + std::string(SDL_GetError()));
+    _flush();
+    _setDrawColor(color);
 
     if (!SDL_RenderClear(_renderer))
         throw std::runtime_error("Failed to clear renderer: " + std::string(SDL_GetError()));
@@ -199,6 +888,9 @@ void clear(const Color& color)
 
 void setTarget(const Texture* target)
 {
+    _flush();
+    _targetSizeValid = false;
+
     if (target)
     {
         if (!target->hasUsage(TextureUsage::Drawable))
@@ -210,12 +902,24 @@ void setTarget(const Texture* target)
             throw std::runtime_error(
                 "Failed to unset render target: " + std::string(SDL_GetError())
             );
+        stats::countTargetSwitch();
         return;
     }
 
     SDL_Texture* targetSDL = target->getSDL();
     if (!SDL_SetRenderTarget(_renderer, targetSDL))
         throw std::runtime_error("Failed to set render target: " + std::string(SDL_GetError()));
+    stats::countTargetSwitch();
+}
+
+void _setTargetSDL(SDL_Texture* target)
+{
+    _flush();
+    _targetSizeValid = false;
+
+    if (!SDL_SetRenderTarget(_renderer, target))
+        throw std::runtime_error("Failed to set render target: " + std::string(SDL_GetError()));
+    stats::countTargetSwitch();
 }
 
 void setDefaultFilterMode(const FilterMode filter)
@@ -230,11 +934,14 @@ FilterMode getDefaultFilterMode()
 
 void present()
 {
+    _flush();
+
     // Regular present if no custom renderer size
     if (!_primaryTarget)
     {
         if (!SDL_RenderPresent(_renderer))
             throw std::runtime_error("Failed to present renderer: " + std::string(SDL_GetError()));
+        stats::_endFrame();
         return;
     }
 
@@ -251,9 +958,12 @@ void present()
     // Truly reset render target since SetTarget bit my butt
     if (!SDL_SetRenderTarget(_renderer, nullptr))
         throw std::runtime_error("Failed to unset render target: " + std::string(SDL_GetError()));
+    _targetSizeValid = false;
+    stats::countTargetSwitch();
 
     // Draw custom render size, scaled up to true renderer
     draw(*_primaryTarget, Rect{_size});
+    _flush();
 
     // Finally present
     if (!SDL_RenderPresent(_renderer))
@@ -263,6 +973,8 @@ void present()
     setTarget(_primaryTarget);
     if (currCamera)
         currCamera->transform = cameraXf;
+
+    stats::_endFrame();
 }
 
 void setVirtualResolution(const int width, const int height)
@@ -306,24 +1018,34 @@ Vec2 getVirtualResolution()
 
 Vec2 getCurrentResolution()
 {
+    if (_targetSizeValid)
+        return _targetSize;
+
     SDL_Texture* currentTarget = SDL_GetRenderTarget(_renderer);
 
-    // No primary target nor user target set
     if (!currentTarget)
-        return _size;
-
-    // Primary target active
-    if (_primaryTarget && currentTarget == _primaryTarget->getSDL())
-        return _primaryTarget->getSize();
-
-    // User target active
-    float w, h;
-    if (!SDL_GetTextureSize(currentTarget, &w, &h))
-        throw std::runtime_error(
-            "Failed to get render target size: " + std::string(SDL_GetError())
-        );
+    {
+        // No primary target nor user target set
+        _targetSize = _size;
+    }
+    else if (_primaryTarget && currentTarget == _primaryTarget->getSDL())
+    {
+        // Primary target active
+        _targetSize = _primaryTarget->getSize();
+    }
+    else
+    {
+        // User target active
+        float w, h;
+        if (!SDL_GetTextureSize(currentTarget, &w, &h))
+            throw std::runtime_error(
+                "Failed to get render target size: " + std::string(SDL_GetError())
+            );
+        _targetSize = {w, h};
+    }
 
-    return {w, h};
+    _targetSizeValid = true;
+    return _targetSize;
 }
 
 Vec2 getOutputResolution()
@@ -336,6 +1058,8 @@ PixelArray readPixels(const Rect& src)
     if (src.w < 0.0 || src.h < 0.0)
         throw std::invalid_argument("Source rectangle must have positive width and height");
 
+    _flush();
+
     const auto sdlRect = static_cast<SDL_Rect>(src);
     const bool hasSize = (src.w > 0.0 && src.h > 0.0);
 
@@ -346,187 +1070,312 @@ PixelArray readPixels(const Rect& src)
     return PixelArray(surface);
 }
 
-void draw(const Texture& texture, const Transform& transform, const Vec2& anchor, const Vec2& pivot)
+static void _drawTransformed(
+    const Texture& texture, const Rect& clipArea, const Texture::Flip& flip,
+    const SDL_FColor& color, const Transform& transform, const Vec2& anchor, const Vec2& pivot,
+    const int layer, const double depth
+)
 {
-    if (!texture.hasUsage(TextureUsage::Drawable))
-        throw std::runtime_error("Texture is not drawable");
-
-    Rect clipArea = texture.getClipArea();
     if (clipArea.w <= 0.0 || clipArea.h <= 0.0)
         return;
-    if (transform.scale.isZero() || texture.getAlpha() == 0.0f)
+
+    if (transform.scale.isZero() || color.a == 0.0f)
         return;
 
-    Rect dstRect{0.0, 0.0, clipArea.getSize() * transform.scale};
+    const camera::View& view = camera::getView();
+    Rect dstRect{0.0, 0.0, clipArea.getSize() * transform.scale * view.zoom};
 
     // Position based on anchor
-    const Vec2 pos = camera::worldToScreen(transform.pos);
+    const Vec2 pos = view.worldToScreen(transform.pos);
     dstRect.setTopLeft(pos - (dstRect.getSize() * anchor));
 
-    const double renderAngle = transform.angle + camera::getActiveAngle();
+    const double renderAngle = transform.angle + view.angle;
 
-    // cull using the rotated bounds so rotated quads don't disappear early near the edge
-    const Rect cullRect = _rotatedBounds(dstRect, renderAngle, pivot);
-    const Vec2 rendRes = getCurrentResolution();
-    if (cullRect.getRight() < 0.0 || cullRect.x >= rendRes.x || cullRect.getBottom() < 0.0 ||
-        cullRect.y >= rendRes.y)
+    // cull using the rotated corners so rotated quads don't disappear early near the edge
+    SDL_Vertex quad[4];
+    if (!_buildQuad(
+            quad, dstRect, renderAngle, pivot, clipArea, texture, flip, color, view.resolution
+        ))
     {
+        stats::countSprites(0, 1);
         return;
     }
 
-    const auto dstSDLRect = static_cast<SDL_FRect>(dstRect);
-    const auto srcSDLRect = static_cast<SDL_FRect>(clipArea);
-
-    // Pivot is normalized 0..1 relative to dstRect, for rotation center
-    const auto pivotPoint = static_cast<SDL_FPoint>(dstRect.getSize() * pivot);
+    stats::countSprites(1, 0);
+    _queueQuad(texture.getSDL(), quad, layer, depth);
+}
 
-    SDL_FlipMode flipAxis = SDL_FLIP_NONE;
-    if (texture.flip.h)
-        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_HORIZONTAL);
-    if (texture.flip.v)
-        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_VERTICAL);
+static void _drawRect(
+    const Texture& texture, const Rect& clipArea, const Texture::Flip& flip,
+    const SDL_FColor& color, const Rect& dst, const double angle, const Vec2& pivot,
+    const int layer, const double depth
+)
+{
+    if (color.a == 0.0f || clipArea.w <= 0.0 || clipArea.h <= 0.0)
+        return;
 
-    if (!SDL_RenderTextureRotated(
-            _renderer, texture.getSDL(), &srcSDLRect, &dstSDLRect, TO_DEGREES(renderAngle),
-            &pivotPoint, flipAxis
-        ))
+    SDL_Vertex quad[4];
+    const Vec2 rendRes = getCurrentResolution();
+    if (!_buildQuad(quad, dst, angle, pivot, clipArea, texture, flip, color, rendRes))
     {
-        throw std::runtime_error("Failed to render texture: " + std::string(SDL_GetError()));
+        stats::countSprites(0, 1);
+        return;
     }
+
+    stats::countSprites(1, 0);
+    _queueQuad(texture.getSDL(), quad, layer, depth);
 }
 
-void draw(const Texture& texture, Rect dst, const double angle, const Vec2& pivot)
+void draw(
+    const Texture& texture, const Transform& transform, const Vec2& anchor, const Vec2& pivot,
+    const int layer, const double depth
+)
 {
+    const stats::DrawScope drawScope;
     if (!texture.hasUsage(TextureUsage::Drawable))
         throw std::runtime_error("Texture is not drawable");
 
-    if (texture.getAlpha() == 0.0f)
-        return;
-
-    const Rect clipArea = texture.getClipArea();
-    if (clipArea.w <= 0.0 || clipArea.h <= 0.0)
-        return;
-
-    const Vec2 worldCenter = dst.getCenter();
+    _drawTransformed(
+        texture, texture.getClipArea(), texture.flip, _vertexColor(texture, texture.getAlpha()),
+        transform, anchor, pivot, layer, depth
+    );
+}
 
-    const Vec2 rendRes = getCurrentResolution();
-    const Rect cullRect = _rotatedBounds(dst, angle, pivot);
-    if (cullRect.getRight() < 0.0 || cullRect.x >= rendRes.x || cullRect.getBottom() < 0.0 ||
-        cullRect.y >= rendRes.y)
-        return;
+void draw(
+    const Texture& texture, const Rect dst, const double angle, const Vec2& pivot, const int layer,
+    const double depth
+)
+{
+    const stats::DrawScope drawScope;
+    if (!texture.hasUsage(TextureUsage::Drawable))
+        throw std::runtime_error("Texture is not drawable");
 
-    const auto dstSDLRect = static_cast<SDL_FRect>(dst);
-    const auto srcSDLRect = static_cast<SDL_FRect>(clipArea);
-    const auto pivotPoint = static_cast<SDL_FPoint>(dst.getSize() * pivot);
+    _drawRect(
+        texture, texture.getClipArea(), texture.flip, _vertexColor(texture, texture.getAlpha()),
+        dst, angle, pivot, layer, depth
+    );
+}
 
-    SDL_FlipMode flipAxis = SDL_FLIP_NONE;
-    if (texture.flip.h)
-        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_HORIZONTAL);
-    if (texture.flip.v)
-        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_VERTICAL);
+void draw(
+    const TextureRegion& region, const Transform& transform, const Vec2& anchor, const Vec2& pivot,
+    const int layer, const double depth
+)
+{
+    const stats::DrawScope drawScope;
+    _drawTransformed(
+        *region.getTexture(), region.getSrcRect(), region.getFlip(), _vertexColor(region),
+        transform, anchor, pivot, layer, depth
+    );
+}
 
-    if (!SDL_RenderTextureRotated(
-            _renderer, texture.getSDL(), &srcSDLRect, &dstSDLRect, TO_DEGREES(angle), &pivotPoint,
-            flipAxis
-        ))
-    {
-        throw std::runtime_error("Failed to render texture: " + std::string(SDL_GetError()));
-    }
+void draw(
+    const TextureRegion& region, const Rect dst, const double angle, const Vec2& pivot,
+    const int layer, const double depth
+)
+{
+    const stats::DrawScope drawScope;
+    _drawRect(
+        *region.getTexture(), region.getSrcRect(), region.getFlip(), _vertexColor(region), dst,
+        angle, pivot, layer, depth
+    );
 }
 
 void draw9Slice(
     const Texture& texture, const Rect& dst, const Rect& slice, const Vec2& anchor,
-    const Vec2& pivot
+    const Vec2& pivot, const int layer, const double depth
 )
 {
+    const stats::DrawScope drawScope;
     if (!texture.hasUsage(TextureUsage::Drawable))
         throw std::runtime_error("Texture is not drawable");
 
-    if (texture.getAlpha() == 0.0f)
+    const float alpha = texture.getAlpha();
+    if (alpha == 0.0f)
         return;
 
     const Rect textureClipArea = texture.getClipArea();
     if (textureClipArea.w <= 0.0 || textureClipArea.h <= 0.0)
         return;
 
-    const auto [leftWidth, topHeight, rightWidth, bottomHeight] = static_cast<SDL_FRect>(slice);
+    const Vec2 rendRes = getCurrentResolution();
+    if (dst.getRight() < 0.0 || dst.x >= rendRes.x || dst.getBottom() < 0.0 || dst.y >= rendRes.y)
+    {
+        stats::countSprites(0, 1);
+        return;
+    }
+
+    // slice holds (left_width, top_height, right_width, bottom_height). Corners keep their source
+    // size unless the destination is too small to fit both, in which case they shrink evenly.
+    const double left = slice.x;
+    const double top = slice.y;
+    const double right = slice.w;
+    const double bottom = slice.h;
 
-    const auto dstSDLRect = static_cast<SDL_FRect>(dst);
-    const auto srcSDLRect = static_cast<SDL_FRect>(textureClipArea);
+    const double fitX = (left + right > dst.w && left + right > 0.0) ? dst.w / (left + right) : 1.0;
+    const double fitY = (top + bottom > dst.h && top + bottom > 0.0) ? dst.h / (top + bottom) : 1.0;
 
-    if (!SDL_RenderTexture9Grid(
-            _renderer, texture.getSDL(), &srcSDLRect, leftWidth, rightWidth, topHeight,
-            bottomHeight, 1.0f, &dstSDLRect
-        ))
+    const double srcX[4] = {
+        textureClipArea.x, textureClipArea.x + left, textureClipArea.getRight() - right,
+        textureClipArea.getRight()
+    };
+    const double srcY[4] = {
+        textureClipArea.y, textureClipArea.y + top, textureClipArea.getBottom() - bottom,
+        textureClipArea.getBottom()
+    };
+    const double dstX[4] = {
+        dst.x, dst.x + left * fitX, dst.getRight() - right * fitX, dst.getRight()
+    };
+    const double dstY[4] = {
+        dst.y, dst.y + top * fitY, dst.getBottom() - bottom * fitY, dst.getBottom()
+    };
+
+    const SDL_FColor color = _vertexColor(texture, alpha);
+    const double texW = texture.getWidth();
+    const double texH = texture.getHeight();
+
+    // All nine patches share one queue item so they stay together when sorted
+    SDL_Vertex quads[9 * 4];
+    size_t quadCount = 0;
+    for (int row = 0; row < 3; ++row)
     {
-        throw std::runtime_error(
-            "Failed to render 9-slice texture: " + std::string(SDL_GetError())
-        );
+        if (dstY[row + 1] <= dstY[row] || srcY[row + 1] <= srcY[row])
+            continue;
+
+        const auto y1 = static_cast<float>(dstY[row]);
+        const auto y2 = static_cast<float>(dstY[row + 1]);
+        const auto v1 = static_cast<float>(srcY[row] / texH);
+        const auto v2 = static_cast<float>(srcY[row + 1] / texH);
+
+        for (int col = 0; col < 3; ++col)
+        {
+            if (dstX[col + 1] <= dstX[col] || srcX[col + 1] <= srcX[col])
+                continue;
+
+            const auto x1 = static_cast<float>(dstX[col]);
+            const auto x2 = static_cast<float>(dstX[col + 1]);
+            const auto u1 = static_cast<float>(srcX[col] / texW);
+            const auto u2 = static_cast<float>(srcX[col + 1] / texW);
+
+            SDL_Vertex* quad = quads + quadCount++ * 4;
+            quad[0] = {{x1, y1}, color, {u1, v1}};
+            quad[1] = {{x2, y1}, color, {u2, v1}};
+            quad[2] = {{x2, y2}, color, {u2, v2}};
+            quad[3] = {{x1, y2}, color, {u1, v2}};
+        }
     }
+
+    stats::countSprites(1, 0);
+    _queueQuads(texture.getSDL(), quads, quadCount, layer, depth);
 }
 
-void drawBatch(
-    const Texture& texture, const std::vector<Transform>& transforms, const Vec2& anchor,
-    const Vec2& pivot, const std::optional<std::vector<Rect>>& clipRects
+// clipRects are relative to clipOrigin, which is the region origin for atlas regions
+static void _drawBatch(
+    const Texture& texture, const Rect& baseClipArea, const Vec2& clipOrigin,
+    const Texture::Flip& flip, const SDL_FColor& color, const std::vector<Transform>& transforms,
+    const Vec2& anchor, const Vec2& pivot, const std::optional<std::vector<Rect>>& clipRects,
+    Batcher* batcher, const int layer, const double depth
 )
 {
-    if (!texture.hasUsage(TextureUsage::Drawable))
-        throw std::runtime_error("Texture is not drawable");
-
-    if (transforms.empty() || texture.getAlpha() == 0.0f)
+    if (transforms.empty() || color.a == 0.0f)
         return;
 
-    const Rect textureClipArea = texture.getClipArea();
-    if (textureClipArea.w <= 0.0 || textureClipArea.h <= 0.0)
+    if (baseClipArea.w <= 0.0 || baseClipArea.h <= 0.0)
         return;
 
-    const double cameraAngle = camera::getActiveAngle();
+    const camera::View& view = camera::getView();
+    const size_t n = transforms.size();
 
-    const Vec2 rendRes = getCurrentResolution();
+    static std::vector<uint32_t> visible;
+    bool culled = false;
+    if (n >= _cullGridThreshold)
+    {
+        const Vec2 factors = _extentFactors(anchor, pivot);
+        culled = _cullGrid(
+            n, view, [&](const size_t i) { return transforms[i].pos; },
+            [&](const size_t i)
+            {
+                const Vec2 size = (clipRects && i < clipRects->size())
+                                      ? (*clipRects)[i].getSize()
+                                      : baseClipArea.getSize();
+                const Vec2& scale = transforms[i].scale;
+                return std::abs(size.x * scale.x) * factors.x +
+                       std::abs(size.y * scale.y) * factors.y;
+            },
+            visible
+        );
+    }
+    const size_t count = culled ? visible.size() : n;
 
-    SDL_FlipMode flipAxis = SDL_FLIP_NONE;
-    if (texture.flip.h)
-        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_HORIZONTAL);
-    if (texture.flip.v)
-        flipAxis = static_cast<SDL_FlipMode>(flipAxis | SDL_FLIP_VERTICAL);
+    std::vector<SDL_Vertex>& vertices = _vertexBuffer(batcher);
+    vertices.clear();
+    vertices.reserve(count * 4);
 
-    for (size_t i = 0; i < transforms.size(); ++i)
+    for (size_t k = 0; k < count; ++k)
     {
+        const size_t i = culled ? visible[k] : k;
         const auto& transform = transforms[i];
         if (transform.scale.isZero())
             continue;
 
-        // Use per-instance clip rect if provided, otherwise use texture's clip area
-        const Rect& clipArea = (clipRects && i < clipRects->size()) ? (*clipRects)[i]
-                                                                    : textureClipArea;
+        // Use per-instance clip rect if provided, otherwise use the base clip area
+        Rect clipArea = baseClipArea;
+        if (clipRects && i < clipRects->size())
+        {
+            clipArea = (*clipRects)[i];
+            clipArea.setTopLeft(clipArea.getTopLeft() + clipOrigin);
+        }
         if (clipArea.w <= 0.0 || clipArea.h <= 0.0)
             continue;
 
-        const auto srcSDLRect = static_cast<SDL_FRect>(clipArea);
-        const Vec2 clipSize = clipArea.getSize();
-
-        Rect dstRect{0.0, 0.0, clipSize * transform.scale};
-        const Vec2 pos = camera::worldToScreen(transform.pos);
+        Rect dstRect{0.0, 0.0, clipArea.getSize() * transform.scale * view.zoom};
+        const Vec2 pos = view.worldToScreen(transform.pos);
         dstRect.setTopLeft(pos - (dstRect.getSize() * anchor));
 
-        const double renderAngle = transform.angle + cameraAngle;
-
-        const Rect cullRect = _rotatedBounds(dstRect, renderAngle, pivot);
-        if (cullRect.getRight() < 0.0 || cullRect.x >= rendRes.x || cullRect.getBottom() < 0.0 ||
-            cullRect.y >= rendRes.y)
-            continue;
-
-        const auto dstSDLRect = static_cast<SDL_FRect>(dstRect);
-        const auto pivotPoint = static_cast<SDL_FPoint>(dstRect.getSize() * pivot);
-
-        if (!SDL_RenderTextureRotated(
-                _renderer, texture.getSDL(), &srcSDLRect, &dstSDLRect, TO_DEGREES(renderAngle),
-                &pivotPoint, flipAxis
+        SDL_Vertex quad[4];
+        if (!_buildQuad(
+                quad, dstRect, transform.angle + view.angle, pivot, clipArea, texture, flip, color,
+                view.resolution
             ))
         {
-            throw std::runtime_error("Failed to render texture: " + std::string(SDL_GetError()));
+            continue;
         }
+
+        vertices.insert(vertices.end(), quad, quad + 4);
     }
+
+    const size_t quadCount = vertices.size() / 4;
+    stats::countSprites(quadCount, n - quadCount);
+    _submitBatch(texture.getSDL(), vertices.data(), quadCount, layer, depth);
+}
+
+void drawBatch(
+    const Texture& texture, const std::vector<Transform>& transforms, const Vec2& anchor,
+    const Vec2& pivot, const std::optional<std::vector<Rect>>& clipRects, Batcher* batcher,
+    const int layer, const double depth
+)
+{
+    const stats::DrawScope drawScope;
+    if (!texture.hasUsage(TextureUsage::Drawable))
+        throw std::runtime_error("Texture is not drawable");
+
+    _drawBatch(
+        texture, texture.getClipArea(), {}, texture.flip, _vertexColor(texture, texture.getAlpha()),
+        transforms, anchor, pivot, clipRects, batcher, layer, depth
+    );
+}
+
+void drawBatch(
+    const TextureRegion& region, const std::vector<Transform>& transforms, const Vec2& anchor,
+    const Vec2& pivot, const std::optional<std::vector<Rect>>& clipRects, Batcher* batcher,
+    const int layer, const double depth
+)
+{
+    const stats::DrawScope drawScope;
+    const Rect& srcRect = region.getSrcRect();
+    _drawBatch(
+        *region.getTexture(), srcRect, srcRect.getTopLeft(), region.getFlip(),
+        _vertexColor(region), transforms, anchor, pivot, clipRects, batcher, layer, depth
+    );
 }
 
 SDL_Renderer* _get()
@@ -548,224 +1397,441 @@ bool _primaryActive()
 }
 
 #ifdef KRAKEN_ENABLE_PYTHON
-class Batcher;
-
-static void drawBatchNDArray(
-    const Texture& texture,
-    nb::ndarray<const double, nb::ndim<2>, nb::c_contig, nb::device::cpu> arr, const Vec2& anchor,
-    const Vec2& pivot, Batcher* batcher
-);
-
-class Batcher
+template <typename T>
+using InstanceArray = nb::ndarray<const T, nb::ndim<2>, nb::c_contig, nb::device::cpu>;
+template <typename T>
+using ColumnArray = nb::ndarray<const T, nb::ndim<1>, nb::device::cpu>;
+template <typename T>
+using ClipArray = nb::ndarray<const T, nb::ndim<2>, nb::device::cpu>;
+using ColorArray = nb::ndarray<const uint8_t, nb::ndim<2>, nb::device::cpu>;
+
+// Strided view of one per-instance value. Interleaved rows and separate column arrays both reduce
+// to a base pointer and an element stride, so a single loop serves both layouts.
+template <typename T>
+struct _Column
 {
-  public:
-    Batcher() = default;
-    ~Batcher() = default;
+    const T* data = nullptr;
+    int64_t stride = 0;
 
-    void preallocate(const size_t nSprites)
+    [[nodiscard]] double get(const size_t i, const double fallback) const
     {
-        vertices.reserve(nSprites * 4);
-        indices.reserve(nSprites * 6);
-    }
-
-    void free()
-    {
-        vertices.clear();
-        vertices.shrink_to_fit();
-        indices.clear();
-        indices.shrink_to_fit();
+        return data ? static_cast<double>(data[static_cast<int64_t>(i) * stride]) : fallback;
     }
+};
 
-  private:
-    friend void drawBatchNDArray(
-        const Texture& texture,
-        nb::ndarray<const double, nb::ndim<2>, nb::c_contig, nb::device::cpu> arr,
-        const Vec2& anchor, const Vec2& pivot, Batcher* batcher
-    );
+template <typename T>
+struct _InstanceColumns
+{
+    size_t count = 0;
+    _Column<T> x;
+    _Column<T> y;
+    _Column<T> angle;
+    _Column<T> scaleX;
+    _Column<T> scaleY;
+    _Column<T> clip[4];  // left, top, width, height
+    const uint8_t* colors = nullptr;
+    int64_t colorStride = 0;
+    int64_t channelStride = 1;
+};
 
-    std::vector<SDL_Vertex> vertices;
-    std::vector<int> indices;
+// What a batch samples from, resolved once from either a texture or an atlas region
+struct _SpriteSource
+{
+    const Texture& texture;
+    Rect clipArea;
+    Vec2 clipOrigin;
+    Texture::Flip flip;
+    SDL_FColor color;
 };
 
-void drawBatchNDArray(
-    const Texture& texture,
-    nb::ndarray<const double, nb::ndim<2>, nb::c_contig, nb::device::cpu> arr, const Vec2& anchor,
-    const Vec2& pivot, Batcher* batcher
-)
+static _SpriteSource _spriteSource(const Texture& texture)
 {
     if (!texture.hasUsage(TextureUsage::Drawable))
         throw std::runtime_error("Texture is not drawable");
 
-    const size_t n = arr.shape(0);
-    const size_t cols = arr.shape(1);
+    return {
+        texture, texture.getClipArea(), {}, texture.flip, _vertexColor(texture, texture.getAlpha())
+    };
+}
 
-    if (n == 0)
-        return;
+static _SpriteSource _spriteSource(const TextureRegion& region)
+{
+    const Rect& srcRect = region.getSrcRect();
+    return {
+        *region.getTexture(), srcRect, srcRect.getTopLeft(), region.getFlip(),
+        _vertexColor(region)
+    };
+}
 
-    if (cols < 2 || cols > 5 && cols != 9)
-        throw std::invalid_argument(
-            "Expected array with 2-5 or 9 columns: [x, y, (angle), (scale or scale_x, scale_y), "
-            "(clip_left, clip_top, clip_width, clip_height)]"
-        );
+// Instance at position i of a run, which either covers the whole batch or only the instances
+// left by grid culling
+static size_t _instanceAt(const uint32_t* indices, const size_t i)
+{
+    return indices ? indices[i] : i;
+}
 
-    const Rect textureClipArea = texture.getClipArea();
-    if (textureClipArea.w <= 0.0 || textureClipArea.h <= 0.0)
-        return;
+// Converts one chunk of a column to contiguous floats for the vertex kernel. Contiguous float32
+// input is used in place unless it has to be gathered.
+template <typename T>
+static const float* _floatColumn(
+    const _Column<T>& column, const uint32_t* indices, const size_t begin, const size_t count,
+    float* scratch
+)
+{
+    if (!column.data)
+        return nullptr;
 
-    const float alpha = texture.getAlpha();
-    if (alpha == 0.0f)
-        return;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        if (column.stride == 1 && !indices)
+            return column.data + begin;
+    }
 
-    const double cameraAngle = camera::getActiveAngle();
+    for (size_t i = 0; i < count; ++i)
+        scratch[i] = static_cast<float>(column.get(_instanceAt(indices, begin + i), 0.0));
+    return scratch;
+}
 
-    const Vec2 rendRes = getCurrentResolution();
-    SDL_Texture* sdlTexture = texture.getSDL();
+// Positions are made camera relative in the source precision before narrowing, so large world
+// coordinates keep their precision near the camera.
+template <typename T>
+static const float* _positionColumn(
+    const _Column<T>& column, const uint32_t* indices, const size_t begin, const size_t count,
+    const double offset, float* scratch
+)
+{
+    for (size_t i = 0; i < count; ++i)
+        scratch[i] = static_cast<float>(column.get(_instanceAt(indices, begin + i), 0.0) - offset);
+    return scratch;
+}
 
-    const Color tint = texture.getTint();
-    const auto vertexColor = static_cast<SDL_FColor>(tint);
+// Instances are converted in chunks that stay in cache between conversion and generation
+constexpr size_t KERNEL_CHUNK_SIZE = 1024;
+
+// Generates quads for run positions [begin, end) into out and returns how many were written. With
+// indices, the run holds only those instances. Safe to call from worker threads, each of which
+// keeps its own conversion scratch.
+template <typename T>
+static size_t _generateRange(
+    const kernel::BatchParams& params, const _InstanceColumns<T>& columns, const Vec2& cameraPos,
+    const uint32_t* indices, const size_t begin, const size_t end, SDL_Vertex* out
+)
+{
+    thread_local std::vector<float> scratch(KERNEL_CHUNK_SIZE * 9);
+    thread_local std::vector<uint8_t> colorScratch(KERNEL_CHUNK_SIZE * 4);
+    float* const xs = scratch.data();
+    float* const ys = xs + KERNEL_CHUNK_SIZE;
+    float* const angles = ys + KERNEL_CHUNK_SIZE;
+    float* const scalesX = angles + KERNEL_CHUNK_SIZE;
+    float* const scalesY = scalesX + KERNEL_CHUNK_SIZE;
+    float* const clips = scalesY + KERNEL_CHUNK_SIZE;
+
+    size_t quadCount = 0;
+    for (size_t first = begin; first < end; first += KERNEL_CHUNK_SIZE)
+    {
+        const size_t count = std::min(KERNEL_CHUNK_SIZE, end - first);
+
+        kernel::InstanceSpan span;
+        span.count = count;
+        span.x = _positionColumn(columns.x, indices, first, count, cameraPos.x, xs);
+        span.y = _positionColumn(columns.y, indices, first, count, cameraPos.y, ys);
+        span.angle = _floatColumn(columns.angle, indices, first, count, angles);
+        span.scaleX = _floatColumn(columns.scaleX, indices, first, count, scalesX);
+        span.scaleY = columns.scaleY.data == columns.scaleX.data
+                          ? span.scaleX
+                          : _floatColumn(columns.scaleY, indices, first, count, scalesY);
+        for (int k = 0; k < 4; ++k)
+        {
+            span.clip[k] = _floatColumn(
+                columns.clip[k], indices, first, count, clips + k * KERNEL_CHUNK_SIZE
+            );
+        }
+        if (columns.colors && indices)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint8_t* color =
+                    columns.colors + static_cast<int64_t>(indices[first + i]) * columns.colorStride;
+                for (int c = 0; c < 4; ++c)
+                    colorScratch[i * 4 + c] = color[c * columns.channelStride];
+            }
+            span.colors = colorScratch.data();
+            span.colorStride = 4;
+            span.channelStride = 1;
+        }
+        else if (columns.colors)
+        {
+            span.colors = columns.colors + static_cast<int64_t>(first) * columns.colorStride;
+            span.colorStride = columns.colorStride;
+            span.channelStride = columns.channelStride;
+        }
 
-    const double texW = texture.getWidth();
-    const double texH = texture.getHeight();
+        quadCount += kernel::generateQuads(params, span, out + quadCount * 4);
+    }
 
-    const auto t_u1 = static_cast<float>(textureClipArea.x / texW);
-    const auto t_v1 = static_cast<float>(textureClipArea.y / texH);
-    const auto t_u2 = static_cast<float>(textureClipArea.getRight() / texW);
-    const auto t_v2 = static_cast<float>(textureClipArea.getBottom() / texH);
+    return quadCount;
+}
 
-    std::vector<SDL_Vertex>* pVertices;
-    std::vector<int>* pIndices;
-    std::vector<SDL_Vertex> localVertices;
-    std::vector<int> localIndices;
+template <typename T>
+static void _drawInstances(
+    const _SpriteSource& source, const _InstanceColumns<T>& columns, const Vec2& anchor,
+    const Vec2& pivot, Batcher* batcher, const int layer, const double depth
+)
+{
+    const size_t n = columns.count;
+    const Rect& baseClipArea = source.clipArea;
+    if (n == 0 || baseClipArea.w <= 0.0 || baseClipArea.h <= 0.0 || source.color.a == 0.0f)
+        return;
 
-    if (batcher)
+    const camera::View& view = camera::getView();
+    const Vec2& rendRes = view.resolution;
+    const bool hasClip = columns.clip[0].data != nullptr;
+
+    kernel::BatchParams params;
+    params.m00 = static_cast<float>(view.cos * view.zoom);
+    params.m01 = static_cast<float>(-view.sin * view.zoom);
+    params.m10 = static_cast<float>(view.sin * view.zoom);
+    params.m11 = static_cast<float>(view.cos * view.zoom);
+    params.tx = static_cast<float>(view.center.x);
+    params.ty = static_cast<float>(view.center.y);
+    params.cameraAngle = static_cast<float>(view.angle);
+    params.zoom = static_cast<float>(view.zoom);
+    const Vec2 cameraPos = view.pos;
+    params.anchorX = static_cast<float>(anchor.x);
+    params.anchorY = static_cast<float>(anchor.y);
+    params.pivotX = static_cast<float>(pivot.x);
+    params.pivotY = static_cast<float>(pivot.y);
+    // Per-instance clip rects are offsets from the clip origin
+    params.clipX = static_cast<float>(hasClip ? source.clipOrigin.x : baseClipArea.x);
+    params.clipY = static_cast<float>(hasClip ? source.clipOrigin.y : baseClipArea.y);
+    params.clipW = static_cast<float>(baseClipArea.w);
+    params.clipH = static_cast<float>(baseClipArea.h);
+    params.invTexW = 1.0f / static_cast<float>(source.texture.getWidth());
+    params.invTexH = 1.0f / static_cast<float>(source.texture.getHeight());
+    params.flipH = source.flip.h;
+    params.flipV = source.flip.v;
+    params.color = source.color;
+    params.viewW = static_cast<float>(rendRes.x);
+    params.viewH = static_cast<float>(rendRes.y);
+
+    static std::vector<uint32_t> visible;
+    bool culled = false;
+    if (n >= _cullGridThreshold)
     {
-        batcher->vertices.clear();
-        batcher->indices.clear();
-        pVertices = &batcher->vertices;
-        pIndices = &batcher->indices;
+        const Vec2 factors = _extentFactors(anchor, pivot);
+        culled = _cullGrid(
+            n, view,
+            [&](const size_t i) { return Vec2{columns.x.get(i, 0.0), columns.y.get(i, 0.0)}; },
+            [&](const size_t i)
+            {
+                const double scaleX = columns.scaleX.get(i, 1.0);
+                const double scaleY = columns.scaleY.get(i, scaleX);
+                const double clipW = columns.clip[2].get(i, baseClipArea.w);
+                const double clipH = columns.clip[3].get(i, baseClipArea.h);
+                return std::abs(clipW * scaleX) * factors.x + std::abs(clipH * scaleY) * factors.y;
+            },
+            visible
+        );
     }
-    else
+    const uint32_t* indices = culled ? visible.data() : nullptr;
+    const size_t count = culled ? visible.size() : n;
+
+    // Sized, not cleared, so reused buffers are not zero-filled on every call
+    std::vector<SDL_Vertex>& vertices = _vertexBuffer(batcher);
+    if (vertices.size() < count * 4)
+        vertices.resize(count * 4);
+
+    const size_t threadCount = worker_pool::getThreadCount();
+    if (count == 0 || count < _parallelBatchThreshold || threadCount <= 1)
     {
-        localVertices.reserve(n * 4);
-        localIndices.reserve(n * 6);
-        pVertices = &localVertices;
-        pIndices = &localIndices;
+        const size_t quadCount =
+            _generateRange(params, columns, cameraPos, indices, 0, count, vertices.data());
+        stats::countSprites(quadCount, n - quadCount);
+        _submitBatch(source.texture.getSDL(), vertices.data(), quadCount, layer, depth);
+        return;
     }
 
-    const double* data = arr.data();
+    // Each range writes to its own slice of the buffer at the offset it would have without
+    // culling. A few ranges per thread even out uneven culling across the batch.
+    const size_t chunkCount = (count + KERNEL_CHUNK_SIZE - 1) / KERNEL_CHUNK_SIZE;
+    const size_t rangeCount = std::min(threadCount * 4, chunkCount);
+    const size_t rangeSize = (chunkCount + rangeCount - 1) / rangeCount * KERNEL_CHUNK_SIZE;
 
-    std::vector<SDL_Vertex>& vertices = *pVertices;
-    std::vector<int>& indices = *pIndices;
+    static std::vector<size_t> rangeQuads;
+    rangeQuads.assign(rangeCount, 0);
 
-    for (size_t i = 0; i < n; ++i)
-    {
-        const double* row = data + i * cols;
-        const Vec2 pos = camera::worldToScreen(Vec2{row[0], row[1]});
-        const double angle = ((cols >= 3) ? row[2] : 0.0) + cameraAngle;
+    worker_pool::run(
+        rangeCount,
+        [&](const size_t range)
+        {
+            const size_t begin = std::min(range * rangeSize, count);
+            const size_t end = std::min(begin + rangeSize, count);
+            rangeQuads[range] = _generateRange(
+                params, columns, cameraPos, indices, begin, end, vertices.data() + begin * 4
+            );
+        }
+    );
 
-        Vec2 scale{1.0};
-        if (cols >= 4)
+    // Close the gaps left by culled instances, keeping instance order
+    size_t quadCount = 0;
+    for (size_t range = 0; range < rangeCount; ++range)
+    {
+        const size_t begin = std::min(range * rangeSize, count);
+        if (quadCount != begin && rangeQuads[range] > 0)
         {
-            scale.x = row[3];
-            scale.y = (cols == 4) ? scale.x : row[4];
+            std::memmove(
+                vertices.data() + quadCount * 4, vertices.data() + begin * 4,
+                rangeQuads[range] * 4 * sizeof(SDL_Vertex)
+            );
         }
+        quadCount += rangeQuads[range];
+    }
 
-        if (scale.isZero())
-            continue;
+    stats::countSprites(quadCount, n - quadCount);
+    _submitBatch(source.texture.getSDL(), vertices.data(), quadCount, layer, depth);
+}
 
-        Rect clipArea = (cols == 9) ? Rect{row[5], row[6], row[7], row[8]} : textureClipArea;
+template <typename T>
+static void _setColors(_InstanceColumns<T>& columns, const ColorArray& colors)
+{
+    if (!colors.is_valid())
+        return;
 
-        if (clipArea.w <= 0.0 || clipArea.h <= 0.0)
-            continue;
+    if (colors.shape(0) != columns.count || colors.shape(1) != 4)
+        throw std::invalid_argument("Expected colors array with shape (N, 4)");
 
-        const Vec2 clipSize = clipArea.getSize();
+    columns.colors = colors.data();
+    columns.colorStride = colors.stride(0);
+    columns.channelStride = colors.stride(1);
+}
 
-        Rect dstRect{0.0, 0.0, clipSize * scale};
-        dstRect.setTopLeft(pos - (dstRect.getSize() * anchor));
+template <typename Source, typename T>
+static void drawBatchNDArray(
+    const Source& source, InstanceArray<T> arr, const Vec2& anchor, const Vec2& pivot,
+    Batcher* batcher, const ColorArray& colors, const int layer, const double depth
+)
+{
+    const stats::DrawScope drawScope;
+    const size_t n = arr.shape(0);
+    const size_t cols = arr.shape(1);
 
-        const Rect cullRect = _rotatedBounds(dstRect, angle, pivot);
-        if (cullRect.getRight() < 0.0 || cullRect.x >= rendRes.x || cullRect.getBottom() < 0.0 ||
-            cullRect.y >= rendRes.y)
-            continue;
+    if (n == 0)
+        return;
 
-        float u1, v1, u2, v2;
-        if (cols == 9)
-        {
-            u1 = static_cast<float>(clipArea.x / texW);
-            v1 = static_cast<float>(clipArea.y / texH);
-            u2 = static_cast<float>(clipArea.getRight() / texW);
-            v2 = static_cast<float>(clipArea.getBottom() / texH);
-        }
-        else
-        {
-            u1 = t_u1;
-            v1 = t_v1;
-            u2 = t_u2;
-            v2 = t_v2;
-        }
+    if (cols < 2 || (cols > 5 && cols != 9))
+        throw std::invalid_argument(
+            "Expected array with 2-5 or 9 columns: [x, y, (angle), (scale or scale_x, scale_y), "
+            "(clip_left, clip_top, clip_width, clip_height)]"
+        );
 
-        if (texture.flip.h)
-            std::swap(u1, u2);
-        if (texture.flip.v)
-            std::swap(v1, v2);
+    const T* data = arr.data();
+    const auto stride = static_cast<int64_t>(cols);
 
-        const double pivotX = dstRect.w * pivot.x;
-        const double pivotY = dstRect.h * pivot.y;
+    _InstanceColumns<T> columns;
+    columns.count = n;
+    columns.x = {data, stride};
+    columns.y = {data + 1, stride};
+    if (cols >= 3)
+        columns.angle = {data + 2, stride};
+    if (cols >= 4)
+    {
+        columns.scaleX = {data + 3, stride};
+        columns.scaleY = (cols == 4) ? columns.scaleX : _Column<T>{data + 4, stride};
+    }
+    if (cols == 9)
+    {
+        for (int k = 0; k < 4; ++k)
+            columns.clip[k] = {data + 5 + k, stride};
+    }
+    _setColors(columns, colors);
 
-        const auto dx = static_cast<float>(dstRect.x + pivotX);
-        const auto dy = static_cast<float>(dstRect.y + pivotY);
+    _drawInstances(_spriteSource(source), columns, anchor, pivot, batcher, layer, depth);
+}
 
-        const auto x1 = static_cast<float>(-pivotX);
-        const auto y1 = static_cast<float>(-pivotY);
-        const auto x2 = static_cast<float>(dstRect.w - pivotX);
-        const auto y2 = static_cast<float>(dstRect.h - pivotY);
+template <typename T>
+static _Column<T> _column(const ColumnArray<T>& arr, const size_t count, const char* name)
+{
+    if (!arr.is_valid())
+        return {};
 
-        const int base = static_cast<int>(vertices.size());
+    if (arr.shape(0) != count)
+        throw std::invalid_argument(
+            std::string("Column '") + name + "' length does not match the length of 'x'"
+        );
 
-        if (angle == 0.0)
-        {
-            vertices.push_back({{dx + x1, dy + y1}, vertexColor, {u1, v1}});
-            vertices.push_back({{dx + x2, dy + y1}, vertexColor, {u2, v1}});
-            vertices.push_back({{dx + x2, dy + y2}, vertexColor, {u2, v2}});
-            vertices.push_back({{dx + x1, dy + y2}, vertexColor, {u1, v2}});
-        }
-        else
-        {
-            const auto c = static_cast<float>(std::cos(angle));
-            const auto s = static_cast<float>(std::sin(angle));
+    return {arr.data(), arr.stride(0)};
+}
 
-            vertices.push_back(
-                {{dx + x1 * c - y1 * s, dy + x1 * s + y1 * c}, vertexColor, {u1, v1}}
-            );
-            vertices.push_back(
-                {{dx + x2 * c - y1 * s, dy + x2 * s + y1 * c}, vertexColor, {u2, v1}}
-            );
-            vertices.push_back(
-                {{dx + x2 * c - y2 * s, dy + x2 * s + y2 * c}, vertexColor, {u2, v2}}
-            );
-            vertices.push_back(
-                {{dx + x1 * c - y2 * s, dy + x1 * s + y2 * c}, vertexColor, {u1, v2}}
-            );
-        }
+template <typename Source, typename T>
+static void drawBatchColumns(
+    const Source& source, const ColumnArray<T>& x, const ColumnArray<T>& y,
+    const ColumnArray<T>& angle, const ColumnArray<T>& scaleX, const ColumnArray<T>& scaleY,
+    const ClipArray<T>& clip, const ColorArray& colors, const Vec2& anchor, const Vec2& pivot,
+    Batcher* batcher, const int layer, const double depth
+)
+{
+    const stats::DrawScope drawScope;
+    _InstanceColumns<T> columns;
+    columns.count = x.shape(0);
+    columns.x = _column(x, columns.count, "x");
+    columns.y = _column(y, columns.count, "y");
+    columns.angle = _column(angle, columns.count, "angle");
+    columns.scaleX = _column(scaleX, columns.count, "scale_x");
+    columns.scaleY = scaleY.is_valid() ? _column(scaleY, columns.count, "scale_y") : columns.scaleX;
+
+    if (clip.is_valid())
+    {
+        if (clip.shape(0) != columns.count || clip.shape(1) != 4)
+            throw std::invalid_argument("Expected clip array with shape (N, 4)");
 
-        indices.push_back(base);
-        indices.push_back(base + 1);
-        indices.push_back(base + 2);
-        indices.push_back(base);
-        indices.push_back(base + 2);
-        indices.push_back(base + 3);
+        for (int k = 0; k < 4; ++k)
+            columns.clip[k] = {clip.data() + k * clip.stride(1), clip.stride(0)};
     }
+    _setColors(columns, colors);
 
-    if (vertices.empty())
-        return;
+    _drawInstances(_spriteSource(source), columns, anchor, pivot, batcher, layer, depth);
+}
 
-    if (!SDL_RenderGeometry(
-            _renderer, sdlTexture, vertices.data(), static_cast<int>(vertices.size()),
-            indices.data(), static_cast<int>(indices.size())
-        ))
+// Test hook: runs the vertex kernel at a SIMD level, clamped to what the CPU supports, with an
+// identity camera and returns the corners of every emitted quad as flat x0, y0, ..., x3, y3 runs
+static std::vector<float> _generateQuadsAt(
+    const int level, const ColumnArray<float>& x, const ColumnArray<float>& y,
+    const ColumnArray<float>& angle, const ColumnArray<float>& scale, const Vec2& clipSize,
+    const Vec2& viewSize
+)
+{
+    if (level < 0 || level > static_cast<int>(kernel::SimdLevel::AVX2))
+        throw std::invalid_argument("SIMD level must be 0 (scalar), 1 (SSE4.1) or 2 (AVX2)");
+
+    _InstanceColumns<float> columns;
+    columns.count = x.shape(0);
+    columns.x = _column(x, columns.count, "x");
+    columns.y = _column(y, columns.count, "y");
+    columns.angle = _column(angle, columns.count, "angle");
+    columns.scaleX = _column(scale, columns.count, "scale");
+    columns.scaleY = columns.scaleX;
+
+    kernel::BatchParams params;
+    params.clipW = static_cast<float>(clipSize.x);
+    params.clipH = static_cast<float>(clipSize.y);
+    params.viewW = static_cast<float>(viewSize.x);
+    params.viewH = static_cast<float>(viewSize.y);
+
+    std::vector<SDL_Vertex> vertices(columns.count * 4);
+    const kernel::SimdLevel previous = kernel::getSimdLevel();
+    kernel::setSimdLevel(static_cast<kernel::SimdLevel>(level));
+    const size_t quadCount =
+        _generateRange(params, columns, {}, nullptr, 0, columns.count, vertices.data());
+    kernel::setSimdLevel(previous);
+
+    std::vector<float> corners;
+    corners.reserve(quadCount * 8);
+    for (size_t i = 0; i < quadCount * 4; ++i)
     {
-        throw std::runtime_error("Failed to render geometry: " + std::string(SDL_GetError()));
+        corners.push_back(vertices[i].position.x);
+        corners.push_back(vertices[i].position.y);
     }
+    return corners;
 }
 
 void _bind(nb::module_& module)
@@ -777,7 +1843,11 @@ void _bind(nb::module_& module)
         .value("LEGACY", RenderBackend::Legacy, "Use the legacy OpenGL backend.")
         .value("VULKAN", RenderBackend::Vulkan, "Use the Vulkan backend.")
         .value("METAL", RenderBackend::Metal, "Use the Metal backend.")
-        .value("DIRECT3D12", RenderBackend::Direct3d12, "Use the Direct3D 12 backend.");
+        .value("DIRECT3D12", RenderBackend::Direct3d12, "Use the Direct3D 12 backend.")
+        .value(
+            "SOFTWARE", RenderBackend::Software,
+            "Use SDL's CPU renderer, for example for headless capture with no GPU."
+        );
 
     auto subRenderer = module.def_submodule("renderer", "Functions for rendering graphics");
 
@@ -794,8 +1864,44 @@ Args:
         )doc")
         .def("free", &Batcher::free, R"doc(
 Free the allocated internal memory.
+        )doc")
+        .def_prop_ro("capacity", &Batcher::getCapacity, R"doc(
+The number of sprites the buffer can hold without reallocating.
         )doc");
 
+    _bindStaticBatch(subRenderer);
+    _bindCachedLayer(subRenderer);
+    _bindFrameCapture(subRenderer);
+
+    nb::class_<FrameStats>(subRenderer, "FrameStats", R"doc(
+Renderer work done during one frame, from one present() to the next.
+        )doc")
+        .def_ro(
+            "draw_calls", &FrameStats::drawCalls,
+            "Draw calls made, not counting draws they make internally."
+        )
+        .def_ro("geometry_calls", &FrameStats::geometryCalls, "Geometry submissions sent to SDL.")
+        .def_ro(
+            "primitive_calls", &FrameStats::primitiveCalls,
+            "Point and line submissions sent to SDL."
+        )
+        .def_ro("vertices", &FrameStats::vertices, "Vertices submitted.")
+        .def_ro("indices", &FrameStats::indices, "Indices submitted.")
+        .def_ro("sprites_drawn", &FrameStats::spritesDrawn, "Sprites that reached the screen.")
+        .def_ro(
+            "sprites_culled", &FrameStats::spritesCulled,
+            "Sprites and tiles skipped because they were off screen."
+        )
+        .def_ro("target_switches", &FrameStats::targetSwitches, "Render target changes.")
+        .def_ro(
+            "texture_switches", &FrameStats::textureSwitches,
+            "Texture changes between geometry submissions."
+        )
+        .def_ro(
+            "cpu_time_ms", &FrameStats::cpuTimeMs,
+            "Milliseconds spent inside draw calls and queue flushes."
+        );
+
     subRenderer.def("set_default_filter_mode", &setDefaultFilterMode, "filter"_a, R"doc(
 Set the default FilterMode for new textures. The factory default is FilterMode::Default.
 
@@ -883,11 +1989,128 @@ Raises:
     RuntimeError: If the texture is not a TARGET texture.
         )doc");
 
+    subRenderer.def("set_sorting_enabled", &setSortingEnabled, "enabled"_a, R"doc(
+Enable or disable sorted submission of queued draws.
+
+When enabled, draws are ordered by layer, then depth, then texture and blend mode before being
+submitted, so sprites from the same texture batch together even when their draw calls are
+interleaved. Draws with the same layer, depth and texture keep their call order. Lower layers and
+depths are drawn first. Shape drawing, text and render state changes (targets, viewports,
+shaders) submit everything queued so far, so they act as sort boundaries.
+
+Args:
+    enabled (bool): Whether to sort queued draws.
+    )doc");
+
+    subRenderer.def("is_sorting_enabled", &isSortingEnabled, R"doc(
+Check whether queued draws are sorted by layer, depth and texture before submission.
+
+Returns:
+    bool: True if sorting is enabled.
+    )doc");
+
+    subRenderer.def(
+        "set_parallel_batch_threshold", &setParallelBatchThreshold, "threshold"_a, R"doc(
+Set the instance count at which NumPy batches generate their vertices on multiple threads.
+
+Output is identical to the single-threaded path, including draw order within the batch.
+
+Args:
+    threshold (int): Minimum number of instances for a threaded batch. Defaults to 32768.
+        )doc"
+    );
+
+    subRenderer.def("get_parallel_batch_threshold", &getParallelBatchThreshold, R"doc(
+Get the instance count at which NumPy batches generate their vertices on multiple threads.
+
+Returns:
+    int: The current threshold.
+    )doc");
+
+    subRenderer.def("set_cull_grid_threshold", &setCullGridThreshold, "threshold"_a, R"doc(
+Set the instance count at which batches are culled through a grid before building vertices.
+
+Instances are binned by position into a uniform grid, and cells whose bounds miss the view are
+skipped without any per-sprite rotation math. This pays off for large batches that are mostly
+offscreen, such as the sprites of a big world. Draw order within the batch is kept.
+
+Args:
+    threshold (int): Minimum number of instances for grid culling. Defaults to 16384.
+    )doc");
+
+    subRenderer.def("get_cull_grid_threshold", &getCullGridThreshold, R"doc(
+Get the instance count at which batches are culled through a grid before building vertices.
+
+Returns:
+    int: The current threshold.
+    )doc");
+
+    subRenderer.def("set_batch_thread_count", &setBatchThreadCount, "count"_a, R"doc(
+Set how many threads generate vertices for batches above the parallel threshold.
+
+The count includes the calling thread, so 1 disables threading.
+
+Args:
+    count (int): Number of threads, or 0 to pick one per logical core (up to 8). Counts above
+        four threads per logical core are clamped.
+
+Raises:
+    ValueError: If count is negative.
+    )doc");
+
+    subRenderer.def("get_batch_thread_count", &getBatchThreadCount, R"doc(
+Get how many threads generate vertices for batches above the parallel threshold.
+
+Returns:
+    int: The number of threads, including the calling thread.
+    )doc");
+
+    subRenderer.def("get_frame_stats", &getFrameStats, R"doc(
+Get the renderer statistics of the last completed frame.
+
+Counters start over at every present(). When the engine is built with KRAKEN_FRAME_STATS off,
+all counters stay at zero.
+
+Returns:
+    FrameStats: Draw calls, submissions, culling and timing for the last frame.
+    )doc");
+
+    subRenderer.def("is_frame_stats_enabled", &isFrameStatsEnabled, R"doc(
+Check whether the engine was built with frame statistics.
+
+Returns:
+    bool: True if get_frame_stats() reports real counters.
+    )doc");
+
+    subRenderer.def(
+        "_generate_quads", &_generateQuadsAt, "level"_a, "x"_a, "y"_a, "angle"_a.none(),
+        "scale"_a.none(), "clip_size"_a, "view_size"_a, R"doc(
+Run the batch vertex kernel directly. Test hook for comparing the scalar and SIMD paths.
+
+Args:
+    level (int): 0 for scalar, 1 for SSE4.1 or 2 for AVX2, clamped to what the CPU supports.
+    x (ndarray): float32 x positions.
+    y (ndarray): float32 y positions.
+    angle (ndarray | None): float32 angles in radians.
+    scale (ndarray | None): float32 uniform scales.
+    clip_size (Vec2): Size of every quad before scaling.
+    view_size (Vec2): Size of the view quads are culled against.
+
+Returns:
+    list[float]: Eight corner coordinates per emitted quad, in instance order.
+
+Raises:
+    ValueError: If level is out of range or a column length differs from x.
+        )doc"
+    );
+
     subRenderer.def(
         "draw",
-        nb::overload_cast<const Texture&, const Transform&, const Vec2&, const Vec2&>(&draw),
+        nb::overload_cast<const Texture&, const Transform&, const Vec2&, const Vec2&, int, double>(
+            &draw
+        ),
         "texture"_a, "transform"_a = Transform{}, "anchor"_a = Anchor::TOP_LEFT,
-        "pivot"_a = Anchor::CENTER, R"doc(
+        "pivot"_a = Anchor::CENTER, "layer"_a = 0, "depth"_a = 0.0, R"doc(
 Render a texture.
 
 Args:
@@ -895,12 +2118,16 @@ Args:
     transform (Transform, optional): The transform (position, rotation, scale).
     anchor (Vec2, optional): The anchor point (0.0-1.0). Defaults to top left (0, 0).
     pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
+    layer (int, optional): Sort layer used when sorting is enabled. Defaults to 0.
+    depth (float, optional): Sort depth within the layer when sorting is enabled.
+        Defaults to 0.0.
         )doc"
     );
 
     subRenderer.def(
-        "draw", nb::overload_cast<const Texture&, Rect, double, const Vec2&>(&draw), "texture"_a,
-        "dst"_a, "angle"_a = 0.0, "pivot"_a = Anchor::CENTER, R"doc(
+        "draw", nb::overload_cast<const Texture&, Rect, double, const Vec2&, int, double>(&draw),
+        "texture"_a, "dst"_a, "angle"_a = 0.0, "pivot"_a = Anchor::CENTER, "layer"_a = 0,
+        "depth"_a = 0.0, R"doc(
 Render a texture stretched into a destination rectangle without a camera's transform applied.
 
 This is a simpler alternative to the transform-based draw when you only
@@ -912,12 +2139,83 @@ Args:
     dst (Rect): Destination rectangle on screen.
     angle (float, optional): The rotation angle in degrees. Defaults to 0.0.
     pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
+    layer (int, optional): Sort layer used when sorting is enabled. Defaults to 0.
+    depth (float, optional): Sort depth within the layer when sorting is enabled.
+        Defaults to 0.0.
+        )doc"
+    );
+
+    subRenderer.def(
+        "draw",
+        nb::overload_cast<
+            const TextureRegion&, const Transform&, const Vec2&, const Vec2&, int, double>(&draw),
+        "region"_a, "transform"_a = Transform{}, "anchor"_a = Anchor::TOP_LEFT,
+        "pivot"_a = Anchor::CENTER, "layer"_a = 0, "depth"_a = 0.0, R"doc(
+Render a texture region with its own source area, flip, tint and alpha.
+
+The texture's clip area, flip, tint and alpha are ignored and left unchanged. Regions of the same
+texture or atlas page are drawn in a single batch.
+
+Args:
+    region (TextureRegion | AtlasRegion): The region to render. Atlas regions are drawn at
+        their current placement.
+    transform (Transform, optional): The transform (position, rotation, scale).
+    anchor (Vec2, optional): The anchor point (0.0-1.0). Defaults to top left (0, 0).
+    pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
+    layer (int, optional): Sort layer used when sorting is enabled. Defaults to 0.
+    depth (float, optional): Sort depth within the layer when sorting is enabled.
+        Defaults to 0.0.
+
+Raises:
+    RuntimeError: If an atlas region has been removed from its atlas.
+        )doc"
+    );
+
+    // Atlas regions would also convert implicitly, but nanobind reports a failed conversion as a
+    // TypeError. Binding them directly keeps the RuntimeError for removed regions.
+    subRenderer.def(
+        "draw",
+        [](const AtlasRegion& region, const Transform& transform, const Vec2& anchor,
+           const Vec2& pivot, const int layer, const double depth)
+        { draw(region, transform, anchor, pivot, layer, depth); },
+        "region"_a, "transform"_a = Transform{}, "anchor"_a = Anchor::TOP_LEFT,
+        "pivot"_a = Anchor::CENTER, "layer"_a = 0, "depth"_a = 0.0
+    );
+
+    subRenderer.def(
+        "draw",
+        nb::overload_cast<const TextureRegion&, Rect, double, const Vec2&, int, double>(&draw),
+        "region"_a, "dst"_a, "angle"_a = 0.0, "pivot"_a = Anchor::CENTER, "layer"_a = 0,
+        "depth"_a = 0.0, R"doc(
+Render a texture region stretched into a destination rectangle without a camera's transform
+applied.
+
+Args:
+    region (TextureRegion | AtlasRegion): The region to render. Atlas regions are drawn at
+        their current placement.
+    dst (Rect): Destination rectangle on screen.
+    angle (float, optional): The rotation angle in degrees. Defaults to 0.0.
+    pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
+    layer (int, optional): Sort layer used when sorting is enabled. Defaults to 0.
+    depth (float, optional): Sort depth within the layer when sorting is enabled.
+        Defaults to 0.0.
+
+Raises:
+    RuntimeError: If an atlas region has been removed from its atlas.
         )doc"
     );
 
+    subRenderer.def(
+        "draw",
+        [](const AtlasRegion& region, const Rect dst, const double angle, const Vec2& pivot,
+           const int layer, const double depth) { draw(region, dst, angle, pivot, layer, depth); },
+        "region"_a, "dst"_a, "angle"_a = 0.0, "pivot"_a = Anchor::CENTER, "layer"_a = 0,
+        "depth"_a = 0.0
+    );
+
     subRenderer.def(
         "draw_9slice", &draw9Slice, "texture"_a, "dst"_a, "slice"_a, "anchor"_a = Anchor::TOP_LEFT,
-        "pivot"_a = Anchor::CENTER, R"doc(
+        "pivot"_a = Anchor::CENTER, "layer"_a = 0, "depth"_a = 0.0, R"doc(
 Render a texture using 9-slice scaling (9-grid). The camera's transform is not applied to this draw.
 
 This divides the texture into 9 regions: 4 corners (unscaled), 4 edges (scaled in one axis),
@@ -929,12 +2227,19 @@ Args:
     slice (Rect): A rectangle defining the slice widths/heights (left_width, top_height, right_width, bottom_height).
     anchor (Vec2, optional): The anchor point. Defaults to top left.
     pivot (Vec2, optional): The rotation pivot. Defaults to center.
+    layer (int, optional): Sort layer used when sorting is enabled. Defaults to 0.
+    depth (float, optional): Sort depth within the layer when sorting is enabled.
+        Defaults to 0.0.
         )doc"
     );
 
     subRenderer.def(
-        "draw_batch", &drawBatch, "texture"_a, "transforms"_a, "anchor"_a = Anchor::TOP_LEFT,
-        "pivot"_a = Anchor::CENTER, "clip_rects"_a = nb::none(),
+        "draw_batch",
+        nb::overload_cast<
+            const Texture&, const std::vector<Transform>&, const Vec2&, const Vec2&,
+            const std::optional<std::vector<Rect>>&, Batcher*, int, double>(&drawBatch),
+        "texture"_a, "transforms"_a, "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER,
+        "clip_rects"_a = nb::none(), "batcher"_a = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
         nb::call_guard<nb::gil_scoped_release>(), R"doc(
 Render a texture multiple times with different transforms in a single batch call.
 
@@ -946,14 +2251,19 @@ Args:
     transforms (Sequence[Transform]): A list of transforms (position, rotation, scale).
     clip_rects (Sequence[Rect], optional): Per-instance clip rectangles. If provided, these override
         the texture's clip area for each instance. If None, all instances use the texture's clip area.
+    batcher (Batcher, optional): Pre-allocated rendering buffer for higher performance.
     anchor (Vec2, optional): The anchor point (0.0-1.0). Defaults to top left (0, 0).
     pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
+    layer (int, optional): Sort layer for the whole batch when sorting is enabled. Defaults to 0.
+    depth (float, optional): Sort depth for the whole batch when sorting is enabled.
+        Defaults to 0.0.
         )doc"
     );
 
     subRenderer.def(
-        "draw_batch", &drawBatchNDArray, "texture"_a, "transforms"_a, "anchor"_a = Anchor::TOP_LEFT,
-        "pivot"_a = Anchor::CENTER, "batcher"_a = nb::none(),
+        "draw_batch", &drawBatchNDArray<Texture, double>, "texture"_a, "transforms"_a,
+        "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER, "batcher"_a = nb::none(),
+        "colors"_a.none() = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
         nb::call_guard<nb::gil_scoped_release>(), R"doc(
 Render a texture multiple times using a NumPy array for maximum throughput. This is *the* fastest way to render large batches of sprites,
 being significantly faster than the list-based draw_batch() due to no-copy viewing of contiguous array data.
@@ -967,18 +2277,211 @@ the layout:
 - **5 columns** ``[x, y, angle, scale_x, scale_y]`` — full transform.
 - **9 columns** ``[x, y, angle, scale_x, scale_y, clip_left, clip_top, clip_width, clip_height]`` — full transform + per-instance clip rect.
 
+Both float32 and float64 arrays are viewed without copying.
+
+Args:
+    texture (Texture): The texture to render.
+    transforms (numpy.ndarray): float32 or float64 array with shape ``(N, 2|3|4|5|9)``.
+    anchor (Vec2, optional): The anchor point (0.0-1.0). Defaults to top left (0, 0).
+    pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
+    batcher (Batcher, optional): Pre-allocated rendering buffer for higher performance.
+    colors (numpy.ndarray, optional): uint8 array with shape ``(N, 4)`` of per-instance RGBA values,
+        multiplied with the texture's tint and alpha.
+    layer (int, optional): Sort layer for the whole batch when sorting is enabled. Defaults to 0.
+    depth (float, optional): Sort depth for the whole batch when sorting is enabled.
+        Defaults to 0.0.
+
+Raises:
+    ValueError: If the array does not have 2, 3, 4, 5, or 9 columns, or colors is not ``(N, 4)``.
+        )doc"
+    );
+
+    subRenderer.def(
+        "draw_batch", &drawBatchNDArray<Texture, float>, "texture"_a, "transforms"_a,
+        "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER, "batcher"_a = nb::none(),
+        "colors"_a.none() = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>()
+    );
+
+    subRenderer.def(
+        "draw_batch",
+        nb::overload_cast<
+            const TextureRegion&, const std::vector<Transform>&, const Vec2&, const Vec2&,
+            const std::optional<std::vector<Rect>>&, Batcher*, int, double>(&drawBatch),
+        "region"_a, "transforms"_a, "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER,
+        "clip_rects"_a = nb::none(), "batcher"_a = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>(), R"doc(
+Render a texture region multiple times with different transforms in a single batch call.
+
+Args:
+    region (TextureRegion | AtlasRegion): The region to render. Atlas regions are drawn at
+        their current placement.
+    transforms (Sequence[Transform]): A list of transforms (position, rotation, scale).
+    anchor (Vec2, optional): The anchor point (0.0-1.0). Defaults to top left (0, 0).
+    pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
+    clip_rects (Sequence[Rect], optional): Per-instance clip rectangles relative to the region's
+        top left corner. If None, all instances draw the whole region.
+    batcher (Batcher, optional): Pre-allocated rendering buffer for higher performance.
+    layer (int, optional): Sort layer for the whole batch when sorting is enabled. Defaults to 0.
+    depth (float, optional): Sort depth for the whole batch when sorting is enabled.
+        Defaults to 0.0.
+
+Raises:
+    RuntimeError: If an atlas region has been removed from its atlas.
+        )doc"
+    );
+
+    subRenderer.def(
+        "draw_batch",
+        [](const AtlasRegion& region, const std::vector<Transform>& transforms, const Vec2& anchor,
+           const Vec2& pivot, const std::optional<std::vector<Rect>>& clipRects, Batcher* batcher,
+           const int layer, const double depth)
+        { drawBatch(region, transforms, anchor, pivot, clipRects, batcher, layer, depth); },
+        "region"_a, "transforms"_a, "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER,
+        "clip_rects"_a = nb::none(), "batcher"_a = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>()
+    );
+
+    subRenderer.def(
+        "draw_batch", &drawBatchNDArray<TextureRegion, double>, "region"_a, "transforms"_a,
+        "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER, "batcher"_a = nb::none(),
+        "colors"_a.none() = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>(), R"doc(
+Render a texture region multiple times using a NumPy array.
+
+The array layout matches the texture overload. With 9 columns, the clip rect columns are
+relative to the region's top left corner.
+
+Args:
+    region (TextureRegion | AtlasRegion): The region to render. Atlas regions are drawn at
+        their current placement.
+    transforms (numpy.ndarray): float32 or float64 array with shape ``(N, 2|3|4|5|9)``.
+    anchor (Vec2, optional): The anchor point (0.0-1.0). Defaults to top left (0, 0).
+    pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
+    batcher (Batcher, optional): Pre-allocated rendering buffer for higher performance.
+    colors (numpy.ndarray, optional): uint8 array with shape ``(N, 4)`` of per-instance RGBA values,
+        multiplied with the region's tint and alpha.
+    layer (int, optional): Sort layer for the whole batch when sorting is enabled. Defaults to 0.
+    depth (float, optional): Sort depth for the whole batch when sorting is enabled.
+        Defaults to 0.0.
+
+Raises:
+    ValueError: If the array does not have 2, 3, 4, 5, or 9 columns, or colors is not ``(N, 4)``.
+    RuntimeError: If an atlas region has been removed from its atlas.
+        )doc"
+    );
+
+    subRenderer.def(
+        "draw_batch", &drawBatchNDArray<TextureRegion, float>, "region"_a, "transforms"_a,
+        "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER, "batcher"_a = nb::none(),
+        "colors"_a.none() = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>()
+    );
+
+    subRenderer.def(
+        "draw_batch", &drawBatchNDArray<AtlasRegion, double>, "region"_a, "transforms"_a,
+        "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER, "batcher"_a = nb::none(),
+        "colors"_a.none() = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>()
+    );
+
+    subRenderer.def(
+        "draw_batch", &drawBatchNDArray<AtlasRegion, float>, "region"_a, "transforms"_a,
+        "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER, "batcher"_a = nb::none(),
+        "colors"_a.none() = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>()
+    );
+
+    subRenderer.def(
+        "draw_batch_columns", &drawBatchColumns<Texture, double>, "texture"_a, "x"_a, "y"_a,
+        "angle"_a.none() = nb::none(), "scale_x"_a.none() = nb::none(),
+        "scale_y"_a.none() = nb::none(), "clip"_a.none() = nb::none(),
+        "colors"_a.none() = nb::none(), "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER,
+        "batcher"_a = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>(), R"doc(
+Render a texture multiple times from separate per-instance column arrays.
+
+This avoids interleaving structure-of-arrays simulation state into a single array. Columns may be
+strided views, such as ``state[:, 0]``, and are read without copying. All float columns must share
+one dtype, either float32 or float64.
+
 Args:
     texture (Texture): The texture to render.
-    transforms (numpy.ndarray): float64 array with shape ``(N, 2|3|4|5|9)``.
+    x (numpy.ndarray): 1D array of x positions.
+    y (numpy.ndarray): 1D array of y positions.
+    angle (numpy.ndarray, optional): 1D array of rotations in radians. Defaults to 0.
+    scale_x (numpy.ndarray, optional): 1D array of horizontal scales. Defaults to 1.
+    scale_y (numpy.ndarray, optional): 1D array of vertical scales. Defaults to scale_x.
+    clip (numpy.ndarray, optional): Array with shape ``(N, 4)`` of per-instance clip rects
+        ``[left, top, width, height]``. Defaults to the texture's clip area.
+    colors (numpy.ndarray, optional): uint8 array with shape ``(N, 4)`` of per-instance RGBA values,
+        multiplied with the texture's tint and alpha.
     anchor (Vec2, optional): The anchor point (0.0-1.0). Defaults to top left (0, 0).
     pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
     batcher (Batcher, optional): Pre-allocated rendering buffer for higher performance.
+    layer (int, optional): Sort layer for the whole batch when sorting is enabled. Defaults to 0.
+    depth (float, optional): Sort depth for the whole batch when sorting is enabled.
+        Defaults to 0.0.
+
+Raises:
+    ValueError: If a column's length differs from ``x`` or clip/colors is not ``(N, 4)``.
+        )doc"
+    );
+
+    subRenderer.def(
+        "draw_batch_columns", &drawBatchColumns<Texture, float>, "texture"_a, "x"_a, "y"_a,
+        "angle"_a.none() = nb::none(), "scale_x"_a.none() = nb::none(),
+        "scale_y"_a.none() = nb::none(), "clip"_a.none() = nb::none(),
+        "colors"_a.none() = nb::none(), "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER,
+        "batcher"_a = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>()
+    );
+
+    subRenderer.def(
+        "draw_batch_columns", &drawBatchColumns<TextureRegion, double>, "region"_a, "x"_a, "y"_a,
+        "angle"_a.none() = nb::none(), "scale_x"_a.none() = nb::none(),
+        "scale_y"_a.none() = nb::none(), "clip"_a.none() = nb::none(),
+        "colors"_a.none() = nb::none(), "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER,
+        "batcher"_a = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>(), R"doc(
+Render a texture region multiple times from separate per-instance column arrays.
+
+Takes the same columns as the texture overload, and an AtlasRegion in place of the region. Clip
+rects are relative to the region's top left corner.
 
 Raises:
-    ValueError: If the array does not have 2, 3, 4, 5, or 9 columns.
+    ValueError: If a column's length differs from ``x`` or clip/colors is not ``(N, 4)``.
+    RuntimeError: If an atlas region has been removed from its atlas.
         )doc"
     );
 
+    subRenderer.def(
+        "draw_batch_columns", &drawBatchColumns<TextureRegion, float>, "region"_a, "x"_a, "y"_a,
+        "angle"_a.none() = nb::none(), "scale_x"_a.none() = nb::none(),
+        "scale_y"_a.none() = nb::none(), "clip"_a.none() = nb::none(),
+        "colors"_a.none() = nb::none(), "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER,
+        "batcher"_a = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>()
+    );
+
+    subRenderer.def(
+        "draw_batch_columns", &drawBatchColumns<AtlasRegion, double>, "region"_a, "x"_a, "y"_a,
+        "angle"_a.none() = nb::none(), "scale_x"_a.none() = nb::none(),
+        "scale_y"_a.none() = nb::none(), "clip"_a.none() = nb::none(),
+        "colors"_a.none() = nb::none(), "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER,
+        "batcher"_a = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>()
+    );
+
+    subRenderer.def(
+        "draw_batch_columns", &drawBatchColumns<AtlasRegion, float>, "region"_a, "x"_a, "y"_a,
+        "angle"_a.none() = nb::none(), "scale_x"_a.none() = nb::none(),
+        "scale_y"_a.none() = nb::none(), "clip"_a.none() = nb::none(),
+        "colors"_a.none() = nb::none(), "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER,
+        "batcher"_a = nb::none(), "layer"_a = 0, "depth"_a = 0.0,
+        nb::call_guard<nb::gil_scoped_release>()
+    );
+
     subRenderer.def("read_pixels", &readPixels, "src"_a = Rect{}, R"doc(
 Read pixel data from the renderer within the specified rectangle.
 
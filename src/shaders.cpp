@@ -269,6 +269,8 @@ void Shader::_moveFrom(Shader& other) noexcept
 
 void Shader::bind() const
 {
+    renderer::_flush();
+
     if (!SDL_SetGPURenderState(renderer::_get(), m_renderState))
         throw std::runtime_error("Failed to bind shader state: " + std::string(SDL_GetError()));
 
@@ -283,6 +285,8 @@ void Shader::bind() const
 
 void Shader::unbind() const
 {
+    renderer::_flush();
+
     if (!SDL_SetGPURenderState(renderer::_get(), nullptr))
         throw std::runtime_error("Failed to unbind shader state: " + std::string(SDL_GetError()));
 }
@@ -496,6 +500,7 @@ Unbinds the current shader state, reverting to the default render state.
                     if (view.buf == nullptr || view.len < 0)
                         throw nb::type_error("Invalid buffer object");
 
+                    renderer::_flush();
                     SDL_SetGPURenderStateFragmentUniforms(
                         self.m_renderState, binding, view.buf, static_cast<uint32_t>(view.len)
                     );
@@ -0,0 +1,117 @@
+#include "_sprite_kernel.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace kn::renderer::kernel
+{
+static SimdLevel _detectSimdLevel()
+{
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    if (SDL_HasAVX2())
+        return SimdLevel::AVX2;
+    if (SDL_HasSSE41())
+        return SimdLevel::SSE41;
+#endif  // x86
+
+    return SimdLevel::Scalar;
+}
+
+static const SimdLevel _supportedLevel = _detectSimdLevel();
+static SimdLevel _activeLevel = _supportedLevel;
+
+size_t _generateQuadsScalar(
+    const BatchParams& params, const InstanceSpan& instances, const size_t begin,
+    const size_t end, SDL_Vertex* out
+)
+{
+    SDL_Vertex* const first = out;
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        const float worldX = instances.x[i];
+        const float worldY = instances.y[i];
+        const float angle = (instances.angle ? instances.angle[i] : 0.0f) + params.cameraAngle;
+        const float scaleX = instances.scaleX ? instances.scaleX[i] : 1.0f;
+        const float scaleY = instances.scaleY ? instances.scaleY[i] : scaleX;
+        const float clipW = instances.clip[2] ? instances.clip[2][i] : params.clipW;
+        const float clipH = instances.clip[3] ? instances.clip[3][i] : params.clipH;
+
+        // Written so NaN fails each test, like the ordered compares of the SIMD paths
+        if (!(std::abs(scaleX) >= 1e-8f || std::abs(scaleY) >= 1e-8f))
+            continue;
+        if (!(clipW > 0.0f && clipH > 0.0f))
+            continue;
+
+        const float posX = params.m00 * worldX + params.m01 * worldY + params.tx;
+        const float posY = params.m10 * worldX + params.m11 * worldY + params.ty;
+
+        const float w = clipW * scaleX * params.zoom;
+        const float h = clipH * scaleY * params.zoom;
+        const float pivotOffX = w * params.pivotX;
+        const float pivotOffY = h * params.pivotY;
+        const float originX = posX - w * params.anchorX + pivotOffX;
+        const float originY = posY - h * params.anchorY + pivotOffY;
+
+        const float localX[4] = {-pivotOffX, w - pivotOffX, w - pivotOffX, -pivotOffX};
+        const float localY[4] = {-pivotOffY, -pivotOffY, h - pivotOffY, h - pivotOffY};
+
+        float c = 1.0f;
+        float s = 0.0f;
+        if (angle != 0.0f)
+        {
+            c = std::cos(angle);
+            s = std::sin(angle);
+        }
+
+        float x[4], y[4];
+        for (int k = 0; k < 4; ++k)
+        {
+            x[k] = originX + localX[k] * c - localY[k] * s;
+            y[k] = originY + localX[k] * s + localY[k] * c;
+        }
+
+        // A NaN corner, from a NaN position or angle or from inf - inf, culls the instance.
+        // Checked up front because min and max pick different operands around NaN per path.
+        bool ordered = true;
+        for (int k = 0; k < 4; ++k)
+            ordered = ordered && x[k] == x[k] && y[k] == y[k];
+        if (!ordered)
+            continue;
+
+        const float minX = std::min(std::min(x[0], x[1]), std::min(x[2], x[3]));
+        const float maxX = std::max(std::max(x[0], x[1]), std::max(x[2], x[3]));
+        const float minY = std::min(std::min(y[0], y[1]), std::min(y[2], y[3]));
+        const float maxY = std::max(std::max(y[0], y[1]), std::max(y[2], y[3]));
+        if (!(maxX >= 0.0f && minX < params.viewW && maxY >= 0.0f && minY < params.viewH))
+            continue;
+
+        out = _emitQuad(out, params, instances, i, x, y);
+    }
+
+    return static_cast<size_t>(out - first) / 4;
+}
+
+size_t generateQuads(const BatchParams& params, const InstanceSpan& instances, SDL_Vertex* out)
+{
+    switch (_activeLevel)
+    {
+    case SimdLevel::AVX2:
+        return _generateQuadsAVX2(params, instances, 0, instances.count, out);
+    case SimdLevel::SSE41:
+        return _generateQuadsSSE41(params, instances, 0, instances.count, out);
+    default:
+        return _generateQuadsScalar(params, instances, 0, instances.count, out);
+    }
+}
+
+SimdLevel getSimdLevel()
+{
+    return _activeLevel;
+}
+
+void setSimdLevel(const SimdLevel level)
+{
+    _activeLevel = std::min(level, _supportedLevel);
+}
+}  // namespace kn::renderer::kernel
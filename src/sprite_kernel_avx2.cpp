@@ -0,0 +1,148 @@
+#include "_sprite_kernel.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+
+namespace kn::renderer::kernel
+{
+namespace
+{
+struct AVX2
+{
+    using Float = __m256;
+    static constexpr size_t width = 8;
+
+    static Float set1(const float value)
+    {
+        return _mm256_set1_ps(value);
+    }
+    static Float load(const float* src)
+    {
+        return _mm256_loadu_ps(src);
+    }
+    static void store(float* dst, const Float value)
+    {
+        _mm256_store_ps(dst, value);
+    }
+    static Float add(const Float a, const Float b)
+    {
+        return _mm256_add_ps(a, b);
+    }
+    static Float sub(const Float a, const Float b)
+    {
+        return _mm256_sub_ps(a, b);
+    }
+    static Float mul(const Float a, const Float b)
+    {
+        return _mm256_mul_ps(a, b);
+    }
+    static Float min(const Float a, const Float b)
+    {
+        return _mm256_min_ps(a, b);
+    }
+    static Float max(const Float a, const Float b)
+    {
+        return _mm256_max_ps(a, b);
+    }
+    static Float abs(const Float a)
+    {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+    }
+    static Float bitAnd(const Float a, const Float b)
+    {
+        return _mm256_and_ps(a, b);
+    }
+    static Float bitOr(const Float a, const Float b)
+    {
+        return _mm256_or_ps(a, b);
+    }
+    static Float cmpGe(const Float a, const Float b)
+    {
+        return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+    }
+    static Float cmpGt(const Float a, const Float b)
+    {
+        return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+    }
+    static Float cmpLt(const Float a, const Float b)
+    {
+        return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+    }
+    static int movemask(const Float a)
+    {
+        return _mm256_movemask_ps(a);
+    }
+
+    // Cephes style sincos: reduce to [-pi/4, pi/4] by octant, then pick the sine or cosine
+    // polynomial per lane. Accurate to about 1e-7 for the angle range sprites use.
+    static void sincos(Float x, Float& s, Float& c)
+    {
+        const __m256 signMask = _mm256_set1_ps(-0.0f);
+        __m256 signSin = _mm256_and_ps(x, signMask);
+        x = _mm256_andnot_ps(signMask, x);
+
+        const __m256i one = _mm256_set1_epi32(1);
+        const __m256i two = _mm256_set1_epi32(2);
+        const __m256i four = _mm256_set1_epi32(4);
+
+        __m256i octant = _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(1.27323954473516f)));
+        octant = _mm256_and_si256(_mm256_add_epi32(octant, one), _mm256_set1_epi32(~1));
+        const __m256 y = _mm256_cvtepi32_ps(octant);
+
+        const __m256 swapSignSin =
+            _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(octant, four), 29));
+        const __m256 polyMask = _mm256_castsi256_ps(
+            _mm256_cmpeq_epi32(_mm256_and_si256(octant, two), _mm256_setzero_si256())
+        );
+        const __m256 signCos = _mm256_castsi256_ps(
+            _mm256_slli_epi32(_mm256_andnot_si256(_mm256_sub_epi32(octant, two), four), 29)
+        );
+        signSin = _mm256_xor_ps(signSin, swapSignSin);
+
+        x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(0.78515625f)));
+        x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(2.4187564849853515625e-4f)));
+        x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(3.77489497744594108e-8f)));
+
+        const __m256 z = _mm256_mul_ps(x, x);
+
+        __m256 cosPoly = _mm256_set1_ps(2.443315711809948e-5f);
+        cosPoly = _mm256_add_ps(_mm256_mul_ps(cosPoly, z), _mm256_set1_ps(-1.388731625493765e-3f));
+        cosPoly = _mm256_add_ps(_mm256_mul_ps(cosPoly, z), _mm256_set1_ps(4.166664568298827e-2f));
+        cosPoly = _mm256_mul_ps(_mm256_mul_ps(cosPoly, z), z);
+        cosPoly = _mm256_sub_ps(cosPoly, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+        cosPoly = _mm256_add_ps(cosPoly, _mm256_set1_ps(1.0f));
+
+        __m256 sinPoly = _mm256_set1_ps(-1.9515295891e-4f);
+        sinPoly = _mm256_add_ps(_mm256_mul_ps(sinPoly, z), _mm256_set1_ps(8.3321608736e-3f));
+        sinPoly = _mm256_add_ps(_mm256_mul_ps(sinPoly, z), _mm256_set1_ps(-1.6666654611e-1f));
+        sinPoly = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(sinPoly, z), x), x);
+
+        s = _mm256_xor_ps(_mm256_blendv_ps(cosPoly, sinPoly, polyMask), signSin);
+        c = _mm256_xor_ps(_mm256_blendv_ps(sinPoly, cosPoly, polyMask), signCos);
+    }
+};
+}  // namespace
+
+size_t _generateQuadsAVX2(
+    const BatchParams& params, const InstanceSpan& instances, const size_t begin,
+    const size_t end, SDL_Vertex* out
+)
+{
+    return _generateQuadsSimd<AVX2>(params, instances, begin, end, out);
+}
+}  // namespace kn::renderer::kernel
+
+#else
+
+namespace kn::renderer::kernel
+{
+size_t _generateQuadsAVX2(
+    const BatchParams& params, const InstanceSpan& instances, const size_t begin,
+    const size_t end, SDL_Vertex* out
+)
+{
+    return _generateQuadsScalar(params, instances, begin, end, out);
+}
+}  // namespace kn::renderer::kernel
+
+#endif  // x86
@@ -0,0 +1,144 @@
+#include "_sprite_kernel.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <smmintrin.h>
+
+namespace kn::renderer::kernel
+{
+namespace
+{
+struct SSE41
+{
+    using Float = __m128;
+    static constexpr size_t width = 4;
+
+    static Float set1(const float value)
+    {
+        return _mm_set1_ps(value);
+    }
+    static Float load(const float* src)
+    {
+        return _mm_loadu_ps(src);
+    }
+    static void store(float* dst, const Float value)
+    {
+        _mm_store_ps(dst, value);
+    }
+    static Float add(const Float a, const Float b)
+    {
+        return _mm_add_ps(a, b);
+    }
+    static Float sub(const Float a, const Float b)
+    {
+        return _mm_sub_ps(a, b);
+    }
+    static Float mul(const Float a, const Float b)
+    {
+        return _mm_mul_ps(a, b);
+    }
+    static Float min(const Float a, const Float b)
+    {
+        return _mm_min_ps(a, b);
+    }
+    static Float max(const Float a, const Float b)
+    {
+        return _mm_max_ps(a, b);
+    }
+    static Float abs(const Float a)
+    {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+    }
+    static Float bitAnd(const Float a, const Float b)
+    {
+        return _mm_and_ps(a, b);
+    }
+    static Float bitOr(const Float a, const Float b)
+    {
+        return _mm_or_ps(a, b);
+    }
+    static Float cmpGe(const Float a, const Float b)
+    {
+        return _mm_cmpge_ps(a, b);
+    }
+    static Float cmpGt(const Float a, const Float b)
+    {
+        return _mm_cmpgt_ps(a, b);
+    }
+    static Float cmpLt(const Float a, const Float b)
+    {
+        return _mm_cmplt_ps(a, b);
+    }
+    static int movemask(const Float a)
+    {
+        return _mm_movemask_ps(a);
+    }
+
+    // Cephes style sincos: reduce to [-pi/4, pi/4] by octant, then pick the sine or cosine
+    // polynomial per lane. Accurate to about 1e-7 for the angle range sprites use.
+    static void sincos(Float x, Float& s, Float& c)
+    {
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        __m128 signSin = _mm_and_ps(x, signMask);
+        x = _mm_andnot_ps(signMask, x);
+
+        __m128i octant = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));
+        octant = _mm_and_si128(_mm_add_epi32(octant, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+        const __m128 y = _mm_cvtepi32_ps(octant);
+
+        const __m128 swapSignSin =
+            _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(octant, _mm_set1_epi32(4)), 29));
+        const __m128 polyMask = _mm_castsi128_ps(
+            _mm_cmpeq_epi32(_mm_and_si128(octant, _mm_set1_epi32(2)), _mm_setzero_si128())
+        );
+        const __m128 signCos = _mm_castsi128_ps(_mm_slli_epi32(
+            _mm_andnot_si128(_mm_sub_epi32(octant, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29
+        ));
+        signSin = _mm_xor_ps(signSin, swapSignSin);
+
+        x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(0.78515625f)));
+        x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(2.4187564849853515625e-4f)));
+        x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(3.77489497744594108e-8f)));
+
+        const __m128 z = _mm_mul_ps(x, x);
+
+        __m128 cosPoly = _mm_set1_ps(2.443315711809948e-5f);
+        cosPoly = _mm_add_ps(_mm_mul_ps(cosPoly, z), _mm_set1_ps(-1.388731625493765e-3f));
+        cosPoly = _mm_add_ps(_mm_mul_ps(cosPoly, z), _mm_set1_ps(4.166664568298827e-2f));
+        cosPoly = _mm_mul_ps(_mm_mul_ps(cosPoly, z), z);
+        cosPoly = _mm_sub_ps(cosPoly, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+        cosPoly = _mm_add_ps(cosPoly, _mm_set1_ps(1.0f));
+
+        __m128 sinPoly = _mm_set1_ps(-1.9515295891e-4f);
+        sinPoly = _mm_add_ps(_mm_mul_ps(sinPoly, z), _mm_set1_ps(8.3321608736e-3f));
+        sinPoly = _mm_add_ps(_mm_mul_ps(sinPoly, z), _mm_set1_ps(-1.6666654611e-1f));
+        sinPoly = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sinPoly, z), x), x);
+
+        s = _mm_xor_ps(_mm_blendv_ps(cosPoly, sinPoly, polyMask), signSin);
+        c = _mm_xor_ps(_mm_blendv_ps(sinPoly, cosPoly, polyMask), signCos);
+    }
+};
+}  // namespace
+
+size_t _generateQuadsSSE41(
+    const BatchParams& params, const InstanceSpan& instances, const size_t begin,
+    const size_t end, SDL_Vertex* out
+)
+{
+    return _generateQuadsSimd<SSE41>(params, instances, begin, end, out);
+}
+}  // namespace kn::renderer::kernel
+
+#else
+
+namespace kn::renderer::kernel
+{
+size_t _generateQuadsSSE41(
+    const BatchParams& params, const InstanceSpan& instances, const size_t begin,
+    const size_t end, SDL_Vertex* out
+)
+{
+    return _generateQuadsScalar(params, instances, begin, end, out);
+}
+}  // namespace kn::renderer::kernel
+
+#endif  // x86
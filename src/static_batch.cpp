@@ -0,0 +1,667 @@
+#include "StaticBatch.hpp"
+
+#ifdef KRAKEN_ENABLE_PYTHON
+#include <nanobind/stl/optional.h>
+#include <nanobind/stl/shared_ptr.h>
+#endif  // KRAKEN_ENABLE_PYTHON
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "Camera.hpp"
+#include "Renderer.hpp"
+#include "TextureAtlas.hpp"
+#include "_frame_stats.hpp"
+
+namespace kn::renderer
+{
+static constexpr uint32_t DEAD_QUAD = std::numeric_limits<uint32_t>::max();
+
+static StaticBatch::Handle _makeHandle(const uint32_t index, const uint32_t generation)
+{
+    return (static_cast<uint64_t>(generation) << 32) | index;
+}
+
+static SDL_FColor _instanceColor(const Texture& texture, const Color& color)
+{
+    const auto tint = static_cast<SDL_FColor>(texture.getTint());
+    const auto mod = static_cast<SDL_FColor>(color);
+    return {tint.r * mod.r, tint.g * mod.g, tint.b * mod.b, texture.getAlpha() * mod.a};
+}
+
+static SDL_FColor _instanceColor(const TextureRegion& region)
+{
+    auto color = static_cast<SDL_FColor>(region.getTint());
+    color.a = region.getAlpha();
+    return color;
+}
+
+StaticBatch::StaticBatch(std::shared_ptr<Texture> texture, const double cellSize)
+    : m_texture(std::move(texture)),
+      m_cellSize(cellSize)
+{
+    if (!m_texture)
+        throw std::invalid_argument("StaticBatch requires a texture");
+    if (!m_texture->hasUsage(TextureUsage::Drawable))
+        throw std::invalid_argument("Texture is not drawable");
+    if (!(cellSize > 0.0))
+        throw std::invalid_argument("Cell size must be greater than zero");
+}
+
+StaticBatch::Handle StaticBatch::add(
+    const Transform& transform, const Vec2& anchor, const Vec2& pivot,
+    const std::optional<Rect>& clipArea, const Color& color
+)
+{
+    SDL_Vertex quad[4];
+    Rect bounds;
+    _buildQuad(
+        quad, bounds, transform, anchor, pivot, clipArea.value_or(m_texture->getClipArea()),
+        m_texture->flip, _instanceColor(*m_texture, color)
+    );
+
+    return _insert(quad, bounds, _allocateSlot());
+}
+
+StaticBatch::Handle StaticBatch::add(
+    const TextureRegion& region, const Transform& transform, const Vec2& anchor, const Vec2& pivot
+)
+{
+    if (region.getTexture() != m_texture)
+        throw std::invalid_argument("Region is not of the batch's texture");
+
+    SDL_Vertex quad[4];
+    Rect bounds;
+    _buildQuad(
+        quad, bounds, transform, anchor, pivot, region.getSrcRect(), region.getFlip(),
+        _instanceColor(region)
+    );
+
+    return _insert(quad, bounds, _allocateSlot());
+}
+
+void StaticBatch::update(
+    const Handle handle, const Transform& transform, const Vec2& anchor, const Vec2& pivot,
+    const std::optional<Rect>& clipArea, const Color& color
+)
+{
+    Slot& slot = _slot(handle);
+
+    SDL_Vertex quad[4];
+    Rect bounds;
+    _buildQuad(
+        quad, bounds, transform, anchor, pivot, clipArea.value_or(m_texture->getClipArea()),
+        m_texture->flip, _instanceColor(*m_texture, color)
+    );
+
+    _replace(slot, quad, bounds);
+}
+
+void StaticBatch::update(
+    const Handle handle, const TextureRegion& region, const Transform& transform,
+    const Vec2& anchor, const Vec2& pivot
+)
+{
+    Slot& slot = _slot(handle);
+    if (region.getTexture() != m_texture)
+        throw std::invalid_argument("Region is not of the batch's texture");
+
+    SDL_Vertex quad[4];
+    Rect bounds;
+    _buildQuad(
+        quad, bounds, transform, anchor, pivot, region.getSrcRect(), region.getFlip(),
+        _instanceColor(region)
+    );
+
+    _replace(slot, quad, bounds);
+}
+
+void StaticBatch::remove(const Handle handle)
+{
+    if (!contains(handle))
+        return;
+
+    Slot& slot = m_slots[handle & 0xFFFFFFFF];
+    _erase(slot);
+    slot.alive = false;
+    ++slot.generation;
+    m_freeSlots.push_back(static_cast<uint32_t>(handle & 0xFFFFFFFF));
+    --m_count;
+}
+
+void StaticBatch::clear()
+{
+    for (uint32_t i = 0; i < m_slots.size(); ++i)
+    {
+        if (!m_slots[i].alive)
+            continue;
+
+        m_slots[i].alive = false;
+        ++m_slots[i].generation;
+        m_freeSlots.push_back(i);
+    }
+
+    m_cells.clear();
+    m_count = 0;
+    m_maxExtent = {};
+    m_screenVertices.clear();
+    m_screenSprites = 0;
+    m_dirty = true;
+}
+
+bool StaticBatch::contains(const Handle handle) const
+{
+    const auto index = static_cast<size_t>(handle & 0xFFFFFFFF);
+    return index < m_slots.size() && m_slots[index].alive &&
+           m_slots[index].generation == static_cast<uint32_t>(handle >> 32);
+}
+
+size_t StaticBatch::getCount() const
+{
+    return m_count;
+}
+
+size_t StaticBatch::getCellCount() const
+{
+    return m_cells.size();
+}
+
+double StaticBatch::getCellSize() const
+{
+    return m_cellSize;
+}
+
+const std::shared_ptr<Texture>& StaticBatch::getTexture() const
+{
+    return m_texture;
+}
+
+void StaticBatch::draw(const int layer, const double depth)
+{
+    const stats::DrawScope drawScope;
+    if (m_count == 0)
+        return;
+
+    const camera::View& view = camera::getView();
+    const bool sameView = view.pos.x == m_viewPos.x && view.pos.y == m_viewPos.y &&
+                          view.angle == m_viewAngle && view.zoom == m_viewZoom &&
+                          view.resolution.x == m_viewSize.x && view.resolution.y == m_viewSize.y;
+    if (m_dirty || !sameView)
+    {
+        m_screenVertices.clear();
+        m_screenSprites = 0;
+
+        const Rect bounds = view.getWorldBounds();
+
+        const auto firstCol =
+            static_cast<int32_t>(std::floor((bounds.x - m_maxExtent.x) / m_cellSize));
+        const auto lastCol =
+            static_cast<int32_t>(std::floor((bounds.getRight() + m_maxExtent.x) / m_cellSize));
+        const auto firstRow =
+            static_cast<int32_t>(std::floor((bounds.y - m_maxExtent.y) / m_cellSize));
+        const auto lastRow =
+            static_cast<int32_t>(std::floor((bounds.getBottom() + m_maxExtent.y) / m_cellSize));
+
+        for (int32_t row = firstRow; row <= lastRow; ++row)
+        {
+            for (auto it = m_cells.lower_bound({row, firstCol});
+                 it != m_cells.end() && it->first.first == row && it->first.second <= lastCol; ++it)
+            {
+                const Cell& cell = it->second;
+                if (cell.bounds.getRight() < bounds.x || cell.bounds.x > bounds.getRight() ||
+                    cell.bounds.getBottom() < bounds.y || cell.bounds.y > bounds.getBottom())
+                {
+                    continue;
+                }
+
+                // The offset is formed in double precision, so vertices stay exact far from the
+                // world origin
+                const Vec2 offset = cell.origin - view.pos;
+                const size_t first = m_screenVertices.size();
+                m_screenSprites += cell.slots.size() - cell.deadQuads;
+                m_screenVertices.insert(
+                    m_screenVertices.end(), cell.vertices.begin(), cell.vertices.end()
+                );
+                SDL_Vertex* out = m_screenVertices.data() + first;
+                const size_t count = cell.vertices.size();
+
+                const double zc = view.cos * view.zoom;
+                const double zs = view.sin * view.zoom;
+                const auto dx = static_cast<float>(offset.x * zc - offset.y * zs + view.center.x);
+                const auto dy = static_cast<float>(offset.x * zs + offset.y * zc + view.center.y);
+                if (view.angle == 0.0 && view.zoom == 1.0)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        out[i].position.x += dx;
+                        out[i].position.y += dy;
+                    }
+                }
+                else
+                {
+                    const auto fc = static_cast<float>(zc);
+                    const auto fs = static_cast<float>(zs);
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        const float x = out[i].position.x;
+                        const float y = out[i].position.y;
+                        out[i].position.x = x * fc - y * fs + dx;
+                        out[i].position.y = x * fs + y * fc + dy;
+                    }
+                }
+            }
+        }
+
+        m_dirty = false;
+        m_viewPos = view.pos;
+        m_viewAngle = view.angle;
+        m_viewZoom = view.zoom;
+        m_viewSize = view.resolution;
+    }
+
+    const size_t quadCount = m_screenVertices.size() / 4;
+    stats::countSprites(
+        m_screenSprites, m_count > m_screenSprites ? m_count - m_screenSprites : 0
+    );
+    _submitBatch(m_texture->getSDL(), m_screenVertices.data(), quadCount, layer, depth);
+}
+
+uint32_t StaticBatch::_allocateSlot()
+{
+    ++m_count;
+    if (!m_freeSlots.empty())
+    {
+        const uint32_t index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        return index;
+    }
+
+    m_slots.emplace_back();
+    return static_cast<uint32_t>(m_slots.size() - 1);
+}
+
+StaticBatch::Handle StaticBatch::_insert(
+    const SDL_Vertex (&quad)[4], const Rect& bounds, const uint32_t slotIndex
+)
+{
+    const CellKey key = _cellKey(bounds);
+    auto [it, inserted] = m_cells.try_emplace(key);
+    Cell& cell = it->second;
+    if (inserted)
+    {
+        cell.origin = _cellOrigin(key);
+        cell.bounds = bounds;
+    }
+    else
+    {
+        const double left = std::min(cell.bounds.x, bounds.x);
+        const double top = std::min(cell.bounds.y, bounds.y);
+        const double right = std::max(cell.bounds.getRight(), bounds.getRight());
+        const double bottom = std::max(cell.bounds.getBottom(), bounds.getBottom());
+        cell.bounds = {left, top, right - left, bottom - top};
+    }
+
+    cell.vertices.insert(cell.vertices.end(), quad, quad + 4);
+
+    Slot& slot = m_slots[slotIndex];
+    slot.alive = true;
+    slot.cell = key;
+    slot.quad = static_cast<uint32_t>(cell.slots.size());
+    cell.slots.push_back(slotIndex);
+
+    m_maxExtent.x = std::max(m_maxExtent.x, bounds.w * 0.5);
+    m_maxExtent.y = std::max(m_maxExtent.y, bounds.h * 0.5);
+    m_dirty = true;
+
+    return _makeHandle(slotIndex, slot.generation);
+}
+
+// Turns the quad into a degenerate one in place, keeping the draw order of the rest. Cells are
+// compacted once half their quads are dead.
+void StaticBatch::_erase(Slot& slot)
+{
+    const auto it = m_cells.find(slot.cell);
+    Cell& cell = it->second;
+
+    SDL_Vertex* quad = cell.vertices.data() + static_cast<size_t>(slot.quad) * 4;
+    for (int i = 0; i < 4; ++i)
+    {
+        quad[i].position = quad[0].position;
+        quad[i].color.a = 0.0f;
+    }
+    cell.slots[slot.quad] = DEAD_QUAD;
+    m_dirty = true;
+
+    if (++cell.deadQuads * 2 >= cell.slots.size())
+        _compact(slot.cell);
+}
+
+void StaticBatch::_replace(Slot& slot, const SDL_Vertex (&quad)[4], const Rect& bounds)
+{
+    const CellKey key = _cellKey(bounds);
+    if (key != slot.cell)
+    {
+        const uint32_t slotIndex = m_cells.find(slot.cell)->second.slots[slot.quad];
+        _erase(slot);
+        _insert(quad, bounds, slotIndex);
+        return;
+    }
+
+    Cell& cell = m_cells.find(key)->second;
+    std::copy(quad, quad + 4, cell.vertices.begin() + static_cast<std::ptrdiff_t>(slot.quad) * 4);
+
+    const double left = std::min(cell.bounds.x, bounds.x);
+    const double top = std::min(cell.bounds.y, bounds.y);
+    const double right = std::max(cell.bounds.getRight(), bounds.getRight());
+    const double bottom = std::max(cell.bounds.getBottom(), bounds.getBottom());
+    cell.bounds = {left, top, right - left, bottom - top};
+
+    m_maxExtent.x = std::max(m_maxExtent.x, bounds.w * 0.5);
+    m_maxExtent.y = std::max(m_maxExtent.y, bounds.h * 0.5);
+    m_dirty = true;
+}
+
+void StaticBatch::_compact(const CellKey& key)
+{
+    const auto it = m_cells.find(key);
+    Cell& cell = it->second;
+
+    size_t write = 0;
+    double left = std::numeric_limits<double>::infinity();
+    double top = std::numeric_limits<double>::infinity();
+    double right = -std::numeric_limits<double>::infinity();
+    double bottom = -std::numeric_limits<double>::infinity();
+    for (size_t read = 0; read < cell.slots.size(); ++read)
+    {
+        if (cell.slots[read] == DEAD_QUAD)
+            continue;
+
+        for (int i = 0; i < 4; ++i)
+        {
+            const SDL_Vertex& vertex = cell.vertices[read * 4 + i];
+            left = std::min(left, static_cast<double>(vertex.position.x));
+            top = std::min(top, static_cast<double>(vertex.position.y));
+            right = std::max(right, static_cast<double>(vertex.position.x));
+            bottom = std::max(bottom, static_cast<double>(vertex.position.y));
+            cell.vertices[write * 4 + i] = vertex;
+        }
+        cell.slots[write] = cell.slots[read];
+        m_slots[cell.slots[write]].quad = static_cast<uint32_t>(write);
+        ++write;
+    }
+
+    if (write == 0)
+    {
+        m_cells.erase(it);
+        return;
+    }
+
+    cell.vertices.resize(write * 4);
+    cell.slots.resize(write);
+    cell.deadQuads = 0;
+    cell.bounds = {cell.origin.x + left, cell.origin.y + top, right - left, bottom - top};
+}
+
+StaticBatch::Slot& StaticBatch::_slot(const Handle handle)
+{
+    if (!contains(handle))
+        throw std::invalid_argument("Invalid or removed StaticBatch handle");
+
+    return m_slots[handle & 0xFFFFFFFF];
+}
+
+void StaticBatch::_buildQuad(
+    SDL_Vertex (&quad)[4], Rect& bounds, const Transform& transform, const Vec2& anchor,
+    const Vec2& pivot, const Rect& clipArea, const Texture::Flip& flip, const SDL_FColor& color
+) const
+{
+    const double w = clipArea.w * transform.scale.x;
+    const double h = clipArea.h * transform.scale.y;
+    const double pivotX = w * pivot.x;
+    const double pivotY = h * pivot.y;
+    const double originX = transform.pos.x - w * anchor.x + pivotX;
+    const double originY = transform.pos.y - h * anchor.y + pivotY;
+
+    const double localX[4] = {-pivotX, w - pivotX, w - pivotX, -pivotX};
+    const double localY[4] = {-pivotY, -pivotY, h - pivotY, h - pivotY};
+
+    double c = 1.0;
+    double s = 0.0;
+    if (transform.angle != 0.0)
+    {
+        c = std::cos(transform.angle);
+        s = std::sin(transform.angle);
+    }
+
+    const double texW = m_texture->getWidth();
+    const double texH = m_texture->getHeight();
+    auto u1 = static_cast<float>(clipArea.x / texW);
+    auto v1 = static_cast<float>(clipArea.y / texH);
+    auto u2 = static_cast<float>(clipArea.getRight() / texW);
+    auto v2 = static_cast<float>(clipArea.getBottom() / texH);
+    if (flip.h)
+        std::swap(u1, u2);
+    if (flip.v)
+        std::swap(v1, v2);
+
+    const float u[4] = {u1, u2, u2, u1};
+    const float v[4] = {v1, v1, v2, v2};
+
+    double x[4], y[4];
+    double left = std::numeric_limits<double>::infinity();
+    double top = std::numeric_limits<double>::infinity();
+    double right = -std::numeric_limits<double>::infinity();
+    double bottom = -std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 4; ++i)
+    {
+        x[i] = originX + localX[i] * c - localY[i] * s;
+        y[i] = originY + localX[i] * s + localY[i] * c;
+        left = std::min(left, x[i]);
+        top = std::min(top, y[i]);
+        right = std::max(right, x[i]);
+        bottom = std::max(bottom, y[i]);
+    }
+    bounds = {left, top, right - left, bottom - top};
+
+    // Stored relative to the owning cell before narrowing to float
+    const Vec2 cellOrigin = _cellOrigin(_cellKey(bounds));
+    for (int i = 0; i < 4; ++i)
+    {
+        quad[i] = {
+            {static_cast<float>(x[i] - cellOrigin.x), static_cast<float>(y[i] - cellOrigin.y)},
+            color,
+            {u[i], v[i]}
+        };
+    }
+}
+
+StaticBatch::CellKey StaticBatch::_cellKey(const Rect& bounds) const
+{
+    const Vec2 center = bounds.getCenter();
+    return {
+        static_cast<int32_t>(std::floor(center.y / m_cellSize)),
+        static_cast<int32_t>(std::floor(center.x / m_cellSize))
+    };
+}
+
+Vec2 StaticBatch::_cellOrigin(const CellKey& key) const
+{
+    return {key.second * m_cellSize, key.first * m_cellSize};
+}
+
+#ifdef KRAKEN_ENABLE_PYTHON
+void _bindStaticBatch(nb::module_& subRenderer)
+{
+    using namespace nb::literals;
+
+    nb::class_<StaticBatch>(subRenderer, "StaticBatch", R"doc(
+A retained batch of textured quads for scenery that rarely changes.
+
+Instances are converted to world-space vertices once, when they are added or updated, and kept in
+a coarse grid of cells. Each draw only applies the active camera to the cells in view, and reuses
+the previous frame's vertices while the camera and the contents are unchanged.
+
+Instances are drawn cell by cell, row by row, and in insertion order within a cell.
+    )doc")
+        .def(
+            nb::init<std::shared_ptr<Texture>, double>(), "texture"_a, "cell_size"_a = 512.0,
+            R"doc(
+Create an empty static batch.
+
+Args:
+    texture (Texture): The texture every instance samples from.
+    cell_size (float, optional): Size of the culling grid cells in world units. Defaults to 512.
+
+Raises:
+    ValueError: If the texture is not drawable or cell_size is not positive.
+            )doc"
+        )
+        .def(
+            "add",
+            nb::overload_cast<
+                const Transform&, const Vec2&, const Vec2&, const std::optional<Rect>&,
+                const Color&>(&StaticBatch::add),
+            "transform"_a, "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER,
+            "clip_area"_a = nb::none(), "color"_a = Color::WHITE, R"doc(
+Add an instance of the batch's texture.
+
+The texture's flip, tint and alpha are captured when the instance is added.
+
+Args:
+    transform (Transform): World-space position, rotation and scale.
+    anchor (Vec2, optional): The anchor point (0.0-1.0). Defaults to top left (0, 0).
+    pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
+    clip_area (Rect, optional): Area of the texture to draw. Defaults to the texture's clip area.
+    color (Color, optional): Color multiplied with the texture's tint and alpha. Defaults to white.
+
+Returns:
+    int: A handle for updating or removing the instance.
+            )doc"
+        )
+        .def(
+            "add",
+            nb::overload_cast<const TextureRegion&, const Transform&, const Vec2&, const Vec2&>(
+                &StaticBatch::add
+            ),
+            "region"_a, "transform"_a, "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER,
+            R"doc(
+Add an instance of a region of the batch's texture.
+
+The region's source area, flip, tint and alpha are captured when the instance is added, so update
+atlas region instances after repacking the atlas.
+
+Args:
+    region (TextureRegion | AtlasRegion): A region of the batch's texture.
+    transform (Transform): World-space position, rotation and scale.
+    anchor (Vec2, optional): The anchor point (0.0-1.0). Defaults to top left (0, 0).
+    pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
+
+Returns:
+    int: A handle for updating or removing the instance.
+
+Raises:
+    ValueError: If the region is on a different texture.
+    RuntimeError: If the atlas region was removed from its atlas.
+            )doc"
+        )
+        // Bound directly so a removed atlas region raises RuntimeError rather than failing the
+        // implicit conversion with a TypeError
+        .def(
+            "add",
+            [](StaticBatch& self, const AtlasRegion& region, const Transform& transform,
+               const Vec2& anchor, const Vec2& pivot)
+            { return self.add(region, transform, anchor, pivot); },
+            "region"_a, "transform"_a, "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER
+        )
+        .def(
+            "update",
+            nb::overload_cast<
+                StaticBatch::Handle, const Transform&, const Vec2&, const Vec2&,
+                const std::optional<Rect>&, const Color&>(&StaticBatch::update),
+            "handle"_a, "transform"_a, "anchor"_a = Anchor::TOP_LEFT, "pivot"_a = Anchor::CENTER,
+            "clip_area"_a = nb::none(), "color"_a = Color::WHITE, R"doc(
+Replace an instance without rebuilding the rest of the batch.
+
+Args:
+    handle (int): The handle returned by add().
+    transform (Transform): World-space position, rotation and scale.
+    anchor (Vec2, optional): The anchor point (0.0-1.0). Defaults to top left (0, 0).
+    pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
+    clip_area (Rect, optional): Area of the texture to draw. Defaults to the texture's clip area.
+    color (Color, optional): Color multiplied with the texture's tint and alpha. Defaults to white.
+
+Raises:
+    ValueError: If the handle is invalid or was removed.
+            )doc"
+        )
+        .def(
+            "update",
+            nb::overload_cast<
+                StaticBatch::Handle, const TextureRegion&, const Transform&, const Vec2&,
+                const Vec2&>(&StaticBatch::update),
+            "handle"_a, "region"_a, "transform"_a, "anchor"_a = Anchor::TOP_LEFT,
+            "pivot"_a = Anchor::CENTER, R"doc(
+Replace an instance with a region without rebuilding the rest of the batch.
+
+Args:
+    handle (int): The handle returned by add().
+    region (TextureRegion | AtlasRegion): A region of the batch's texture.
+    transform (Transform): World-space position, rotation and scale.
+    anchor (Vec2, optional): The anchor point (0.0-1.0). Defaults to top left (0, 0).
+    pivot (Vec2, optional): The rotation pivot (0.0-1.0). Defaults to center (0.5, 0.5).
+
+Raises:
+    ValueError: If the handle is invalid or the region is on a different texture.
+    RuntimeError: If the atlas region was removed from its atlas.
+            )doc"
+        )
+        .def(
+            "update",
+            [](StaticBatch& self, const StaticBatch::Handle handle, const AtlasRegion& region,
+               const Transform& transform, const Vec2& anchor, const Vec2& pivot)
+            { self.update(handle, region, transform, anchor, pivot); },
+            "handle"_a, "region"_a, "transform"_a, "anchor"_a = Anchor::TOP_LEFT,
+            "pivot"_a = Anchor::CENTER
+        )
+        .def("remove", &StaticBatch::remove, "handle"_a, R"doc(
+Remove an instance. Does nothing if the handle was already removed.
+
+Args:
+    handle (int): The handle returned by add().
+        )doc")
+        .def("clear", &StaticBatch::clear, R"doc(
+Remove all instances. Existing handles become invalid.
+        )doc")
+        .def("contains", &StaticBatch::contains, "handle"_a, R"doc(
+Check whether a handle refers to a live instance.
+
+Args:
+    handle (int): The handle returned by add().
+
+Returns:
+    bool: True if the instance exists.
+        )doc")
+        .def("__contains__", &StaticBatch::contains, "handle"_a)
+        .def("__len__", &StaticBatch::getCount)
+        .def_prop_ro("cell_count", &StaticBatch::getCellCount, R"doc(
+The number of grid cells holding instances.
+        )doc")
+        .def_prop_ro("cell_size", &StaticBatch::getCellSize, R"doc(
+The size of the culling grid cells in world units.
+        )doc")
+        .def_prop_ro("texture", &StaticBatch::getTexture, R"doc(
+The texture every instance samples from.
+        )doc")
+        .def("draw", &StaticBatch::draw, "layer"_a = 0, "depth"_a = 0.0, R"doc(
+Draw the instances in view through the active camera.
+
+Args:
+    layer (int, optional): Sort layer for the whole batch when sorting is enabled. Defaults to 0.
+    depth (float, optional): Sort depth for the whole batch when sorting is enabled.
+        Defaults to 0.0.
+        )doc");
+}
+#endif  // KRAKEN_ENABLE_PYTHON
+}  // namespace kn::renderer
@@ -15,6 +15,7 @@
 #include "Log.hpp"
 #include "Rect.hpp"
 #include "Renderer.hpp"
+#include "_frame_stats.hpp"
 
 namespace kn
 {
@@ -74,6 +75,7 @@ void Text::setFont(const Font& font) const
 
 void Text::draw(Vec2 pos, const Vec2& anchor) const
 {
+    const renderer::stats::DrawScope drawScope;
     if (!renderer::_get())
         throw std::runtime_error("Renderer not initialized");
     if (!TTF_GetTextFont(m_text))
@@ -91,6 +93,8 @@ void Text::draw(Vec2 pos, const Vec2& anchor) const
     const int drawX = static_cast<int>(std::round(pos.x));
     const int drawY = static_cast<int>(std::round(pos.y));
 
+    renderer::_flush();
+
     // Draw shadow if applicable
     if (shadowColor.a > 0 && !shadowOffset.isZero())
     {
@@ -99,11 +103,13 @@ void Text::draw(Vec2 pos, const Vec2& anchor) const
 
         const int shadowX = drawX + static_cast<int>(std::round(shadowOffset.x));
         const int shadowY = drawY + static_cast<int>(std::round(shadowOffset.y));
+        renderer::stats::countExternalGeometry();
         TTF_DrawRendererText(m_text, shadowX, shadowY);
 
         setColor(originalColor);
     }
 
+    renderer::stats::countExternalGeometry();
     TTF_DrawRendererText(m_text, drawX, drawY);
 }
 
@@ -2,14 +2,17 @@
 
 #ifdef KRAKEN_ENABLE_PYTHON
 #include <nanobind/stl/filesystem.h>
+#include <nanobind/stl/shared_ptr.h>
 #endif  // KRAKEN_ENABLE_PYTHON
 
+#include <stdexcept>
 #include <string>
 
 #include "Camera.hpp"
 #include "Color.hpp"
 #include "PixelArray.hpp"
 #include "Renderer.hpp"
+#include "TextureAtlas.hpp"
 
 namespace kn
 {
@@ -124,6 +127,7 @@ Texture::~Texture()
 {
     if (m_texPtr)
     {
+        renderer::_onTextureDestroyed(m_texPtr);
         SDL_DestroyTexture(m_texPtr);
         m_texPtr = nullptr;
     }
@@ -153,7 +157,10 @@ Texture& Texture::operator=(Texture&& other) noexcept
     if (this != &other)
     {
         if (m_texPtr)
+        {
+            renderer::_onTextureDestroyed(m_texPtr);
             SDL_DestroyTexture(m_texPtr);
+        }
         if (m_gpuTexPtr)
             SDL_ReleaseGPUTexture(renderer::_getGPUDevice(), m_gpuTexPtr);
 
@@ -409,6 +416,7 @@ void Texture::makeAdditive() const
     if (!m_texPtr)
         throw std::runtime_error("Texture is not drawable, cannot make additive");
 
+    renderer::_flush();
     if (!SDL_SetTextureBlendMode(m_texPtr, SDL_BLENDMODE_ADD))
         throw std::runtime_error(
             "Failed to set texture blend mode: " + std::string(SDL_GetError())
@@ -420,6 +428,7 @@ void Texture::makeMultiply() const
     if (!m_texPtr)
         throw std::runtime_error("Texture is not drawable, cannot make multiply");
 
+    renderer::_flush();
     if (!SDL_SetTextureBlendMode(m_texPtr, SDL_BLENDMODE_MUL))
         throw std::runtime_error(
             "Failed to set texture blend mode: " + std::string(SDL_GetError())
@@ -431,6 +440,7 @@ void Texture::makeNormal() const
     if (!m_texPtr)
         throw std::runtime_error("Texture is not drawable, cannot make normal");
 
+    renderer::_flush();
     if (!SDL_SetTextureBlendMode(m_texPtr, SDL_BLENDMODE_BLEND))
         throw std::runtime_error(
             "Failed to set texture blend mode: " + std::string(SDL_GetError())
@@ -452,6 +462,97 @@ SDL_GPUTexture* Texture::getGPU() const
     return m_gpuTexPtr;
 }
 
+static void _checkSrcRect(const Rect& srcRect)
+{
+    if (srcRect.w < 0.0 || srcRect.h < 0.0)
+        throw std::invalid_argument("Source rectangle cannot have a negative size");
+}
+
+TextureRegion::TextureRegion(
+    std::shared_ptr<Texture> texture, const Rect& srcRect, const Texture::Flip& flip,
+    const Color& tint, const float alpha
+)
+    : m_texture(std::move(texture)),
+      m_srcRect(srcRect),
+      m_flip(flip),
+      m_tint(tint),
+      m_alpha(alpha)
+{
+    if (!m_texture)
+        throw std::invalid_argument("Texture region needs a texture");
+    if (!m_texture->hasUsage(TextureUsage::Drawable))
+        throw std::invalid_argument("Texture is not drawable");
+
+    _checkSrcRect(srcRect);
+    if (srcRect.w == 0.0 && srcRect.h == 0.0)
+        m_srcRect = m_texture->getRect();
+}
+
+TextureRegion::TextureRegion(const AtlasRegion& region)
+    : TextureRegion(region.toRegion())
+{
+}
+
+const std::shared_ptr<Texture>& TextureRegion::getTexture() const
+{
+    return m_texture;
+}
+
+const Rect& TextureRegion::getSrcRect() const
+{
+    return m_srcRect;
+}
+
+const Texture::Flip& TextureRegion::getFlip() const
+{
+    return m_flip;
+}
+
+const Color& TextureRegion::getTint() const
+{
+    return m_tint;
+}
+
+float TextureRegion::getAlpha() const
+{
+    return m_alpha;
+}
+
+Vec2 TextureRegion::getSize() const
+{
+    return m_srcRect.getSize();
+}
+
+TextureRegion TextureRegion::withSrcRect(const Rect& srcRect) const
+{
+    _checkSrcRect(srcRect);
+
+    TextureRegion region = *this;
+    region.m_srcRect = srcRect.w == 0.0 && srcRect.h == 0.0 ? m_texture->getRect() : srcRect;
+    return region;
+}
+
+TextureRegion TextureRegion::withFlip(const bool h, const bool v) const
+{
+    TextureRegion region = *this;
+    region.m_flip = {h, v};
+    return region;
+}
+
+TextureRegion TextureRegion::withTint(const Color& tint) const
+{
+    TextureRegion region = *this;
+    region.m_tint = tint;
+    return region;
+}
+
+TextureRegion TextureRegion::withAlpha(const float alpha) const
+{
+    TextureRegion region = *this;
+    region.m_alpha = alpha;
+    return region;
+}
+
 #ifdef KRAKEN_ENABLE_PYTHON
 namespace texture
 {
@@ -619,6 +720,104 @@ Set the texture to use normal (alpha) blending mode.
 
 This is the default blending mode for standard transparency effects.
         )doc");
+
+    nb::class_<TextureRegion>(module, "TextureRegion", R"doc(
+Immutable draw parameters for part of a texture: source area, flip, tint and alpha.
+
+Drawing a region leaves the texture's own clip area, flip, tint and alpha untouched, so one texture
+can back many differently flipped or tinted draws, such as the frames of a sprite sheet. Regions of
+the same texture are drawn in a single batch whatever their parameters.
+    )doc")
+        .def(
+            nb::init<
+                std::shared_ptr<Texture>, const Rect&, const Texture::Flip&, const Color&,
+                float>(),
+            "texture"_a, "src"_a = Rect{}, "flip"_a = Texture::Flip{}, "tint"_a = Color::WHITE,
+            "alpha"_a = 1.0f, R"doc(
+Create a region of a texture.
+
+Args:
+    texture (Texture): The texture to sample from.
+    src (Rect, optional): Area of the texture to draw. Defaults to the whole texture.
+    flip (Texture.Flip, optional): Horizontal and vertical mirroring. Defaults to no flip.
+    tint (Color, optional): Color multiplied with the texture. Defaults to white.
+    alpha (float, optional): Opacity between `0.0` and `1.0`. Defaults to 1.0.
+
+Raises:
+    ValueError: If the texture is not drawable or src has a negative size.
+        )doc"
+        )
+        .def(
+            nb::init_implicit<const AtlasRegion&>(), "region"_a, R"doc(
+Create a region from the current placement, flip, tint and alpha of an atlas region.
+
+Atlas regions convert implicitly wherever a TextureRegion is expected.
+
+Args:
+    region (AtlasRegion): The atlas region to copy.
+
+Raises:
+    RuntimeError: If the region has been removed from its atlas.
+        )doc"
+        )
+        .def_prop_ro("texture", &TextureRegion::getTexture, R"doc(
+The texture this region samples from.
+        )doc")
+        .def_prop_ro("src", &TextureRegion::getSrcRect, R"doc(
+The area of the texture this region draws.
+        )doc")
+        .def_prop_ro("flip", &TextureRegion::getFlip, R"doc(
+The horizontal and vertical mirroring of this region.
+        )doc")
+        .def_prop_ro("tint", &TextureRegion::getTint, R"doc(
+The color multiplied with the texture when drawing this region.
+        )doc")
+        .def_prop_ro("alpha", &TextureRegion::getAlpha, R"doc(
+The opacity of this region, as a float between `0.0` and `1.0`.
+        )doc")
+        .def_prop_ro("size", &TextureRegion::getSize, R"doc(
+The size of the source area as a `Vec2`.
+        )doc")
+        .def("with_src", &TextureRegion::withSrcRect, "src"_a, R"doc(
+Return a copy of this region drawing another area of the same texture.
+
+Args:
+    src (Rect): Area of the texture to draw. An empty rect covers the whole texture.
+
+Returns:
+    TextureRegion: The new region.
+
+Raises:
+    ValueError: If src has a negative size.
+        )doc")
+        .def("with_flip", &TextureRegion::withFlip, "h"_a, "v"_a, R"doc(
+Return a copy of this region with different mirroring.
+
+Args:
+    h (bool): Mirror horizontally.
+    v (bool): Mirror vertically.
+
+Returns:
+    TextureRegion: The new region.
+        )doc")
+        .def("with_tint", &TextureRegion::withTint, "tint"_a, R"doc(
+Return a copy of this region with a different tint.
+
+Args:
+    tint (Color): Color multiplied with the texture.
+
+Returns:
+    TextureRegion: The new region.
+        )doc")
+        .def("with_alpha", &TextureRegion::withAlpha, "alpha"_a, R"doc(
+Return a copy of this region with a different opacity.
+
+Args:
+    alpha (float): Opacity between `0.0` and `1.0`.
+
+Returns:
+    TextureRegion: The new region.
+        )doc");
 }
 }  // namespace texture
 #endif  // KRAKEN_ENABLE_PYTHON
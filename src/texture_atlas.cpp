@@ -0,0 +1,604 @@
+#include "TextureAtlas.hpp"
+
+#ifdef KRAKEN_ENABLE_PYTHON
+#include <nanobind/stl/filesystem.h>
+#include <nanobind/stl/shared_ptr.h>
+#include <nanobind/stl/string.h>
+#endif  // KRAKEN_ENABLE_PYTHON
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+
+#include "Renderer.hpp"
+
+namespace kn
+{
+AtlasRegion::AtlasRegion(std::shared_ptr<Slot> slot)
+    : m_slot(std::move(slot))
+{
+}
+
+bool AtlasRegion::isValid() const
+{
+    return m_slot && m_slot->valid;
+}
+
+std::string AtlasRegion::getName() const
+{
+    return m_slot ? m_slot->name : "";
+}
+
+const std::shared_ptr<Texture>& AtlasRegion::getTexture() const
+{
+    if (!isValid())
+        throw std::runtime_error("Atlas region is no longer valid");
+
+    return m_slot->page;
+}
+
+Rect AtlasRegion::getClipArea() const
+{
+    return isValid() ? m_slot->clipArea : Rect{};
+}
+
+int AtlasRegion::getWidth() const
+{
+    return static_cast<int>(getClipArea().w);
+}
+
+int AtlasRegion::getHeight() const
+{
+    return static_cast<int>(getClipArea().h);
+}
+
+Vec2 AtlasRegion::getSize() const
+{
+    return getClipArea().getSize();
+}
+
+TextureRegion AtlasRegion::toRegion() const
+{
+    return TextureRegion(getTexture(), m_slot->clipArea, flip, tint, alpha);
+}
+
+// Copies the source into a surface grown by `extrude` pixels on every side, then repeats the
+// outermost rows and columns into that border so linear filtering never samples a neighbour.
+static PixelArray _makeCell(const PixelArray& pixelArray, const int extrude)
+{
+    SDL_Surface* src = pixelArray.getSDL();
+    if (!src)
+        throw std::invalid_argument("PixelArray is empty");
+
+    const int width = src->w;
+    const int height = src->h;
+    PixelArray cell(width + extrude * 2, height + extrude * 2);
+    SDL_Surface* dst = cell.getSDL();
+
+    // Copy the pixels as-is rather than blending them onto the transparent cell. Color keyed
+    // pixels are still skipped by the blit and end up transparent.
+    SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+    SDL_GetSurfaceBlendMode(src, &blendMode);
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+    SDL_Rect dstRect{extrude, extrude, width, height};
+    const bool blitted = SDL_BlitSurface(src, nullptr, dst, &dstRect);
+    SDL_SetSurfaceBlendMode(src, blendMode);
+
+    if (!blitted)
+        throw std::runtime_error("Failed to copy image into atlas: " + std::string(SDL_GetError()));
+
+    if (extrude == 0)
+        return cell;
+
+    auto* pixels = static_cast<uint8_t*>(dst->pixels);
+    const auto rowBytes = static_cast<size_t>(width) * 4;
+    auto row = [&](const int y) { return pixels + static_cast<ptrdiff_t>(y) * dst->pitch; };
+
+    for (int e = 0; e < extrude; ++e)
+    {
+        std::memcpy(row(e) + extrude * 4, row(extrude) + extrude * 4, rowBytes);
+        std::memcpy(
+            row(extrude + height + e) + extrude * 4, row(extrude + height - 1) + extrude * 4,
+            rowBytes
+        );
+    }
+
+    // Columns run over the extruded rows too, which fills the corners
+    for (int y = 0; y < dst->h; ++y)
+    {
+        auto* line = reinterpret_cast<uint32_t*>(row(y));
+        std::fill(line, line + extrude, line[extrude]);
+        std::fill(line + extrude + width, line + width + extrude * 2, line[extrude + width - 1]);
+    }
+
+    return cell;
+}
+
+TextureAtlas::TextureAtlas(
+    const int pageWidth, const int pageHeight, const int padding, const int extrude,
+    const FilterMode filter
+)
+    : m_pageWidth(pageWidth),
+      m_pageHeight(pageHeight),
+      m_padding(padding),
+      m_extrude(extrude),
+      m_filter(filter)
+{
+    if (pageWidth < 1 || pageHeight < 1)
+        throw std::invalid_argument("Atlas page size values must be at least 1");
+    if (padding < 0 || extrude < 0)
+        throw std::invalid_argument("Atlas padding and extrude cannot be negative");
+}
+
+AtlasRegion TextureAtlas::add(const std::string& name, const PixelArray& pixelArray)
+{
+    if (m_entries.contains(name))
+        throw std::invalid_argument("Atlas already contains a region named '" + name + "'");
+
+    const int width = pixelArray.getWidth();
+    const int height = pixelArray.getHeight();
+    if (width + m_extrude * 2 > m_pageWidth || height + m_extrude * 2 > m_pageHeight)
+        throw std::invalid_argument(
+            "Image '" + name + "' (" + std::to_string(width) + "x" + std::to_string(height) +
+            ") does not fit in an atlas page"
+        );
+
+    Entry entry{std::make_shared<AtlasRegion::Slot>(), _makeCell(pixelArray, m_extrude)};
+    entry.slot->name = name;
+    _place(entry);
+
+    AtlasRegion region(entry.slot);
+    m_entries.emplace(name, std::move(entry));
+    return region;
+}
+
+AtlasRegion TextureAtlas::add(const std::string& name, const std::filesystem::path& filePath)
+{
+    return add(name, PixelArray(filePath));
+}
+
+AtlasRegion TextureAtlas::get(const std::string& name) const
+{
+    const auto it = m_entries.find(name);
+    if (it == m_entries.end())
+        throw std::out_of_range("Atlas has no region named '" + name + "'");
+
+    return AtlasRegion(it->second.slot);
+}
+
+bool TextureAtlas::contains(const std::string& name) const
+{
+    return m_entries.contains(name);
+}
+
+void TextureAtlas::remove(const std::string& name)
+{
+    const auto it = m_entries.find(name);
+    if (it == m_entries.end())
+        return;
+
+    // The skyline cannot reclaim space piecemeal, but an emptied page can start over. It is
+    // blanked first, since new cells would not cover the old pixels in the padding between them.
+    Page& page = m_pages[it->second.pageIndex];
+    if (page.regionCount == 1)
+    {
+        PixelArray blank(m_pageWidth, m_pageHeight);
+        SDL_Surface* surface = blank.getSDL();
+        // Queued quads may still sample the removed images
+        renderer::_flush();
+        if (!SDL_UpdateTexture(page.texture->getSDL(), nullptr, surface->pixels, surface->pitch))
+            throw std::runtime_error("Failed to clear atlas page: " + std::string(SDL_GetError()));
+
+        _resetSkyline(page);
+    }
+    else
+    {
+        --page.regionCount;
+    }
+
+    it->second.slot->valid = false;
+    m_entries.erase(it);
+}
+
+void TextureAtlas::clear()
+{
+    for (auto& [name, entry] : m_entries)
+        entry.slot->valid = false;
+
+    m_entries.clear();
+    m_pages.clear();
+}
+
+void TextureAtlas::repack()
+{
+    std::vector<Entry*> order;
+    order.reserve(m_entries.size());
+    for (auto& [name, entry] : m_entries)
+        order.push_back(&entry);
+
+    // Tallest first packs tightest on a skyline, name breaks ties so the layout is deterministic
+    std::ranges::sort(
+        order,
+        [](const Entry* a, const Entry* b)
+        {
+            const int heightA = a->cell.getHeight();
+            const int heightB = b->cell.getHeight();
+            if (heightA != heightB)
+                return heightA > heightB;
+
+            const int widthA = a->cell.getWidth();
+            const int widthB = b->cell.getWidth();
+            if (widthA != widthB)
+                return widthA > widthB;
+
+            return a->slot->name < b->slot->name;
+        }
+    );
+
+    // Old pages stay alive until every slot has moved, queued draws referencing them are flushed
+    // by the renderer when they are destroyed
+    std::vector<Page> oldPages = std::move(m_pages);
+    m_pages.clear();
+    for (Entry* entry : order)
+        _place(*entry);
+}
+
+size_t TextureAtlas::getRegionCount() const
+{
+    return m_entries.size();
+}
+
+size_t TextureAtlas::getPageCount() const
+{
+    return m_pages.size();
+}
+
+std::shared_ptr<Texture> TextureAtlas::getPage(const size_t index) const
+{
+    if (index >= m_pages.size())
+        throw std::out_of_range("Atlas page index out of range");
+
+    return m_pages[index].texture;
+}
+
+Vec2 TextureAtlas::getPageSize() const
+{
+    return {m_pageWidth, m_pageHeight};
+}
+
+int TextureAtlas::getPadding() const
+{
+    return m_padding;
+}
+
+int TextureAtlas::getExtrude() const
+{
+    return m_extrude;
+}
+
+double TextureAtlas::getOccupancy() const
+{
+    if (m_pages.empty())
+        return 0.0;
+
+    double usedArea = 0.0;
+    for (const auto& [name, entry] : m_entries)
+        usedArea += entry.slot->clipArea.w * entry.slot->clipArea.h;
+
+    return usedArea / (static_cast<double>(m_pageWidth) * m_pageHeight * m_pages.size());
+}
+
+TextureAtlas::Page TextureAtlas::_newPage() const
+{
+    PixelArray blank(m_pageWidth, m_pageHeight);
+
+    Page page;
+    page.texture = std::make_shared<Texture>(blank, m_filter);
+    _resetSkyline(page);
+    return page;
+}
+
+void TextureAtlas::_resetSkyline(Page& page) const
+{
+    // Padding is only needed between cells, so the page is treated as one padding wider and
+    // taller than it really is
+    page.skyline.assign(1, {0, 0, m_pageWidth + m_padding});
+    page.regionCount = 0;
+}
+
+bool TextureAtlas::_pack(
+    Page& page, const int width, const int height, int& outX, int& outY
+) const
+{
+    std::vector<SkylineNode>& skyline = page.skyline;
+    const int limitX = m_pageWidth + m_padding;
+    const int limitY = m_pageHeight + m_padding;
+
+    // Bottom-left rule: lowest resulting top edge wins, narrowest node breaks ties
+    size_t bestIndex = skyline.size();
+    int bestBottom = INT_MAX;
+    int bestWidth = INT_MAX;
+    int bestY = 0;
+    for (size_t i = 0; i < skyline.size(); ++i)
+    {
+        if (skyline[i].x + width > limitX)
+            break;
+
+        int y = skyline[i].y;
+        int remaining = width;
+        size_t j = i;
+        for (; remaining > 0 && j < skyline.size(); ++j)
+        {
+            y = std::max(y, skyline[j].y);
+            remaining -= skyline[j].width;
+        }
+
+        if (remaining > 0 || y + height > limitY)
+            continue;
+
+        if (y + height < bestBottom || (y + height == bestBottom && skyline[i].width < bestWidth))
+        {
+            bestIndex = i;
+            bestBottom = y + height;
+            bestWidth = skyline[i].width;
+            bestY = y;
+        }
+    }
+
+    if (bestIndex == skyline.size())
+        return false;
+
+    outX = skyline[bestIndex].x;
+    outY = bestY;
+    skyline.insert(skyline.begin() + static_cast<ptrdiff_t>(bestIndex), {outX, bestBottom, width});
+
+    // Trim or drop the nodes now covered by the new one
+    for (size_t i = bestIndex + 1; i < skyline.size();)
+    {
+        const SkylineNode& prev = skyline[i - 1];
+        const int overlap = prev.x + prev.width - skyline[i].x;
+        if (overlap <= 0)
+            break;
+
+        skyline[i].x += overlap;
+        skyline[i].width -= overlap;
+        if (skyline[i].width > 0)
+            break;
+
+        skyline.erase(skyline.begin() + static_cast<ptrdiff_t>(i));
+    }
+
+    for (size_t i = 0; i + 1 < skyline.size();)
+    {
+        if (skyline[i].y == skyline[i + 1].y)
+        {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + static_cast<ptrdiff_t>(i + 1));
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    return true;
+}
+
+void TextureAtlas::_place(Entry& entry)
+{
+    const int cellW = entry.cell.getWidth();
+    const int cellH = entry.cell.getHeight();
+
+    int x = 0;
+    int y = 0;
+    size_t pageIndex = 0;
+    for (; pageIndex < m_pages.size(); ++pageIndex)
+    {
+        if (_pack(m_pages[pageIndex], cellW + m_padding, cellH + m_padding, x, y))
+            break;
+    }
+
+    if (pageIndex == m_pages.size())
+    {
+        m_pages.push_back(_newPage());
+        if (!_pack(m_pages.back(), cellW + m_padding, cellH + m_padding, x, y))
+            throw std::runtime_error("Failed to pack image into an empty atlas page");
+    }
+
+    Page& page = m_pages[pageIndex];
+    SDL_Surface* surface = entry.cell.getSDL();
+    const SDL_Rect dstRect{x, y, cellW, cellH};
+    // The cell may have belonged to a removed region that queued quads still sample from
+    renderer::_flush();
+    if (!SDL_UpdateTexture(page.texture->getSDL(), &dstRect, surface->pixels, surface->pitch))
+        throw std::runtime_error("Failed to upload image to atlas: " + std::string(SDL_GetError()));
+
+    ++page.regionCount;
+    entry.pageIndex = pageIndex;
+    entry.slot->page = page.texture;
+    entry.slot->clipArea = {
+        x + m_extrude, y + m_extrude, cellW - m_extrude * 2, cellH - m_extrude * 2
+    };
+}
+
+#ifdef KRAKEN_ENABLE_PYTHON
+namespace texture_atlas
+{
+void _bind(const nb::module_& module)
+{
+    using namespace nb::literals;
+
+    nb::class_<AtlasRegion>(module, "AtlasRegion", R"doc(
+A lightweight handle to an image packed into a TextureAtlas.
+
+Regions can be passed anywhere a TextureRegion is accepted for drawing. Regions on the same
+atlas page are drawn in a single batch. Copies of a handle share their placement, so they stay
+valid when the atlas is repacked.
+    )doc")
+        .def_rw("flip", &AtlasRegion::flip, R"doc(
+The flip settings for horizontal and vertical mirroring of this region.
+        )doc")
+        .def_rw("tint", &AtlasRegion::tint, R"doc(
+The color tint applied when drawing this region.
+        )doc")
+        .def_rw("alpha", &AtlasRegion::alpha, R"doc(
+The alpha applied when drawing this region, as a float between `0.0` and `1.0`.
+        )doc")
+        .def_prop_ro("valid", &AtlasRegion::isValid, R"doc(
+Whether the region still exists in its atlas.
+        )doc")
+        .def_prop_ro("name", &AtlasRegion::getName, R"doc(
+The name the region was added under.
+        )doc")
+        .def_prop_ro("texture", &AtlasRegion::getTexture, R"doc(
+The atlas page texture holding this region.
+
+Raises:
+    RuntimeError: If the region has been removed from its atlas.
+        )doc")
+        .def_prop_ro("clip_area", &AtlasRegion::getClipArea, R"doc(
+The area of the page texture covered by this region, excluding padding and extrusion.
+        )doc")
+        .def_prop_ro("width", &AtlasRegion::getWidth, R"doc(
+The width of the region in pixels.
+        )doc")
+        .def_prop_ro("height", &AtlasRegion::getHeight, R"doc(
+The height of the region in pixels.
+        )doc")
+        .def_prop_ro("size", &AtlasRegion::getSize, R"doc(
+The dimensions of the region as a `Vec2`.
+        )doc")
+        .def("to_region", &AtlasRegion::toRegion, R"doc(
+Capture the current placement, flip, tint and alpha as a TextureRegion.
+
+The result keeps pointing at the old placement after a repack. Pass the AtlasRegion itself to draw
+calls to always use the latest one.
+
+Returns:
+    TextureRegion: The region as it is now.
+
+Raises:
+    RuntimeError: If the region has been removed from its atlas.
+        )doc");
+
+    nb::class_<TextureAtlas>(module, "TextureAtlas", R"doc(
+Packs many images into a few large page textures so they can be drawn in shared batches.
+
+Images are placed with a skyline packer. Each one is surrounded by `extrude` pixels of repeated
+edge color and separated from its neighbours by `padding` transparent pixels, which prevents
+bleeding under linear filtering. Removed regions leave holes until `repack()` is called.
+    )doc")
+        .def(
+            nb::init<int, int, int, int, FilterMode>(), "page_width"_a = 2048,
+            "page_height"_a = 2048, "padding"_a = 2, "extrude"_a = 1,
+            "filter"_a = FilterMode::Default, R"doc(
+Create an empty texture atlas.
+
+Args:
+    page_width (int, optional): Width of each page texture in pixels. Defaults to 2048.
+    page_height (int, optional): Height of each page texture in pixels. Defaults to 2048.
+    padding (int, optional): Transparent pixels between packed images. Defaults to 2.
+    extrude (int, optional): Pixels of repeated edge color around each image. Defaults to 1.
+    filter (FilterMode, optional): Scaling/filtering mode for the page textures.
+
+Raises:
+    ValueError: If the page size is not positive or padding/extrude is negative.
+        )doc"
+        )
+        .def(
+            "add", nb::overload_cast<const std::string&, const PixelArray&>(&TextureAtlas::add),
+            "name"_a, "pixel_array"_a, R"doc(
+Pack a PixelArray into the atlas.
+
+Args:
+    name (str): Unique name for the region.
+    pixel_array (PixelArray): The image to pack.
+
+Returns:
+    AtlasRegion: A handle to the packed image.
+
+Raises:
+    ValueError: If the name is already used or the image does not fit in a page.
+        )doc"
+        )
+        .def(
+            "add",
+            nb::overload_cast<const std::string&, const std::filesystem::path&>(&TextureAtlas::add),
+            "name"_a, "file_path"_a, R"doc(
+Load an image file and pack it into the atlas.
+
+Args:
+    name (str): Unique name for the region.
+    file_path (str | os.PathLike[str]): Path to the image file to load.
+
+Returns:
+    AtlasRegion: A handle to the packed image.
+
+Raises:
+    ValueError: If the name is already used or the image does not fit in a page.
+    RuntimeError: If the file cannot be loaded.
+        )doc"
+        )
+        .def("get", &TextureAtlas::get, "name"_a, R"doc(
+Get the region packed under a name.
+
+Args:
+    name (str): The region name.
+
+Returns:
+    AtlasRegion: A handle to the packed image.
+
+Raises:
+    IndexError: If no region has that name.
+        )doc")
+        .def("__contains__", &TextureAtlas::contains, "name"_a)
+        .def("__len__", &TextureAtlas::getRegionCount)
+        .def("remove", &TextureAtlas::remove, "name"_a, R"doc(
+Remove a region from the atlas. Existing handles to it become invalid.
+
+The space it occupied is reclaimed by the next `repack()`, or when its page becomes empty.
+
+Args:
+    name (str): The region name.
+        )doc")
+        .def("clear", &TextureAtlas::clear, R"doc(
+Remove every region and release all pages.
+        )doc")
+        .def("repack", &TextureAtlas::repack, R"doc(
+Pack all remaining regions again from scratch, reclaiming space left by removed regions.
+
+Existing handles stay valid and point at the new placement.
+        )doc")
+        .def("get_page", &TextureAtlas::getPage, "index"_a, R"doc(
+Get one of the atlas page textures.
+
+Args:
+    index (int): The page index.
+
+Returns:
+    Texture: The page texture.
+
+Raises:
+    IndexError: If the index is out of range.
+        )doc")
+        .def_prop_ro("page_count", &TextureAtlas::getPageCount, R"doc(
+The number of page textures in use.
+        )doc")
+        .def_prop_ro("page_size", &TextureAtlas::getPageSize, R"doc(
+The size of each page texture as a `Vec2`.
+        )doc")
+        .def_prop_ro("padding", &TextureAtlas::getPadding, R"doc(
+The transparent gap between packed images in pixels.
+        )doc")
+        .def_prop_ro("extrude", &TextureAtlas::getExtrude, R"doc(
+The number of edge pixels repeated around each packed image.
+        )doc")
+        .def_prop_ro("occupancy", &TextureAtlas::getOccupancy, R"doc(
+The fraction of total page area covered by live regions, between `0.0` and `1.0`.
+        )doc");
+}
+}  // namespace texture_atlas
+#endif  // KRAKEN_ENABLE_PYTHON
+
+}  // namespace kn
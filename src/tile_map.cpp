@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <stdexcept>
+#include <string>
 
 #include "TileMap.hpp"
 
@@ -29,6 +31,7 @@
 #include "PixelArray.hpp"
 #include "Polygon.hpp"
 #include "Renderer.hpp"
+#include "_frame_stats.hpp"
 
 #ifndef M_PI
 #define M_PI 3.1415926535897932384626433832795
@@ -274,6 +277,13 @@ void Map::load(const std::filesystem::path& tmxPath)
                     mapObj.m_vertices.emplace_back(point.x, point.y);
                 }
 
+                // Drawing reuses these triangles instead of running earcut every frame
+                if (mapObj.m_shape == tmx::Object::Shape::Polygon)
+                {
+                    mapObj.m_polygon.setPoints(mapObj.m_vertices);
+                    (void)mapObj.m_polygon.getTriangles();
+                }
+
                 const auto& tmxText = tmxObject.getText();
                 mapObj.m_text = TextProperties{
                     tmxText.fontFamily,
@@ -330,11 +340,13 @@ void Map::load(const std::filesystem::path& tmxPath)
             imgLayer->offset = {tileOffset.x, tileOffset.y};
             imgLayer->visible = tmxImgLayer.getVisible();
 
-            PixelArray pa(tmxImgLayer.getImagePath());
+            imgLayer->m_imagePath = tmxImgLayer.getImagePath();
+            PixelArray pa(imgLayer->m_imagePath);
             if (tmxImgLayer.hasTransparency())
             {
                 const tmx::Colour& c = tmxImgLayer.getTransparencyColour();
-                pa.setColorKey({c.r, c.g, c.b, c.a});
+                imgLayer->m_colorKey = Color{c.r, c.g, c.b, c.a};
+                pa.setColorKey(*imgLayer->m_colorKey);
             }
             imgLayer->m_texture = std::make_shared<Texture>(pa);
 
@@ -375,11 +387,13 @@ void Map::load(const std::filesystem::path& tmxPath)
         tileSet.m_columns = tmxTileset.getColumnCount();
         tileSet.m_tileOffset = {tsTileOffset.x, tsTileOffset.y};
 
-        PixelArray pa(tmxTileset.getImagePath());
+        tileSet.m_imagePath = tmxTileset.getImagePath();
+        PixelArray pa(tileSet.m_imagePath);
         if (tmxTileset.hasTransparency())
         {
             const tmx::Colour& c = tmxTileset.getTransparencyColour();
-            pa.setColorKey({c.r, c.g, c.b, c.a});
+            tileSet.m_colorKey = Color{c.r, c.g, c.b, c.a};
+            pa.setColorKey(*tileSet.m_colorKey);
         }
         tileSet.m_texture = std::make_shared<Texture>(pa);
 
@@ -496,6 +510,70 @@ void Map::load(const std::filesystem::path& tmxPath)
         m_tileSets.push_back(std::move(tileSet));
     }
 
+    _buildTileRefs();
+}
+
+// Whether an orthogonal tile drawn at the top left of its cell covers anything outside the cell.
+// A diagonal flip turns the tile a quarter turn about its center, swapping its reach per axis.
+static bool reachesPastCell(const Rect& clip, const Vec2& cellSize, const uint8_t flipFlags)
+{
+    const bool turned = (flipFlags & tmx::TileLayer::FlipFlag::Diagonal) != 0;
+    const double halfW = clip.w * 0.5;
+    const double halfH = clip.h * 0.5;
+    const double reachX = turned ? halfH : halfW;
+    const double reachY = turned ? halfW : halfH;
+    return halfW - reachX < 0.0 || halfW + reachX > cellSize.x || halfH - reachY < 0.0 ||
+           halfH + reachY > cellSize.y;
+}
+
+void Map::_buildTileRefs()
+{
+    m_tileRefs.clear();
+    m_tilesOverlap = m_orient != tmx::Orientation::Orthogonal;
+
+    uint32_t maxGID = 0;
+    for (const TileSet& tileSet : m_tileSets)
+    {
+        if (tileSet.m_tileCount > 0)
+            maxGID = std::max(maxGID, tileSet.m_lastGID);
+    }
+    m_tileRefs.resize(static_cast<size_t>(maxGID) + 1);
+
+    m_maxTileExtent = std::max(m_tileSize.x, m_tileSize.y);
+    for (size_t tsIdx = 0; tsIdx < m_tileSets.size() && tsIdx < 0xFF; ++tsIdx)
+    {
+        const TileSet& tileSet = m_tileSets[tsIdx];
+        if (!tileSet.m_texture || tileSet.m_tileCount == 0)
+            continue;
+
+        const double texW = tileSet.m_texture->getWidth();
+        const double texH = tileSet.m_texture->getHeight();
+
+        for (uint32_t gid = tileSet.m_firstGID; gid <= tileSet.m_lastGID; ++gid)
+        {
+            TileRef& ref = m_tileRefs[gid];
+            // Earlier tilesets win where GID ranges overlap, like the lookup they replace
+            if (ref.tileSetIndex != static_cast<uint8_t>(-1))
+                continue;
+
+            const TileSet::Tile* tile = tileSet.getTile(gid);
+            if (!tile)
+                continue;
+
+            const Rect clip = tile->getClipArea();
+            ref.tileSetIndex = static_cast<uint8_t>(tsIdx);
+            ref.clipArea = clip;
+            ref.u1 = static_cast<float>(clip.x / texW);
+            ref.v1 = static_cast<float>(clip.y / texH);
+            ref.u2 = static_cast<float>((clip.x + clip.w) / texW);
+            ref.v2 = static_cast<float>((clip.y + clip.h) / texH);
+
+            m_maxTileExtent = std::max(m_maxTileExtent, std::max(clip.w, clip.h));
+            if (reachesPastCell(clip, m_tileSize, 0))
+                m_tilesOverlap = true;
+        }
+    }
+
     // Populate tileset index for each tile in tile layers to avoid per-tile
     // tileset lookups during rendering.
     for (auto& layerPtr : m_layers)
@@ -506,16 +584,15 @@ void Map::load(const std::filesystem::path& tmxPath)
         auto* tileLayer = static_cast<TileLayer*>(layerPtr.get());
         for (auto& tile : tileLayer->m_tiles)
         {
-            const uint32_t gid = tile.m_id;
-            if (gid == 0)
+            if (tile.m_id == 0 || tile.m_id >= m_tileRefs.size())
                 continue;
-            for (size_t tsIdx = 0; tsIdx < m_tileSets.size(); ++tsIdx)
+
+            const TileRef& ref = m_tileRefs[tile.m_id];
+            tile.m_tilesetIdx = ref.tileSetIndex;
+            if (ref.tileSetIndex != static_cast<uint8_t>(-1) &&
+                reachesPastCell(ref.clipArea, m_tileSize, tile.m_flipFlags))
             {
-                if (m_tileSets[tsIdx].hasTile(gid))
-                {
-                    tile.m_tilesetIdx = static_cast<uint8_t>(tsIdx);
-                    break;
-                }
+                m_tilesOverlap = true;
             }
         }
     }
@@ -756,7 +833,7 @@ static constexpr FlipInfo kFlipLUT[8] = {
     {0.0f, false, true},             // 2: V
     {0.0f, true, true},              // 3: H|V
     {+float(M_PI_2), false, true},   // 4: D
-    {+float(M_PI_2), true, false},   // 5: D|H
+    {+float(M_PI_2), false, false},  // 5: D|H
     {-float(M_PI_2), false, false},  // 6: D|V
     {-float(M_PI_2), false, true},   // 7: D|H|V
 };
@@ -782,11 +859,89 @@ static HexTransformInfo decodeHexTransform(const uint8_t rawFlipFlags)
     return {rotation, h, v};
 }
 
+static FlipInfo decodeFlipFlags(const uint8_t rawFlipFlags)
+{
+    // Normalize to LUT bits H=0x1, V=0x2, D=0x4.
+    const uint8_t lutFlipFlags =
+        ((rawFlipFlags & tmx::TileLayer::FlipFlag::Horizontal) ? 0x1 : 0x0) |
+        ((rawFlipFlags & tmx::TileLayer::FlipFlag::Vertical) ? 0x2 : 0x0) |
+        ((rawFlipFlags & tmx::TileLayer::FlipFlag::Diagonal) ? 0x4 : 0x0);
+
+    return kFlipLUT[lutFlipFlags];
+}
+
+// Corners of a w x h quad turned about its center, in TL, TR, BR, BL order
+static void quadCorners(
+    const Vec2& center, const double w, const double h, const double angle, double (&cornerX)[4],
+    double (&cornerY)[4]
+)
+{
+    const double c = angle != 0.0 ? std::cos(angle) : 1.0;
+    const double s = angle != 0.0 ? std::sin(angle) : 0.0;
+
+    const double localX[4] = {-w * 0.5, w * 0.5, w * 0.5, -w * 0.5};
+    const double localY[4] = {-h * 0.5, -h * 0.5, h * 0.5, h * 0.5};
+    for (int i = 0; i < 4; ++i)
+    {
+        cornerX[i] = center.x + localX[i] * c - localY[i] * s;
+        cornerY[i] = center.y + localX[i] * s + localY[i] * c;
+    }
+}
+
+static bool isQuadOffscreen(
+    const double (&cornerX)[4], const double (&cornerY)[4], const Vec2& resolution
+)
+{
+    const auto [minX, maxX] = std::minmax({cornerX[0], cornerX[1], cornerX[2], cornerX[3]});
+    const auto [minY, maxY] = std::minmax({cornerY[0], cornerY[1], cornerY[2], cornerY[3]});
+    return maxX < 0.0 || minX >= resolution.x || maxY < 0.0 || minY >= resolution.y;
+}
+
+// Flips swap the texture coordinates instead of touching the tileset texture
+static void appendQuad(
+    std::vector<SDL_Vertex>& quads, const double (&cornerX)[4], const double (&cornerY)[4],
+    const SDL_FColor& color, float u1, float v1, float u2, float v2, const bool flipH,
+    const bool flipV
+)
+{
+    if (flipH)
+        std::swap(u1, u2);
+    if (flipV)
+        std::swap(v1, v2);
+
+    const float u[4] = {u1, u2, u2, u1};
+    const float v[4] = {v1, v1, v2, v2};
+    for (int i = 0; i < 4; ++i)
+    {
+        quads.push_back(
+            {{static_cast<float>(cornerX[i]), static_cast<float>(cornerY[i])}, color, {u[i], v[i]}}
+        );
+    }
+}
+
+// Quads for each tileset, filled and submitted within one layer draw or chunk bake
+static std::vector<std::vector<SDL_Vertex>> tileSetQuads;
+
+// Test hook: when off, tile layers visit every cell, so the narrowed ranges can be compared with a
+// full pass. Tiles still go through the per-quad screen test either way.
+static bool rangeCulling = true;
+
+static void submitTileSetQuads(const std::vector<TileSet>& tileSets, const size_t tileSetIndex)
+{
+    std::vector<SDL_Vertex>& quads = tileSetQuads[tileSetIndex];
+    renderer::_submitBatch(
+        tileSets[tileSetIndex].getTexture()->getSDL(), quads.data(), quads.size() / 4, 0, 0.0
+    );
+    quads.clear();
+}
+
 void TileLayer::draw(const double angle, const Vec2& pivot)
 {
     if (!visible)
         return;
 
+    const renderer::stats::DrawScope drawScope;
+
     const auto mapW = static_cast<int>(m_map->getMapSize().x);
     const auto mapH = static_cast<int>(m_map->getMapSize().y);
     const auto tileW = static_cast<int>(m_map->getTileSize().x);
@@ -799,53 +954,141 @@ void TileLayer::draw(const double angle, const Vec2& pivot)
     if (m_tiles.size() < expectedTileCount)
         return;
 
-    const auto orient = m_map->getOrientation();
+    auto color = static_cast<SDL_FColor>(tint);
+    color.a *= static_cast<float>(m_opacity);
+    if (color.a <= 0.0f)
+        return;
 
-    int camMinX = 0;
-    int camMinY = 0;
-    int camMaxX = mapW - 1;
-    int camMaxY = mapH - 1;
+    const auto orient = m_map->getOrientation();
+    if (m_cacheEnabled && orient == tmx::Orientation::Orthogonal && !m_map->m_tilesOverlap)
+    {
+        _drawChunks(angle, pivot, color);
+        return;
+    }
 
     const bool rotateLayer = angle != 0.0;
     const Vec2 pivotWorld = rotateLayer ? getMapPivotWorld(m_map, pivot) : Vec2{};
 
-    if (orient == tmx::Orientation::Orthogonal && !rotateLayer)
+    const auto halfTileW = static_cast<double>(tileW) * 0.5;
+    const auto halfTileH = static_cast<double>(tileH) * 0.5;
+    const auto isoOriginX = offset.x + static_cast<double>(mapH - 1) * halfTileW;
+    const auto isoOriginY = offset.y;
+
+    const auto staggerAxis = m_map->getStaggerAxis();
+    const auto staggerIndex = m_map->getStaggerIndex();
+    const double hexSideLength = (orient == tmx::Orientation::Hexagonal) ? m_map->getHexSideLength()
+                                                                         : 0.0;
+
+    const double sideLengthX = (staggerAxis == tmx::StaggerAxis::X) ? hexSideLength : 0.0;
+    const double sideLengthY = (staggerAxis == tmx::StaggerAxis::Y) ? hexSideLength : 0.0;
+    const double columnWidth = (static_cast<double>(tileW) + sideLengthX) * 0.5;
+    const double rowHeight = (static_cast<double>(tileH) + sideLengthY) * 0.5;
+    const double stepXStaggerY = static_cast<double>(tileW) + sideLengthX;
+    const double stepYStaggerX = static_cast<double>(tileH) + sideLengthY;
+
+    const bool isStaggerLayout =
+        orient == tmx::Orientation::Staggered || orient == tmx::Orientation::Hexagonal;
+
+    const auto isStaggeredCoord = [staggerIndex](const int v)
     {
-        // Compute a conservative world-space camera coverage from all screen corners so
-        // culling remains correct even when the active camera is rotated.
-        const Rect rendSize{renderer::getCurrentResolution()};
-        const std::array<Vec2, 4> worldCorners = {
-            camera::screenToWorld(rendSize.getTopLeft()),
-            camera::screenToWorld(rendSize.getTopRight()),
-            camera::screenToWorld(rendSize.getBottomLeft()),
-            camera::screenToWorld(rendSize.getBottomRight()),
-        };
-
-        auto [camLeft, camTop] = worldCorners[0];
-        auto [camRight, camBottom] = worldCorners[0];
-        for (const Vec2& corner : worldCorners)
-        {
-            camLeft = std::min(camLeft, corner.x);
-            camTop = std::min(camTop, corner.y);
-            camRight = std::max(camRight, corner.x);
-            camBottom = std::max(camBottom, corner.y);
-        }
+        const bool isEven = (v & 1) == 0;
+        return (staggerIndex == tmx::StaggerIndex::Even) ? isEven : !isEven;
+    };
 
-        // Expand by one tile to hide precision edge artifacts while rotating.
-        camMinX = static_cast<int>(std::floor((camLeft - offset.x) / tileW)) - 1;
-        camMinY = static_cast<int>(std::floor((camTop - offset.y) / tileH)) - 1;
-        camMaxX = static_cast<int>(std::floor((camRight - offset.x) / tileW)) + 1;
-        camMaxY = static_cast<int>(std::floor((camBottom - offset.y) / tileH)) + 1;
+    // Compute a conservative camera coverage from all screen corners, taken back into the
+    // layer's unrotated space, so culling remains correct when the camera or layer is rotated.
+    const Rect rendSize{renderer::getCurrentResolution()};
+    const std::array<Vec2, 4> worldCorners = {
+        rotatePoint(camera::screenToWorld(rendSize.getTopLeft()), pivotWorld, -angle),
+        rotatePoint(camera::screenToWorld(rendSize.getTopRight()), pivotWorld, -angle),
+        rotatePoint(camera::screenToWorld(rendSize.getBottomLeft()), pivotWorld, -angle),
+        rotatePoint(camera::screenToWorld(rendSize.getBottomRight()), pivotWorld, -angle),
+    };
 
-        camMinX = std::max(0, std::min(mapW - 1, camMinX));
-        camMinY = std::max(0, std::min(mapH - 1, camMinY));
-        camMaxX = std::max(0, std::min(mapW - 1, camMaxX));
-        camMaxY = std::max(0, std::min(mapH - 1, camMaxY));
+    auto [camLeft, camTop] = worldCorners[0];
+    auto [camRight, camBottom] = worldCorners[0];
+    for (const Vec2& corner : worldCorners)
+    {
+        camLeft = std::min(camLeft, corner.x);
+        camTop = std::min(camTop, corner.y);
+        camRight = std::max(camRight, corner.x);
+        camBottom = std::max(camBottom, corner.y);
     }
 
+    // A tile turned about its center stays within 1.5 times its largest side of the top left
+    // corner of its cell, so the cells below are those whose corner lies in the grown coverage.
+    const double margin = 1.5 * m_map->m_maxTileExtent;
+    camLeft -= margin;
+    camTop -= margin;
+    camRight += margin;
+    camBottom += margin;
+
+    // Cell ranges invert each layout's cell placement used in the loop below
+    double minCellX, maxCellX, minCellY, maxCellY;
+
+    // Isometric cells are placed along a = x - y and b = x + y, so the camera covers a diamond
+    // of cells that is cut per row instead of by its bounding box
+    const bool isIsometric = orient == tmx::Orientation::Isometric;
+    const double isoMinA = (camLeft - isoOriginX) / halfTileW;
+    const double isoMaxA = (camRight - isoOriginX) / halfTileW;
+    const double isoMinB = (camTop - isoOriginY) / halfTileH;
+    const double isoMaxB = (camBottom - isoOriginY) / halfTileH;
+
+    if (isIsometric)
+    {
+        minCellX = (isoMinA + isoMinB) * 0.5;
+        maxCellX = (isoMaxA + isoMaxB) * 0.5;
+        minCellY = (isoMinB - isoMaxA) * 0.5;
+        maxCellY = (isoMaxB - isoMinA) * 0.5;
+    }
+    else if (isStaggerLayout && staggerAxis == tmx::StaggerAxis::Y)
+    {
+        // Staggered rows are shifted right by half a column
+        minCellX = (camLeft - offset.x - columnWidth) / stepXStaggerY;
+        maxCellX = (camRight - offset.x) / stepXStaggerY;
+        minCellY = (camTop - offset.y) / rowHeight;
+        maxCellY = (camBottom - offset.y) / rowHeight;
+    }
+    else if (isStaggerLayout && staggerAxis == tmx::StaggerAxis::X)
+    {
+        // Staggered columns are shifted down by half a row
+        minCellX = (camLeft - offset.x) / columnWidth;
+        maxCellX = (camRight - offset.x) / columnWidth;
+        minCellY = (camTop - offset.y - rowHeight) / stepYStaggerX;
+        maxCellY = (camBottom - offset.y) / stepYStaggerX;
+    }
+    else
+    {
+        minCellX = (camLeft - offset.x) / tileW;
+        maxCellX = (camRight - offset.x) / tileW;
+        minCellY = (camTop - offset.y) / tileH;
+        maxCellY = (camBottom - offset.y) / tileH;
+    }
+
+    // Clamped before the cast, as a camera far from the map would overflow an int
+    const auto firstCell = [](const double cell, const int count)
+    {
+        const double clamped = std::clamp(std::ceil(cell), 0.0, static_cast<double>(count));
+        return static_cast<int>(clamped);
+    };
+    const auto lastCell = [](const double cell, const int count)
+    {
+        const double clamped = std::clamp(std::floor(cell), -1.0, static_cast<double>(count - 1));
+        return static_cast<int>(clamped);
+    };
+
+    const int camMinX = rangeCulling ? firstCell(minCellX, mapW) : 0;
+    const int camMinY = rangeCulling ? firstCell(minCellY, mapH) : 0;
+    const int camMaxX = rangeCulling ? lastCell(maxCellX, mapW) : mapW - 1;
+    const int camMaxY = rangeCulling ? lastCell(maxCellY, mapH) : mapH - 1;
+
     if (camMinX > camMaxX || camMinY > camMaxY)
+    {
+        renderer::stats::countSprites(0, expectedTileCount);
         return;
+    }
 
+    // Narrowing the ranges keeps the painter's order of the render order
     int startX, endX, stepX;
     int startY, endY, stepY;
 
@@ -886,127 +1129,425 @@ void TileLayer::draw(const double angle, const Vec2& pivot)
         break;
     }
 
-    Transform renderTransform{};
-    renderTransform.pos = offset;
+    const camera::View& view = camera::getView();
+    const double baseAngle = (rotateLayer ? angle : 0.0) + view.angle;
 
-    const auto layerAlpha = static_cast<float>(m_opacity);
-    const auto halfTileW = static_cast<double>(tileW) * 0.5;
-    const auto halfTileH = static_cast<double>(tileH) * 0.5;
-    const auto isoOriginX = offset.x + static_cast<double>(mapH - 1) * halfTileW;
-    const auto isoOriginY = offset.y;
+    // Submitted as one geometry call per tileset. Tiles that can reach past their cell may
+    // overlap, so their draw order is kept by submitting whenever the tileset changes instead.
+    const auto& tileSets = m_map->getTileSets();
+    const auto& tileRefs = m_map->m_tileRefs;
+    tileSetQuads.resize(std::max(tileSetQuads.size(), tileSets.size()));
 
-    const auto staggerAxis = m_map->getStaggerAxis();
-    const auto staggerIndex = m_map->getStaggerIndex();
-    const double hexSideLength = (orient == tmx::Orientation::Hexagonal) ? m_map->getHexSideLength()
-                                                                         : 0.0;
-
-    const double sideLengthX = (staggerAxis == tmx::StaggerAxis::X) ? hexSideLength : 0.0;
-    const double sideLengthY = (staggerAxis == tmx::StaggerAxis::Y) ? hexSideLength : 0.0;
-    const double columnWidth = (static_cast<double>(tileW) + sideLengthX) * 0.5;
-    const double rowHeight = (static_cast<double>(tileH) + sideLengthY) * 0.5;
-    const double stepXStaggerY = static_cast<double>(tileW) + sideLengthX;
-    const double stepYStaggerX = static_cast<double>(tileH) + sideLengthY;
-
-    const auto isStaggeredCoord = [staggerIndex](const int v)
-    {
-        const bool isEven = (v & 1) == 0;
-        return (staggerIndex == tmx::StaggerIndex::Even) ? isEven : !isEven;
-    };
+    const bool keepOrder = m_map->m_tilesOverlap;
+    size_t lastTileSet = tileSets.size();
+    size_t drawnTiles = 0;
+    size_t culledTiles = 0;
+    size_t visitedTiles = 0;
 
     const int endYExclusive = endY + stepY;
-    const int endXExclusive = endX + stepX;
 
     for (int y = startY; y != endYExclusive; y += stepY)
     {
+        int rowStartX = startX;
+        int rowEndX = endX;
+        if (isIsometric && rangeCulling)
+        {
+            // Cells of this row whose a and b both fall in the camera's ranges
+            const double rowMinCellX = std::max(isoMinA + y, isoMinB - y);
+            const double rowMaxCellX = std::min(isoMaxA + y, isoMaxB - y);
+            const int rowMinX = std::max(camMinX, firstCell(rowMinCellX, mapW));
+            const int rowMaxX = std::min(camMaxX, lastCell(rowMaxCellX, mapW));
+            if (rowMinX > rowMaxX)
+                continue;
+
+            rowStartX = stepX > 0 ? rowMinX : rowMaxX;
+            rowEndX = stepX > 0 ? rowMaxX : rowMinX;
+        }
+
+        visitedTiles += static_cast<size_t>(std::abs(rowEndX - rowStartX) + 1);
+        const int rowEndXExclusive = rowEndX + stepX;
         const auto rowBase = static_cast<size_t>(y * mapW);
 
-        for (int x = startX; x != endXExclusive; x += stepX)
+        for (int x = rowStartX; x != rowEndXExclusive; x += stepX)
         {
             const TileLayer::Tile& tile = m_tiles[rowBase + static_cast<size_t>(x)];
             const uint32_t gid = tile.getID();
-            if (gid == 0)
-                continue;
-
-            const uint8_t tilesetIndex = tile.getTilesetIndex();
-            const auto& tileSets = m_map->getTileSets();
-            if (tilesetIndex >= tileSets.size())
+            if (gid == 0 || gid >= tileRefs.size())
                 continue;
 
-            const TileSet& foundSet = tileSets[tilesetIndex];
-            const TileSet::Tile* setTile = foundSet.getTile(gid);
-            const auto setTexture = foundSet.getTexture();
-            if (!setTile || !setTexture)
+            const Map::TileRef& ref = tileRefs[gid];
+            if (ref.tileSetIndex >= tileSets.size())
                 continue;
 
-            setTexture->setAlpha(layerAlpha);
+            Vec2 pos;
             if (orient == tmx::Orientation::Isometric)
             {
-                renderTransform.pos =
-                    {isoOriginX + (static_cast<double>(x) - static_cast<double>(y)) * halfTileW,
-                     isoOriginY + (static_cast<double>(x) + static_cast<double>(y)) * halfTileH};
+                pos = {isoOriginX + (static_cast<double>(x) - static_cast<double>(y)) * halfTileW,
+                       isoOriginY + (static_cast<double>(x) + static_cast<double>(y)) * halfTileH};
             }
             else if (orient == tmx::Orientation::Staggered || orient == tmx::Orientation::Hexagonal)
             {
                 if (staggerAxis == tmx::StaggerAxis::Y)
                 {
-                    renderTransform.pos =
-                        {offset.x + static_cast<double>(x) * stepXStaggerY +
-                             (isStaggeredCoord(y) ? columnWidth : 0.0),
-                         offset.y + static_cast<double>(y) * rowHeight};
+                    pos = {offset.x + static_cast<double>(x) * stepXStaggerY +
+                               (isStaggeredCoord(y) ? columnWidth : 0.0),
+                           offset.y + static_cast<double>(y) * rowHeight};
                 }
                 else if (staggerAxis == tmx::StaggerAxis::X)
                 {
-                    renderTransform.pos =
-                        {offset.x + static_cast<double>(x) * columnWidth,
-                         offset.y + static_cast<double>(y) * stepYStaggerX +
-                             (isStaggeredCoord(x) ? rowHeight : 0.0)};
+                    pos = {offset.x + static_cast<double>(x) * columnWidth,
+                           offset.y + static_cast<double>(y) * stepYStaggerX +
+                               (isStaggeredCoord(x) ? rowHeight : 0.0)};
                 }
                 else
                 {
-                    renderTransform.pos =
-                        {offset.x + static_cast<double>(x * tileW),
-                         offset.y + static_cast<double>(y * tileH)};
+                    pos = {offset.x + static_cast<double>(x * tileW),
+                           offset.y + static_cast<double>(y * tileH)};
                 }
             }
             else
             {
-                renderTransform.pos =
-                    {offset.x + static_cast<double>(x * tileW),
-                     offset.y + static_cast<double>(y * tileH)};
+                pos = {offset.x + static_cast<double>(x * tileW),
+                       offset.y + static_cast<double>(y * tileH)};
             }
 
+            float tileAngle;
+            bool flipH;
+            bool flipV;
             const uint8_t rawFlipFlags = tile.getFlipFlags();
             if (orient == tmx::Orientation::Hexagonal)
             {
                 const HexTransformInfo hexInfo = decodeHexTransform(rawFlipFlags);
-                renderTransform.angle = hexInfo.rotation;
-                setTexture->flip.h = hexInfo.h;
-                setTexture->flip.v = hexInfo.v;
+                tileAngle = hexInfo.rotation;
+                flipH = hexInfo.h;
+                flipV = hexInfo.v;
             }
             else
             {
-                // Normalize to LUT bits H=0x1, V=0x2, D=0x4.
-                const uint8_t lutFlipFlags =
-                    ((rawFlipFlags & tmx::TileLayer::FlipFlag::Horizontal) ? 0x1 : 0x0) |
-                    ((rawFlipFlags & tmx::TileLayer::FlipFlag::Vertical) ? 0x2 : 0x0) |
-                    ((rawFlipFlags & tmx::TileLayer::FlipFlag::Diagonal) ? 0x4 : 0x0);
-
-                const FlipInfo flipInfo = kFlipLUT[lutFlipFlags];
-                renderTransform.angle = flipInfo.rotation;
-                setTexture->flip.h = flipInfo.h;
-                setTexture->flip.v = flipInfo.v;
+                const FlipInfo flipInfo = decodeFlipFlags(rawFlipFlags);
+                tileAngle = flipInfo.rotation;
+                flipH = flipInfo.h;
+                flipV = flipInfo.v;
             }
 
             if (rotateLayer)
+                pos = rotatePoint(pos, pivotWorld, angle);
+
+            // The tile's top left corner sits on pos, and it turns about its center like a sprite
+            const double w = ref.clipArea.w * view.zoom;
+            const double h = ref.clipArea.h * view.zoom;
+            const Vec2 center = view.worldToScreen(pos) + Vec2{w * 0.5, h * 0.5};
+
+            double cornerX[4];
+            double cornerY[4];
+            quadCorners(center, w, h, tileAngle + baseAngle, cornerX, cornerY);
+            if (isQuadOffscreen(cornerX, cornerY, view.resolution))
             {
-                renderTransform.pos = rotatePoint(renderTransform.pos, pivotWorld, angle);
-                renderTransform.angle += angle;
+                ++culledTiles;
+                continue;
             }
 
-            setTexture->setClipArea(setTile->getClipArea());
-            renderer::draw(*setTexture, renderTransform);
+            if (keepOrder && lastTileSet != ref.tileSetIndex && lastTileSet < tileSets.size())
+                submitTileSetQuads(tileSets, lastTileSet);
+            lastTileSet = ref.tileSetIndex;
+
+            appendQuad(
+                tileSetQuads[ref.tileSetIndex], cornerX, cornerY, color, ref.u1, ref.v1, ref.u2,
+                ref.v2, flipH, flipV
+            );
+            ++drawnTiles;
         }
     }
+
+    // Tiles outside the camera range are never visited
+    renderer::stats::countSprites(drawnTiles, culledTiles + expectedTileCount - visitedTiles);
+    for (size_t i = 0; i < tileSets.size(); ++i)
+    {
+        if (!tileSetQuads[i].empty())
+            submitTileSetQuads(tileSets, i);
+    }
+}
+
+void TileLayer::_drawChunks(const double angle, const Vec2& pivot, const SDL_FColor& color)
+{
+    const auto mapW = static_cast<int>(m_map->getMapSize().x);
+    const auto mapH = static_cast<int>(m_map->getMapSize().y);
+    const auto tileW = static_cast<double>(m_map->getTileSize().x);
+    const auto tileH = static_cast<double>(m_map->getTileSize().y);
+
+    const int chunkColumns = (mapW + m_chunkSize - 1) / m_chunkSize;
+    const int chunkRows = (mapH + m_chunkSize - 1) / m_chunkSize;
+    const auto chunkCount = static_cast<size_t>(chunkColumns) * static_cast<size_t>(chunkRows);
+    if (m_chunks.size() != chunkCount || m_chunkColumns != chunkColumns)
+    {
+        invalidateCache();
+        m_chunks.resize(chunkCount);
+        m_chunkColumns = chunkColumns;
+    }
+
+    const camera::View& view = camera::getView();
+    const Vec2 pivotWorld = angle != 0.0 ? getMapPivotWorld(m_map, pivot) : Vec2{};
+    ++m_drawCount;
+
+    // Chunks hold premultiplied color, so the opacity scales the color as well
+    const SDL_FColor chunkColor{color.r * color.a, color.g * color.a, color.b * color.a, color.a};
+
+    struct VisibleChunk
+    {
+        size_t index;
+        double cornerX[4];
+        double cornerY[4];
+    };
+    static std::vector<VisibleChunk> visibleChunks;
+    visibleChunks.clear();
+
+    for (int cy = 0; cy < chunkRows; ++cy)
+    {
+        for (int cx = 0; cx < chunkColumns; ++cx)
+        {
+            const int columns = std::min(m_chunkSize, mapW - cx * m_chunkSize);
+            const int rows = std::min(m_chunkSize, mapH - cy * m_chunkSize);
+            const Vec2 topLeft = offset + Vec2{cx * m_chunkSize * tileW, cy * m_chunkSize * tileH};
+            const Vec2 size{columns * tileW, rows * tileH};
+            const Vec2 worldCorners[4] = {
+                topLeft, topLeft + Vec2{size.x, 0.0}, topLeft + size, topLeft + Vec2{0.0, size.y}
+            };
+
+            VisibleChunk chunk{static_cast<size_t>(cy) * chunkColumns + cx, {}, {}};
+            for (int i = 0; i < 4; ++i)
+            {
+                const Vec2 corner = rotatePoint(worldCorners[i], pivotWorld, angle);
+                const Vec2 screenCorner = view.worldToScreen(corner);
+                chunk.cornerX[i] = screenCorner.x;
+                chunk.cornerY[i] = screenCorner.y;
+            }
+
+            if (!isQuadOffscreen(chunk.cornerX, chunk.cornerY, view.resolution))
+                visibleChunks.push_back(chunk);
+        }
+    }
+
+    // Baking switches render targets, so every chunk is baked before any is drawn
+    for (const VisibleChunk& visibleChunk : visibleChunks)
+    {
+        Chunk& chunk = m_chunks[visibleChunk.index];
+        chunk.lastDrawn = m_drawCount;
+        if (chunk.valid)
+            continue;
+
+        const int x0 = static_cast<int>(visibleChunk.index % chunkColumns) * m_chunkSize;
+        const int y0 = static_cast<int>(visibleChunk.index / chunkColumns) * m_chunkSize;
+        _bakeChunk(
+            chunk, x0, y0, std::min(m_chunkSize, mapW - x0), std::min(m_chunkSize, mapH - y0)
+        );
+    }
+
+    for (const VisibleChunk& visibleChunk : visibleChunks)
+    {
+        SDL_Vertex quad[4];
+        const float u[4] = {0.0f, 1.0f, 1.0f, 0.0f};
+        const float v[4] = {0.0f, 0.0f, 1.0f, 1.0f};
+        for (int i = 0; i < 4; ++i)
+        {
+            quad[i] = {
+                {static_cast<float>(visibleChunk.cornerX[i]),
+                 static_cast<float>(visibleChunk.cornerY[i])},
+                chunkColor,
+                {u[i], v[i]}
+            };
+        }
+
+        renderer::_submitBatch(m_chunks[visibleChunk.index].texture->getSDL(), quad, 1, 0, 0.0);
+    }
+
+    renderer::stats::countSprites(visibleChunks.size(), chunkCount - visibleChunks.size());
+    _evictChunks();
+}
+
+void TileLayer::_bakeChunk(
+    Chunk& chunk, const int x0, const int y0, const int columns, const int rows
+)
+{
+    const auto mapW = static_cast<int>(m_map->getMapSize().x);
+    const auto tileW = static_cast<double>(m_map->getTileSize().x);
+    const auto tileH = static_cast<double>(m_map->getTileSize().y);
+
+    if (!chunk.texture)
+    {
+        const auto width = static_cast<int>(columns * tileW);
+        const auto height = static_cast<int>(rows * tileH);
+        chunk.texture = std::make_shared<Texture>(width, height);
+
+        // Blending onto a cleared target leaves premultiplied color behind
+        if (!SDL_SetTextureBlendMode(chunk.texture->getSDL(), SDL_BLENDMODE_BLEND_PREMULTIPLIED))
+        {
+            throw std::runtime_error(
+                "Failed to set chunk blend mode: " + std::string(SDL_GetError())
+            );
+        }
+
+        chunk.bytes = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+        m_cacheSize += chunk.bytes;
+    }
+
+    const auto& tileSets = m_map->getTileSets();
+    const auto& tileRefs = m_map->m_tileRefs;
+    tileSetQuads.resize(std::max(tileSetQuads.size(), tileSets.size()));
+
+    const SDL_FColor white{1.0f, 1.0f, 1.0f, 1.0f};
+    for (int y = y0; y < y0 + rows; ++y)
+    {
+        for (int x = x0; x < x0 + columns; ++x)
+        {
+            const Tile& tile = m_tiles[static_cast<size_t>(y) * mapW + x];
+            const uint32_t gid = tile.getID();
+            if (gid == 0 || gid >= tileRefs.size())
+                continue;
+
+            const Map::TileRef& ref = tileRefs[gid];
+            if (ref.tileSetIndex >= tileSets.size())
+                continue;
+
+            // Cached maps have no tiles reaching past their cell, so the chunk holds them all
+            const FlipInfo flipInfo = decodeFlipFlags(tile.getFlipFlags());
+            const double w = ref.clipArea.w;
+            const double h = ref.clipArea.h;
+            const Vec2 center{(x - x0) * tileW + w * 0.5, (y - y0) * tileH + h * 0.5};
+
+            double cornerX[4];
+            double cornerY[4];
+            quadCorners(center, w, h, flipInfo.rotation, cornerX, cornerY);
+            appendQuad(
+                tileSetQuads[ref.tileSetIndex], cornerX, cornerY, white, ref.u1, ref.v1, ref.u2,
+                ref.v2, flipInfo.h, flipInfo.v
+            );
+        }
+    }
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer::_get());
+    renderer::_setTargetSDL(chunk.texture->getSDL());
+    try
+    {
+        renderer::clear({0, 0, 0, 0});
+        for (size_t i = 0; i < tileSets.size(); ++i)
+        {
+            if (!tileSetQuads[i].empty())
+                submitTileSetQuads(tileSets, i);
+        }
+    }
+    catch (...)
+    {
+        for (auto& quads : tileSetQuads)
+            quads.clear();
+        renderer::_setTargetSDL(previousTarget);
+        throw;
+    }
+
+    renderer::_setTargetSDL(previousTarget);
+    chunk.valid = true;
+}
+
+void TileLayer::_releaseChunk(Chunk& chunk)
+{
+    m_cacheSize -= chunk.bytes;
+    chunk.texture = nullptr;
+    chunk.bytes = 0;
+    chunk.valid = false;
+}
+
+void TileLayer::_evictChunks()
+{
+    // Chunks drawn this frame are kept even over budget, or they would be baked every frame
+    while (m_cacheSize > m_cacheBudget)
+    {
+        Chunk* oldest = nullptr;
+        for (Chunk& chunk : m_chunks)
+        {
+            if (chunk.texture && chunk.lastDrawn < m_drawCount &&
+                (!oldest || chunk.lastDrawn < oldest->lastDrawn))
+                oldest = &chunk;
+        }
+
+        if (!oldest)
+            return;
+        _releaseChunk(*oldest);
+    }
+}
+
+void TileLayer::setTile(const int x, const int y, const uint32_t gid, const uint8_t flipFlags)
+{
+    const auto mapW = static_cast<int>(m_map->getMapSize().x);
+    const auto mapH = static_cast<int>(m_map->getMapSize().y);
+    if (x < 0 || y < 0 || x >= mapW || y >= mapH)
+        throw std::out_of_range("Tile coordinates out of bounds for layer");
+
+    const auto& tileRefs = m_map->m_tileRefs;
+    const bool known =
+        gid < tileRefs.size() && tileRefs[gid].tileSetIndex != static_cast<uint8_t>(-1);
+    if (gid != 0 && !known)
+        throw std::invalid_argument("No tileset holds GID " + std::to_string(gid));
+
+    Tile& tile = m_tiles[static_cast<size_t>(y) * mapW + x];
+    tile.m_id = gid;
+    tile.m_flipFlags = gid != 0 ? flipFlags : 0;
+    tile.m_tilesetIdx = gid != 0 ? tileRefs[gid].tileSetIndex : static_cast<uint8_t>(-1);
+    if (gid != 0 && reachesPastCell(tileRefs[gid].clipArea, m_map->m_tileSize, tile.m_flipFlags))
+        m_map->m_tilesOverlap = true;
+
+    if (!m_chunks.empty())
+        m_chunks[static_cast<size_t>(y / m_chunkSize) * m_chunkColumns + x / m_chunkSize].valid =
+            false;
+}
+
+void TileLayer::setCacheEnabled(const bool enabled)
+{
+    m_cacheEnabled = enabled;
+    if (!enabled)
+        invalidateCache();
+}
+
+bool TileLayer::isCacheEnabled() const
+{
+    return m_cacheEnabled;
+}
+
+void TileLayer::setChunkSize(const int tiles)
+{
+    if (tiles <= 0)
+        throw std::invalid_argument("Chunk size must be greater than zero");
+    if (tiles == m_chunkSize)
+        return;
+
+    m_chunkSize = tiles;
+    invalidateCache();
+}
+
+int TileLayer::getChunkSize() const
+{
+    return m_chunkSize;
+}
+
+void TileLayer::setCacheBudget(const size_t bytes)
+{
+    m_cacheBudget = bytes;
+    _evictChunks();
+}
+
+size_t TileLayer::getCacheBudget() const
+{
+    return m_cacheBudget;
+}
+
+size_t TileLayer::getCacheSize() const
+{
+    return m_cacheSize;
+}
+
+void TileLayer::invalidateCache()
+{
+    m_chunks.clear();
+    m_chunkColumns = 0;
+    m_cacheSize = 0;
 }
 
 std::vector<TileLayer::TileResult> TileLayer::getFromArea(const Rect& area) const
@@ -1133,6 +1674,11 @@ std::vector<Vec2> MapObject::getVertices() const
     return m_vertices;
 }
 
+const Polygon& MapObject::getPolygon() const
+{
+    return m_polygon;
+}
+
 const TextProperties& MapObject::getTextProperties() const
 {
     return m_text;
@@ -1195,14 +1741,13 @@ void ObjectGroup::draw(const double angle, const Vec2& pivot)
                 if (!tile || !setTexture)
                     continue;
 
-                setTexture->setAlpha(static_cast<float>(m_opacity));
-                if (tile && setTexture)
-                {
-                    Transform renderTransform = obj.transform;
-                    renderTransform.pos += offset;
-                    setTexture->setClipArea(tile->getClipArea());
-                    renderer::draw(*setTexture, renderTransform);
-                }
+                Transform renderTransform = obj.transform;
+                renderTransform.pos += offset;
+                const TextureRegion region(
+                    std::move(setTexture), tile->getClipArea(), {}, Color::WHITE,
+                    static_cast<float>(m_opacity)
+                );
+                renderer::draw(region, renderTransform);
 
                 continue;
             }
@@ -1237,7 +1782,7 @@ void ObjectGroup::draw(const double angle, const Vec2& pivot)
 
             case tmx::Object::Shape::Polygon:
             {
-                Polygon polygon{obj.getVertices()};
+                Polygon polygon = obj.getPolygon();
                 polygon.move(renderOffset);
                 draw::polygon(polygon, drawColor);
                 break;
@@ -1290,16 +1835,15 @@ void ObjectGroup::draw(const double angle, const Vec2& pivot)
             if (!tile || !setTexture)
                 continue;
 
-            setTexture->setAlpha(static_cast<float>(m_opacity));
-            if (tile && setTexture)
-            {
-                Transform renderTransform = obj.transform;
-                renderTransform.pos += offset;
-                renderTransform.pos = rotatePoint(renderTransform.pos, pivotWorld, angle);
-                renderTransform.angle += angle;
-                setTexture->setClipArea(tile->getClipArea());
-                renderer::draw(*setTexture, renderTransform);
-            }
+            Transform renderTransform = obj.transform;
+            renderTransform.pos += offset;
+            renderTransform.pos = rotatePoint(renderTransform.pos, pivotWorld, angle);
+            renderTransform.angle += angle;
+            const TextureRegion region(
+                std::move(setTexture), tile->getClipArea(), {}, Color::WHITE,
+                static_cast<float>(m_opacity)
+            );
+            renderer::draw(region, renderTransform);
 
             continue;
         }
@@ -1333,12 +1877,17 @@ void ObjectGroup::draw(const double angle, const Vec2& pivot)
 
         case tmx::Object::Shape::Polygon:
         {
-            std::vector<Vec2> points;
-            points.reserve(obj.getVertices().size());
-            for (const auto& vert : obj.getVertices())
-                points.push_back(vert + renderOffset);
-            points = rotatePoints(points, pivotWorld, angle);
-            draw::polygon(Polygon{points}, drawColor);
+            // Moving and rotating keeps the triangles from map load. Turning about the centroid
+            // and then moving the centroid to where the pivot turn puts it matches rotatePoint.
+            Polygon polygon = obj.getPolygon();
+            polygon.move(renderOffset);
+            if (angle != 0.0)
+            {
+                const Vec2 centroid = polygon.getCentroid();
+                polygon.rotate(angle);
+                polygon.move(rotatePoint(centroid, pivotWorld, angle) - centroid);
+            }
+            draw::polygon(polygon, drawColor);
             break;
         }
 
@@ -1407,6 +1956,17 @@ void _bind(nb::module_& module)
 
     auto subTilemap = module.def_submodule("tilemap", "Tile map handling module");
 
+    subTilemap.def(
+        "_set_range_culling", [](const bool enabled) { rangeCulling = enabled; }, "enabled"_a,
+        R"doc(
+Turn the visible cell ranges of tile layers on or off. Test hook for comparing culled draws with a
+full pass.
+
+Args:
+    enabled (bool): Visit only the cells that can reach the view. On by default.
+        )doc"
+    );
+
     // ----- Enums -----
     nb::enum_<tmx::Orientation>(subTilemap, "MapOrientation", R"doc(
 TMX map orientation values.
@@ -1715,6 +2275,49 @@ World-space rectangle covered by the tile.
             "tiles", &TileLayer::getTiles, nb::rv_policy::reference_internal,
             R"doc(TileLayerTileList of tiles in the layer grid.)doc"
         )
+        .def_rw("tint", &TileLayer::tint, R"doc(
+Color multiplied into every tile when drawn. Changing it does not rebake cached chunks.
+        )doc")
+        .def_prop_rw(
+            "cache_enabled", &TileLayer::isCacheEnabled, &TileLayer::setCacheEnabled, R"doc(
+Whether the layer is drawn from baked chunk textures instead of tile by tile.
+
+Each chunk is rendered once into its own texture and drawn as a single quad while visible. Only
+orthogonal maps whose tiles fit their cells are cached, other layers ignore this setting.
+Disabling the cache releases every chunk.
+            )doc"
+        )
+        .def_prop_rw("chunk_size", &TileLayer::getChunkSize, &TileLayer::setChunkSize, R"doc(
+Width and height of a cached chunk, in tiles. Changing it releases every chunk.
+        )doc")
+        .def_prop_rw(
+            "cache_budget", &TileLayer::getCacheBudget, &TileLayer::setCacheBudget, R"doc(
+Bytes of chunk textures kept before the least recently drawn chunks are evicted.
+
+Chunks visible in the current frame are never evicted, even over budget.
+            )doc"
+        )
+        .def_prop_ro("cache_size", &TileLayer::getCacheSize, R"doc(
+Bytes currently held by baked chunk textures.
+        )doc")
+        .def("invalidate_cache", &TileLayer::invalidateCache, R"doc(
+Release every chunk, so each is baked again the next time it is drawn.
+        )doc")
+        .def(
+            "set_tile", &TileLayer::setTile, "x"_a, "y"_a, "gid"_a, "flip_flags"_a = 0, R"doc(
+Replace the tile in a grid cell. Only the cached chunk holding the cell is baked again.
+
+Args:
+    x (int): Column of the cell.
+    y (int): Row of the cell.
+    gid (int): Global tile id, or 0 to clear the cell.
+    flip_flags (int, optional): Tile flip/rotation flags. Defaults to 0.
+
+Raises:
+    IndexError: If the cell is outside the layer.
+    ValueError: If no tileset holds the GID.
+            )doc"
+        )
 
         .def("get_from_area", &TileLayer::getFromArea, "area"_a, R"doc(
 Return tiles intersecting a Rect area.
@@ -1953,6 +2556,9 @@ Attributes:
 
 Methods:
     load: Load a TMX file from path.
+    save_compiled: Write the map to a compiled map file.
+    load_compiled: Load a compiled map file.
+    load_compiled_bytes: Load a compiled map from memory.
     draw: Draw all layers.
     get_layer: Get a layer by name.
     )doc")
@@ -2007,6 +2613,51 @@ Load a TMX file from path.
 Args:
     tmx_path (str | os.PathLike[str]): Path to the TMX file to load.
         )doc")
+        .def("save_compiled", &Map::saveCompiled, "path"_a, R"doc(
+Write the loaded map to a compiled map file.
+
+Compiled maps hold the map and layer settings, including tile layer tints, tile GIDs and flip
+flags, objects and tileset references in a zstd-compressed binary form, so loading one skips
+parsing the TMX entirely.
+Image paths are stored relative to the compiled file, so keep it next to the map's images.
+
+Args:
+    path (str | os.PathLike[str]): Destination file.
+
+Raises:
+    RuntimeError: If the file cannot be written.
+        )doc")
+        .def(
+            "load_compiled",
+            nb::overload_cast<const std::filesystem::path&>(&Map::loadCompiled), "path"_a,
+            R"doc(
+Load a map written by save_compiled, replacing the current map.
+
+Args:
+    path (str | os.PathLike[str]): Path to the compiled map.
+
+Raises:
+    RuntimeError: If the file cannot be read, is not a compiled map, was written by an
+        unsupported version or is corrupted.
+            )doc"
+        )
+        .def(
+            "load_compiled_bytes",
+            [](Map& self, const nb::bytes& data, const std::filesystem::path& baseDir)
+            { self.loadCompiled(data.c_str(), data.size(), baseDir); },
+            "data"_a, "base_dir"_a = "", R"doc(
+Load a compiled map from memory, replacing the current map.
+
+Args:
+    data (bytes): Contents of a file written by save_compiled.
+    base_dir (str | os.PathLike[str], optional): Directory that relative image paths resolve
+        against. Defaults to the working directory.
+
+Raises:
+    RuntimeError: If the data is not a compiled map, was written by an unsupported version or is
+        corrupted.
+            )doc"
+        )
         .def(
             "draw", &Map::draw, "angle"_a = 0.0, "pivot"_a = Vec2{0.5, 0.5},
             R"doc(
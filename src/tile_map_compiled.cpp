@@ -0,0 +1,710 @@
+#include <zstd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "PixelArray.hpp"
+#include "TileMap.hpp"
+
+// Compiled maps start with an uncompressed header, followed by one zstd frame holding the map.
+// Values are stored in native byte order, and the header's byte order mark rejects files
+// written on a machine with a different one.
+
+namespace
+{
+constexpr char COMPILED_MAGIC[4] = {'K', 'N', 'M', 'P'};
+constexpr uint32_t COMPILED_VERSION = 1;
+constexpr uint32_t COMPILED_BYTE_ORDER = 0x01020304;
+constexpr int COMPILED_COMPRESSION_LEVEL = 9;
+
+struct CompiledHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t reserved;
+    uint64_t rawSize;
+};
+
+class CompiledWriter
+{
+  public:
+    template <typename T>
+    void write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+        m_data.insert(m_data.end(), bytes, bytes + sizeof(T));
+    }
+
+    template <typename T>
+    void writeArray(const T* values, const size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        write(static_cast<uint64_t>(count));
+        const auto* bytes = reinterpret_cast<const uint8_t*>(values);
+        m_data.insert(m_data.end(), bytes, bytes + count * sizeof(T));
+    }
+
+    void write(const std::string& value)
+    {
+        writeArray(value.data(), value.size());
+    }
+
+    void write(const kn::Vec2& value)
+    {
+        write(value.x);
+        write(value.y);
+    }
+
+    void write(const kn::Rect& value)
+    {
+        write(value.x);
+        write(value.y);
+        write(value.w);
+        write(value.h);
+    }
+
+    void write(const kn::Color& value)
+    {
+        write(value.r);
+        write(value.g);
+        write(value.b);
+        write(value.a);
+    }
+
+    void write(const kn::Transform& value)
+    {
+        write(value.pos);
+        write(value.angle);
+        write(value.scale);
+    }
+
+    void write(const std::optional<kn::Color>& value)
+    {
+        write(static_cast<uint8_t>(value.has_value()));
+        write(value.value_or(kn::Color{}));
+    }
+
+    [[nodiscard]] std::vector<uint8_t>& getData()
+    {
+        return m_data;
+    }
+
+  private:
+    std::vector<uint8_t> m_data;
+};
+
+class CompiledReader
+{
+  public:
+    CompiledReader(const uint8_t* data, const size_t size)
+        : m_data(data),
+          m_size(size)
+    {
+    }
+
+    template <typename T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value;
+        std::memcpy(&value, _take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    // Points into the decompressed buffer, so arrays are copied straight into their destination
+    template <typename T>
+    const uint8_t* readArray(size_t& count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto storedCount = read<uint64_t>();
+        if (storedCount > (m_size - m_pos) / sizeof(T))
+            throw std::runtime_error("Compiled map is truncated");
+
+        count = static_cast<size_t>(storedCount);
+        return _take(count * sizeof(T));
+    }
+
+    std::string readString()
+    {
+        size_t length = 0;
+        const uint8_t* chars = readArray<char>(length);
+        return {reinterpret_cast<const char*>(chars), length};
+    }
+
+    kn::Vec2 readVec2()
+    {
+        const auto x = read<double>();
+        const auto y = read<double>();
+        return {x, y};
+    }
+
+    kn::Rect readRect()
+    {
+        const auto x = read<double>();
+        const auto y = read<double>();
+        const auto w = read<double>();
+        const auto h = read<double>();
+        return {x, y, w, h};
+    }
+
+    kn::Color readColor()
+    {
+        const auto r = read<uint8_t>();
+        const auto g = read<uint8_t>();
+        const auto b = read<uint8_t>();
+        const auto a = read<uint8_t>();
+        return {r, g, b, a};
+    }
+
+    kn::Transform readTransform()
+    {
+        kn::Transform transform;
+        transform.pos = readVec2();
+        transform.angle = read<double>();
+        transform.scale = readVec2();
+        return transform;
+    }
+
+    std::optional<kn::Color> readColorKey()
+    {
+        const bool hasKey = read<uint8_t>() != 0;
+        const kn::Color key = readColor();
+        return hasKey ? std::optional<kn::Color>(key) : std::nullopt;
+    }
+
+    [[nodiscard]] bool atEnd() const
+    {
+        return m_pos == m_size;
+    }
+
+  private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+
+    const uint8_t* _take(const size_t count)
+    {
+        if (count > m_size - m_pos)
+            throw std::runtime_error("Compiled map is truncated");
+
+        const uint8_t* bytes = m_data + m_pos;
+        m_pos += count;
+        return bytes;
+    }
+};
+
+template <typename Enum>
+Enum readEnum(CompiledReader& reader)
+{
+    return static_cast<Enum>(reader.read<int32_t>());
+}
+
+template <typename Enum>
+void writeEnum(CompiledWriter& writer, const Enum value)
+{
+    writer.write(static_cast<int32_t>(value));
+}
+
+std::string storedPath(const std::filesystem::path& path, const std::filesystem::path& baseDir)
+{
+    if (path.empty())
+        return {};
+
+    // Paths that cannot be made relative, such as those on another drive, stay absolute
+    return std::filesystem::proximate(path, baseDir).generic_string();
+}
+
+std::filesystem::path resolvedPath(const std::string& path, const std::filesystem::path& baseDir)
+{
+    const std::filesystem::path stored(path);
+    if (stored.empty() || stored.is_absolute())
+        return stored;
+    return baseDir / stored;
+}
+
+std::shared_ptr<kn::Texture> loadImage(
+    const std::filesystem::path& path, const std::optional<kn::Color>& colorKey
+)
+{
+    if (path.empty())
+        return nullptr;
+
+    kn::PixelArray pa(path);
+    if (colorKey)
+        pa.setColorKey(*colorKey);
+    return std::make_shared<kn::Texture>(pa);
+}
+}  // namespace
+
+namespace kn::tilemap
+{
+void Map::saveCompiled(const std::filesystem::path& path) const
+{
+    const std::filesystem::path baseDir = std::filesystem::absolute(path).parent_path();
+    const std::vector<uint8_t> raw = _writeCompiled(baseDir);
+
+    CompiledHeader header{};
+    std::memcpy(header.magic, COMPILED_MAGIC, sizeof(COMPILED_MAGIC));
+    header.version = COMPILED_VERSION;
+    header.byteOrder = COMPILED_BYTE_ORDER;
+    header.rawSize = raw.size();
+
+    std::vector<uint8_t> file(sizeof(CompiledHeader) + ZSTD_compressBound(raw.size()));
+    std::memcpy(file.data(), &header, sizeof(CompiledHeader));
+
+    const size_t compressedSize = ZSTD_compress(
+        file.data() + sizeof(CompiledHeader), file.size() - sizeof(CompiledHeader), raw.data(),
+        raw.size(), COMPILED_COMPRESSION_LEVEL
+    );
+    if (ZSTD_isError(compressedSize))
+        throw std::runtime_error(
+            "Failed to compress compiled map: " + std::string(ZSTD_getErrorName(compressedSize))
+        );
+    file.resize(sizeof(CompiledHeader) + compressedSize);
+
+    if (!SDL_SaveFile(path.string().c_str(), file.data(), file.size()))
+        throw std::runtime_error(
+            "Failed to write compiled map to " + path.string() + ": " + SDL_GetError()
+        );
+}
+
+void Map::loadCompiled(const std::filesystem::path& path)
+{
+    SDL_IOStream* stream = SDL_IOFromFile(path.string().c_str(), "rb");
+    if (!stream)
+        throw std::runtime_error(
+            "Failed to open compiled map " + path.string() + ": " + SDL_GetError()
+        );
+
+    try
+    {
+        loadCompiled(stream, std::filesystem::absolute(path).parent_path());
+    }
+    catch (...)
+    {
+        SDL_CloseIO(stream);
+        throw;
+    }
+    SDL_CloseIO(stream);
+}
+
+void Map::loadCompiled(SDL_IOStream* stream, const std::filesystem::path& baseDir)
+{
+    if (!stream)
+        throw std::invalid_argument("Compiled map stream is null");
+
+    size_t size = 0;
+    void* data = SDL_LoadFile_IO(stream, &size, false);
+    if (!data)
+        throw std::runtime_error("Failed to read compiled map: " + std::string(SDL_GetError()));
+
+    try
+    {
+        loadCompiled(data, size, baseDir);
+    }
+    catch (...)
+    {
+        SDL_free(data);
+        throw;
+    }
+    SDL_free(data);
+}
+
+void Map::loadCompiled(const void* data, const size_t size, const std::filesystem::path& baseDir)
+{
+    if (!data || size < sizeof(CompiledHeader))
+        throw std::runtime_error("Compiled map is truncated");
+
+    CompiledHeader header;
+    std::memcpy(&header, data, sizeof(CompiledHeader));
+
+    if (std::memcmp(header.magic, COMPILED_MAGIC, sizeof(COMPILED_MAGIC)) != 0)
+        throw std::runtime_error("Data is not a compiled map");
+    if (header.byteOrder != COMPILED_BYTE_ORDER)
+        throw std::runtime_error("Compiled map was written with a different byte order");
+    if (header.version != COMPILED_VERSION)
+        throw std::runtime_error(
+            "Unsupported compiled map version " + std::to_string(header.version) +
+            ", expected " + std::to_string(COMPILED_VERSION)
+        );
+
+    const auto* frame = static_cast<const uint8_t*>(data) + sizeof(CompiledHeader);
+    const size_t frameSize = size - sizeof(CompiledHeader);
+
+    // The frame records its own size too, which guards against a corrupted header
+    const unsigned long long contentSize = ZSTD_getFrameContentSize(frame, frameSize);
+    if (contentSize == ZSTD_CONTENTSIZE_ERROR || contentSize == ZSTD_CONTENTSIZE_UNKNOWN ||
+        contentSize != header.rawSize)
+        throw std::runtime_error("Compiled map is corrupted");
+
+    std::vector<uint8_t> raw(static_cast<size_t>(header.rawSize));
+    const size_t rawSize = ZSTD_decompress(raw.data(), raw.size(), frame, frameSize);
+    if (ZSTD_isError(rawSize))
+        throw std::runtime_error(
+            "Failed to decompress compiled map: " + std::string(ZSTD_getErrorName(rawSize))
+        );
+
+    _readCompiled(raw.data(), rawSize, baseDir);
+}
+
+std::vector<uint8_t> Map::_writeCompiled(const std::filesystem::path& baseDir) const
+{
+    CompiledWriter writer;
+
+    writeEnum(writer, m_orient);
+    writeEnum(writer, m_renderOrder);
+    writeEnum(writer, m_staggerAxis);
+    writeEnum(writer, m_staggerIndex);
+    writer.write(m_mapSize);
+    writer.write(m_tileSize);
+    writer.write(m_bounds);
+    writer.write(m_hexSideLength);
+    writer.write(backgroundColor);
+
+    writer.write(static_cast<uint64_t>(m_tileSets.size()));
+    for (const TileSet& tileSet : m_tileSets)
+    {
+        writer.write(tileSet.m_firstGID);
+        writer.write(tileSet.m_lastGID);
+        writer.write(tileSet.m_name);
+        writer.write(tileSet.m_tileSize);
+        writer.write(tileSet.m_spacing);
+        writer.write(tileSet.m_margin);
+        writer.write(tileSet.m_tileCount);
+        writer.write(tileSet.m_columns);
+        writer.write(tileSet.m_tileOffset);
+        writer.write(storedPath(tileSet.m_imagePath, baseDir));
+        writer.write(tileSet.m_colorKey);
+
+        writer.write(static_cast<uint64_t>(tileSet.m_terrains.size()));
+        for (const TileSet::Terrain& terrain : tileSet.m_terrains)
+        {
+            writer.write(terrain.getName());
+            writer.write(terrain.getTileID());
+        }
+
+        writer.write(static_cast<uint64_t>(tileSet.m_tiles.size()));
+        for (const TileSet::Tile& tile : tileSet.m_tiles)
+        {
+            writer.write(tile.m_id);
+            for (const int terrainIndex : tile.m_terrainIndices)
+                writer.write(static_cast<int32_t>(terrainIndex));
+            writer.write(tile.m_probability);
+            writer.write(tile.m_clipArea);
+        }
+    }
+
+    // Group layers are never loaded, so every layer here is a tile, object or image layer
+    writer.write(static_cast<uint64_t>(m_layers.size()));
+    for (const auto& layer : m_layers)
+    {
+        writeEnum(writer, layer->m_type);
+        writer.write(layer->m_name);
+        writer.write(static_cast<uint8_t>(layer->visible));
+        writer.write(layer->offset);
+        writer.write(layer->m_opacity);
+
+        switch (layer->m_type)
+        {
+        case tmx::Layer::Type::Tile:
+        {
+            const auto& tiles = static_cast<const TileLayer&>(*layer).m_tiles;
+
+            // GIDs and flip flags go in separate arrays, so no struct padding reaches the file
+            std::vector<uint32_t> gids(tiles.size());
+            std::vector<uint8_t> flipFlags(tiles.size());
+            for (size_t i = 0; i < tiles.size(); ++i)
+            {
+                gids[i] = tiles[i].m_id;
+                flipFlags[i] = tiles[i].m_flipFlags;
+            }
+            writer.writeArray(gids.data(), gids.size());
+            writer.writeArray(flipFlags.data(), flipFlags.size());
+            writer.write(static_cast<const TileLayer&>(*layer).tint);
+            break;
+        }
+        case tmx::Layer::Type::Object:
+        {
+            const auto& objGroup = static_cast<const ObjectGroup&>(*layer);
+            writer.write(objGroup.color);
+            writeEnum(writer, objGroup.m_drawOrder);
+
+            writer.write(static_cast<uint64_t>(objGroup.m_objects.size()));
+            for (const MapObject& mapObj : objGroup.m_objects)
+            {
+                writer.write(mapObj.m_uid);
+                writer.write(mapObj.m_name);
+                writer.write(mapObj.m_type);
+                writer.write(mapObj.transform);
+                writer.write(static_cast<uint8_t>(mapObj.visible));
+                writer.write(mapObj.m_rect);
+                writer.write(mapObj.m_tileId);
+                writeEnum(writer, mapObj.m_shape);
+
+                writer.write(static_cast<uint64_t>(mapObj.m_vertices.size()));
+                for (const Vec2& vertex : mapObj.m_vertices)
+                    writer.write(vertex);
+
+                const TextProperties& text = mapObj.m_text;
+                writer.write(text.fontFamily);
+                writer.write(text.pixelSize);
+                writer.write(static_cast<uint8_t>(text.wrap));
+                writer.write(text.color);
+                writer.write(static_cast<uint8_t>(text.bold));
+                writer.write(static_cast<uint8_t>(text.italic));
+                writer.write(static_cast<uint8_t>(text.underline));
+                writer.write(static_cast<uint8_t>(text.strikethrough));
+                writer.write(static_cast<uint8_t>(text.kerning));
+                writeEnum(writer, text.align);
+                writer.write(text.text);
+            }
+            break;
+        }
+        case tmx::Layer::Type::Image:
+        {
+            const auto& imgLayer = static_cast<const ImageLayer&>(*layer);
+            writer.write(imgLayer.transform);
+            writer.write(storedPath(imgLayer.m_imagePath, baseDir));
+            writer.write(imgLayer.m_colorKey);
+            break;
+        }
+        case tmx::Layer::Type::Group:
+            break;
+        }
+    }
+
+    return std::move(writer.getData());
+}
+
+void Map::_readCompiled(
+    const uint8_t* data, const size_t size, const std::filesystem::path& baseDir
+)
+{
+    CompiledReader reader(data, size);
+
+    // Built aside so a failed load leaves the current map untouched
+    Map map;
+
+    map.m_orient = readEnum<tmx::Orientation>(reader);
+    map.m_renderOrder = readEnum<tmx::RenderOrder>(reader);
+    map.m_staggerAxis = readEnum<tmx::StaggerAxis>(reader);
+    map.m_staggerIndex = readEnum<tmx::StaggerIndex>(reader);
+    map.m_mapSize = reader.readVec2();
+    map.m_tileSize = reader.readVec2();
+    map.m_bounds = reader.readRect();
+    map.m_hexSideLength = reader.read<double>();
+    map.backgroundColor = reader.readColor();
+
+    const auto mapWidth = static_cast<size_t>(std::max(0.0, map.m_mapSize.x));
+    const auto mapHeight = static_cast<size_t>(std::max(0.0, map.m_mapSize.y));
+
+    const auto tileSetCount = reader.read<uint64_t>();
+    if (tileSetCount >= std::numeric_limits<uint8_t>::max())
+        throw std::runtime_error("Too many tilesets in compiled map");
+
+    map.m_tileSets.reserve(static_cast<size_t>(tileSetCount));
+    for (uint64_t i = 0; i < tileSetCount; ++i)
+    {
+        TileSet tileSet;
+        tileSet.m_firstGID = reader.read<uint32_t>();
+        tileSet.m_lastGID = reader.read<uint32_t>();
+        tileSet.m_name = reader.readString();
+        tileSet.m_tileSize = reader.readVec2();
+        tileSet.m_spacing = reader.read<uint32_t>();
+        tileSet.m_margin = reader.read<uint32_t>();
+        tileSet.m_tileCount = reader.read<uint32_t>();
+        tileSet.m_columns = reader.read<uint32_t>();
+
+        // The GID lookup built after loading is sized and filled from these ranges
+        if (tileSet.m_tileCount > 0)
+        {
+            if (tileSet.m_firstGID == 0 || tileSet.m_lastGID < tileSet.m_firstGID ||
+                tileSet.m_lastGID - tileSet.m_firstGID + 1 != tileSet.m_tileCount)
+                throw std::runtime_error("Compiled map has a tileset with an invalid GID range");
+
+            for (const TileSet& other : map.m_tileSets)
+            {
+                if (other.m_tileCount > 0 && tileSet.m_firstGID <= other.m_lastGID &&
+                    other.m_firstGID <= tileSet.m_lastGID)
+                    throw std::runtime_error("Compiled map has tilesets with overlapping GIDs");
+            }
+        }
+        else if (tileSet.m_lastGID != tileSet.m_firstGID)
+        {
+            throw std::runtime_error("Compiled map has a tileset with an invalid GID range");
+        }
+
+        tileSet.m_tileOffset = reader.readVec2();
+        tileSet.m_imagePath = resolvedPath(reader.readString(), baseDir);
+        tileSet.m_colorKey = reader.readColorKey();
+
+        const auto terrainCount = reader.read<uint64_t>();
+        for (uint64_t t = 0; t < terrainCount; ++t)
+        {
+            std::string name = reader.readString();
+            const auto tileID = reader.read<uint32_t>();
+            tileSet.m_terrains.emplace_back(name, tileID);
+        }
+
+        const auto tileCount = reader.read<uint64_t>();
+        for (uint64_t t = 0; t < tileCount; ++t)
+        {
+            TileSet::Tile tile;
+            tile.m_id = reader.read<uint32_t>();
+            for (int& terrainIndex : tile.m_terrainIndices)
+                terrainIndex = reader.read<int32_t>();
+            tile.m_probability = reader.read<uint32_t>();
+            tile.m_clipArea = reader.readRect();
+            tileSet.m_tiles.push_back(tile);
+        }
+
+        // Loaded tilesets hold one tile per local ID, which also bounds the index below by the
+        // size of the data
+        if (tileSet.m_tiles.size() != tileSet.m_tileCount)
+            throw std::runtime_error("Compiled map has a tileset with missing tiles");
+
+        tileSet.m_tileIndex.assign(tileSet.m_tileCount, 0);
+        for (size_t t = 0; t < tileSet.m_tiles.size(); ++t)
+        {
+            const auto localID = tileSet.m_tiles[t].m_id;
+            if (localID < tileSet.m_tileIndex.size())
+                tileSet.m_tileIndex[localID] = static_cast<uint32_t>(t + 1);
+        }
+
+        tileSet.m_texture = loadImage(tileSet.m_imagePath, tileSet.m_colorKey);
+        map.m_tileSets.push_back(std::move(tileSet));
+    }
+
+    const auto layerCount = reader.read<uint64_t>();
+    for (uint64_t i = 0; i < layerCount; ++i)
+    {
+        const auto type = readEnum<tmx::Layer::Type>(reader);
+        std::string name = reader.readString();
+        const bool visible = reader.read<uint8_t>() != 0;
+        const Vec2 offset = reader.readVec2();
+        const auto opacity = reader.read<double>();
+
+        std::shared_ptr<Layer> layer = nullptr;
+        switch (type)
+        {
+        case tmx::Layer::Type::Tile:
+        {
+            size_t gidCount = 0;
+            const uint8_t* gids = reader.readArray<uint32_t>(gidCount);
+            size_t flipCount = 0;
+            const uint8_t* flipFlags = reader.readArray<uint8_t>(flipCount);
+            if (gidCount != mapWidth * mapHeight || flipCount != gidCount)
+                throw std::runtime_error("Compiled map has a tile layer of the wrong size");
+
+            auto tileLayer = std::make_shared<TileLayer>();
+            tileLayer->m_tiles.resize(gidCount);
+            for (size_t t = 0; t < gidCount; ++t)
+            {
+                TileLayer::Tile& tile = tileLayer->m_tiles[t];
+                std::memcpy(&tile.m_id, gids + t * sizeof(uint32_t), sizeof(uint32_t));
+                tile.m_flipFlags = flipFlags[t];
+            }
+            tileLayer->tint = reader.readColor();
+
+            layer = tileLayer;
+            break;
+        }
+        case tmx::Layer::Type::Object:
+        {
+            auto objGroup = std::make_shared<ObjectGroup>();
+            objGroup->color = reader.readColor();
+            objGroup->m_drawOrder = readEnum<tmx::ObjectGroup::DrawOrder>(reader);
+
+            // Objects were stored in their sorted draw order
+            const auto objectCount = reader.read<uint64_t>();
+            for (uint64_t o = 0; o < objectCount; ++o)
+            {
+                MapObject mapObj;
+                mapObj.m_uid = reader.read<uint32_t>();
+                mapObj.m_name = reader.readString();
+                mapObj.m_type = reader.readString();
+                mapObj.transform = reader.readTransform();
+                mapObj.visible = reader.read<uint8_t>() != 0;
+                mapObj.m_rect = reader.readRect();
+                mapObj.m_tileId = reader.read<uint32_t>();
+                mapObj.m_shape = readEnum<tmx::Object::Shape>(reader);
+
+                const auto vertexCount = reader.read<uint64_t>();
+                for (uint64_t v = 0; v < vertexCount; ++v)
+                    mapObj.m_vertices.push_back(reader.readVec2());
+
+                if (mapObj.m_shape == tmx::Object::Shape::Polygon)
+                {
+                    mapObj.m_polygon.setPoints(mapObj.m_vertices);
+                    (void)mapObj.m_polygon.getTriangles();
+                }
+
+                TextProperties& text = mapObj.m_text;
+                text.fontFamily = reader.readString();
+                text.pixelSize = reader.read<uint32_t>();
+                text.wrap = reader.read<uint8_t>() != 0;
+                text.color = reader.readColor();
+                text.bold = reader.read<uint8_t>() != 0;
+                text.italic = reader.read<uint8_t>() != 0;
+                text.underline = reader.read<uint8_t>() != 0;
+                text.strikethrough = reader.read<uint8_t>() != 0;
+                text.kerning = reader.read<uint8_t>() != 0;
+                text.align = readEnum<TextAlign>(reader);
+                text.text = reader.readString();
+
+                objGroup->m_objects.push_back(std::move(mapObj));
+            }
+
+            layer = objGroup;
+            break;
+        }
+        case tmx::Layer::Type::Image:
+        {
+            auto imgLayer = std::make_shared<ImageLayer>();
+            imgLayer->transform = reader.readTransform();
+            imgLayer->m_imagePath = resolvedPath(reader.readString(), baseDir);
+            imgLayer->m_colorKey = reader.readColorKey();
+            imgLayer->m_texture = loadImage(imgLayer->m_imagePath, imgLayer->m_colorKey);
+
+            layer = imgLayer;
+            break;
+        }
+        default:
+            throw std::runtime_error("Compiled map has an unknown layer type");
+        }
+
+        layer->m_type = type;
+        layer->m_name = std::move(name);
+        layer->visible = visible;
+        layer->offset = offset;
+        layer->setOpacity(opacity);
+        map.m_layers.push_back(std::move(layer));
+    }
+
+    if (!reader.atEnd())
+        throw std::runtime_error("Compiled map has unexpected trailing data");
+
+    backgroundColor = map.backgroundColor;
+    m_orient = map.m_orient;
+    m_renderOrder = map.m_renderOrder;
+    m_mapSize = map.m_mapSize;
+    m_tileSize = map.m_tileSize;
+    m_bounds = map.m_bounds;
+    m_hexSideLength = map.m_hexSideLength;
+    m_staggerAxis = map.m_staggerAxis;
+    m_staggerIndex = map.m_staggerIndex;
+    m_tileSets = std::move(map.m_tileSets);
+    m_layers = std::move(map.m_layers);
+
+    for (const auto& layer : m_layers)
+        layer->m_map = this;
+
+    _buildTileRefs();
+}
+}  // namespace kn::tilemap
@@ -70,6 +70,8 @@ void set(const Rect& rect)
     if (rect.w == 0 || rect.h == 0)
         throw std::runtime_error("Viewport width and height must be greater than zero");
 
+    renderer::_flush();
+
     const SDL_Rect sdlRect = static_cast<SDL_Rect>(rect);
     if (!SDL_SetRenderViewport(renderer::_get(), &sdlRect))
         throw std::runtime_error(std::string("viewport::set failed: ") + SDL_GetError());
@@ -77,6 +79,8 @@ void set(const Rect& rect)
 
 void unset()
 {
+    renderer::_flush();
+
     if (!SDL_SetRenderViewport(renderer::_get(), nullptr))
         throw std::runtime_error(std::string("viewport::unset failed: ") + SDL_GetError());
 }
@@ -182,6 +182,8 @@ void saveScreenshot(const std::filesystem::path& filePath)
     if (!_window)
         throw std::runtime_error("Window not initialized");
 
+    renderer::_flush();
+
     SDL_Surface* shotSurface = SDL_RenderReadPixels(renderer::_get(), nullptr);
     if (!shotSurface)
         throw std::runtime_error("Failed to read pixels: " + std::string(SDL_GetError()));
@@ -0,0 +1,149 @@
+#include "_worker_pool.hpp"
+
+#include <SDL3/SDL.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace kn::worker_pool
+{
+// Past this, memory bandwidth rather than core count limits vertex generation
+static constexpr size_t MAX_AUTO_THREADS = 8;
+// Explicit counts may oversubscribe the cores, but not without bound
+static constexpr size_t MAX_THREADS_PER_CORE = 4;
+
+static std::vector<std::thread> _workers;
+static std::mutex _mutex;
+static std::condition_variable _wake;
+static std::condition_variable _done;
+
+static const std::function<void(size_t)>* _task = nullptr;
+static size_t _taskCount = 0;
+static std::atomic<size_t> _nextTask{0};
+static size_t _busyWorkers = 0;
+static uint64_t _generation = 0;
+static bool _stopping = false;
+
+static size_t _requestedCount = 0;
+
+static size_t _coreCount()
+{
+    return static_cast<size_t>(std::max(SDL_GetNumLogicalCPUCores(), 1));
+}
+
+static void _drain(const std::function<void(size_t)>& task, const size_t taskCount)
+{
+    for (size_t i = _nextTask.fetch_add(1); i < taskCount; i = _nextTask.fetch_add(1))
+        task(i);
+}
+
+// seen starts at the generation current when the worker is created, so a worker started after
+// earlier jobs does not mistake the last finished job for a new one
+static void _workerLoop(uint64_t seen)
+{
+    std::unique_lock lock(_mutex);
+    while (true)
+    {
+        _wake.wait(lock, [&] { return _stopping || _generation != seen; });
+        if (_stopping)
+            return;
+
+        seen = _generation;
+        const auto* task = _task;
+        const size_t taskCount = _taskCount;
+
+        lock.unlock();
+        _drain(*task, taskCount);
+        lock.lock();
+
+        if (--_busyWorkers == 0)
+            _done.notify_one();
+    }
+}
+
+static void _stopWorkers()
+{
+    {
+        std::lock_guard lock(_mutex);
+        _stopping = true;
+    }
+    _wake.notify_all();
+
+    for (std::thread& worker : _workers)
+        worker.join();
+    _workers.clear();
+
+    _stopping = false;
+}
+
+// Joins the workers during static destruction when _quit() was never called, since destroying a
+// joinable std::thread terminates the program. Declared after the state it uses so it runs first.
+struct WorkerJoiner
+{
+    ~WorkerJoiner()
+    {
+        _stopWorkers();
+    }
+};
+static WorkerJoiner _joiner;
+
+void run(const size_t taskCount, const std::function<void(size_t)>& task)
+{
+    if (taskCount == 0)
+        return;
+
+    const size_t threadCount = getThreadCount();
+    if (taskCount == 1 || threadCount <= 1)
+    {
+        for (size_t i = 0; i < taskCount; ++i)
+            task(i);
+        return;
+    }
+
+    if (_workers.size() != threadCount - 1)
+    {
+        _stopWorkers();
+        for (size_t i = 0; i + 1 < threadCount; ++i)
+            _workers.emplace_back(_workerLoop, _generation);
+    }
+
+    {
+        std::lock_guard lock(_mutex);
+        _task = &task;
+        _taskCount = taskCount;
+        _nextTask.store(0);
+        _busyWorkers = _workers.size();
+        ++_generation;
+    }
+    _wake.notify_all();
+
+    _drain(task, taskCount);
+
+    std::unique_lock lock(_mutex);
+    _done.wait(lock, [] { return _busyWorkers == 0; });
+    _task = nullptr;
+}
+
+void setThreadCount(const size_t count)
+{
+    _requestedCount = std::min(count, _coreCount() * MAX_THREADS_PER_CORE);
+}
+
+size_t getThreadCount()
+{
+    if (_requestedCount > 0)
+        return _requestedCount;
+
+    return std::min(_coreCount(), MAX_AUTO_THREADS);
+}
+
+void _quit()
+{
+    _stopWorkers();
+}
+}  // namespace kn::worker_pool
@@ -1,5 +1,9 @@
+import math
+
+import pytest
+
 import pykraken
-from pykraken import renderer, window, Color
+from pykraken import renderer, window, Color, PixelArray, Texture, Transform, Vec2
 
 
 def test_renderer_clear_and_read_pixels():
@@ -16,3 +20,980 @@ def test_renderer_clear_and_read_pixels():
             window.close()
     finally:
         pykraken.quit()
+
+
+def test_renderer_batched_draws_keep_order():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            red_pixels = PixelArray(8, 8)
+            red_pixels.fill(Color(255, 0, 0, 255))
+            blue_pixels = PixelArray(8, 8)
+            blue_pixels.fill(Color(0, 0, 255, 255))
+            red = Texture(red_pixels)
+            blue = Texture(blue_pixels)
+
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw(red, Transform(pos=Vec2(0, 0)))
+            renderer.draw(red, Transform(pos=Vec2(16, 0)))
+            # Overlaps the second red quad, so it must land on top of it
+            renderer.draw(blue, Transform(pos=Vec2(20, 0)))
+
+            pa = renderer.read_pixels()
+            c = pa.get_at(4, 4)
+            assert (c.r, c.g, c.b) == (255, 0, 0)
+            c = pa.get_at(17, 4)
+            assert (c.r, c.g, c.b) == (255, 0, 0)
+            c = pa.get_at(22, 4)
+            assert (c.r, c.g, c.b) == (0, 0, 255)
+            c = pa.get_at(40, 4)
+            assert (c.r, c.g, c.b) == (0, 0, 0)
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_renderer_sorting_orders_by_layer():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            red_pixels = PixelArray(8, 8)
+            red_pixels.fill(Color(255, 0, 0, 255))
+            blue_pixels = PixelArray(8, 8)
+            blue_pixels.fill(Color(0, 0, 255, 255))
+            red = Texture(red_pixels)
+            blue = Texture(blue_pixels)
+
+            renderer.set_sorting_enabled(True)
+            try:
+                renderer.clear(Color(0, 0, 0, 255))
+                renderer.draw(blue, Transform(pos=Vec2(4, 0)), layer=1)
+                renderer.draw(red, Transform(pos=Vec2(0, 0)), layer=0)
+                pa = renderer.read_pixels()
+            finally:
+                renderer.set_sorting_enabled(False)
+
+            c = pa.get_at(6, 4)
+            assert (c.r, c.g, c.b) == (0, 0, 255)
+            c = pa.get_at(2, 4)
+            assert (c.r, c.g, c.b) == (255, 0, 0)
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_texture_atlas_regions_draw_and_survive_repack():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            atlas = pykraken.TextureAtlas(page_width=64, page_height=64, padding=2, extrude=1)
+            red_pixels = PixelArray(8, 8)
+            red_pixels.fill(Color(255, 0, 0, 255))
+            blue_pixels = PixelArray(16, 8)
+            blue_pixels.fill(Color(0, 0, 255, 255))
+
+            red = atlas.add("red", red_pixels)
+            atlas.add("spare", PixelArray(20, 20))
+            blue = atlas.add("blue", blue_pixels)
+            assert "blue" in atlas
+            assert len(atlas) == 3
+            assert blue.size == Vec2(16, 8)
+
+            atlas.remove("spare")
+            atlas.repack()
+            assert red.valid and blue.valid
+            assert atlas.page_count == 1
+
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw(red, Transform(pos=Vec2(0, 0)))
+            renderer.draw(blue, Transform(pos=Vec2(16, 0)))
+
+            pa = renderer.read_pixels()
+            c = pa.get_at(4, 4)
+            assert (c.r, c.g, c.b) == (255, 0, 0)
+            c = pa.get_at(24, 4)
+            assert (c.r, c.g, c.b) == (0, 0, 255)
+            c = pa.get_at(40, 4)
+            assert (c.r, c.g, c.b) == (0, 0, 0)
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_texture_atlas_reused_cell_keeps_earlier_draws():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            atlas = pykraken.TextureAtlas(page_width=64, page_height=64)
+            red_pixels = PixelArray(8, 8)
+            red_pixels.fill(Color(255, 0, 0, 255))
+            blue_pixels = PixelArray(8, 8)
+            blue_pixels.fill(Color(0, 0, 255, 255))
+
+            renderer.clear(Color(0, 0, 0, 255))
+            red = atlas.add("red", red_pixels)
+            red_clip = red.clip_area
+            renderer.draw(red, Transform(pos=Vec2(0, 0)))
+
+            # Emptying the page lets the new region take the cell the queued red quad samples
+            atlas.remove("red")
+            blue = atlas.add("blue", blue_pixels)
+            assert blue.clip_area == red_clip
+            renderer.draw(blue, Transform(pos=Vec2(16, 0)))
+
+            pa = renderer.read_pixels()
+            c = pa.get_at(4, 4)
+            assert (c.r, c.g, c.b) == (255, 0, 0)
+            c = pa.get_at(20, 4)
+            assert (c.r, c.g, c.b) == (0, 0, 255)
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_texture_atlas_emptied_page_is_cleared():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            atlas = pykraken.TextureAtlas(page_width=64, page_height=64)
+            red_pixels = PixelArray(16, 16)
+            red_pixels.fill(Color(255, 0, 0, 255))
+            blue_pixels = PixelArray(8, 8)
+            blue_pixels.fill(Color(0, 0, 255, 255))
+
+            atlas.add("red", red_pixels)
+            atlas.remove("red")
+            blue = atlas.add("blue", blue_pixels)
+
+            # The smaller region must not leave the removed image around it on the page
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw(blue.texture, Transform(pos=Vec2(0, 0)))
+            pa = renderer.read_pixels()
+            c = pa.get_at(4, 4)
+            assert (c.r, c.g, c.b) == (0, 0, 255)
+            c = pa.get_at(12, 12)
+            assert (c.r, c.g, c.b) == (0, 0, 0)
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_renderer_draw_batch_reuses_batcher_across_frames():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            white_pixels = PixelArray(4, 4)
+            white_pixels.fill(Color(255, 255, 255, 255))
+            white = Texture(white_pixels)
+
+            batcher = renderer.Batcher()
+            batcher.preallocate(2)
+            assert batcher.capacity >= 2
+
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw_batch(
+                white, [Transform(pos=Vec2(0, 0)), Transform(pos=Vec2(8, 0))], batcher=batcher
+            )
+            pa = renderer.read_pixels()
+            assert pa.get_at(1, 1).r == 255
+            assert pa.get_at(9, 1).r == 255
+            renderer.present()
+
+            # A smaller batch must not redraw the previous frame's instances
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw_batch(white, [Transform(pos=Vec2(0, 16))], batcher=batcher)
+            pa = renderer.read_pixels()
+            assert pa.get_at(1, 17).r == 255
+            assert pa.get_at(1, 1).r == 0
+            assert pa.get_at(9, 1).r == 0
+            renderer.present()
+
+            # A larger batch grows the buffer and draws every instance
+            transforms = [Transform(pos=Vec2(x * 4, y * 4)) for y in range(16) for x in range(16)]
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw_batch(white, transforms, batcher=batcher)
+            assert batcher.capacity >= len(transforms)
+            pa = renderer.read_pixels()
+            for x, y in ((1, 1), (62, 1), (1, 62), (62, 62), (33, 29)):
+                assert pa.get_at(x, y).r == 255
+            renderer.present()
+
+            batcher.free()
+            assert batcher.capacity == 0
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw_batch(white, [Transform(pos=Vec2(32, 32))], batcher=batcher)
+            pa = renderer.read_pixels()
+            assert pa.get_at(33, 33).r == 255
+            assert pa.get_at(1, 1).r == 0
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_texture_region_draws_without_mutating_texture():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            pixels = PixelArray(16, 8)
+            pixels.fill(Color(255, 0, 0, 255))
+            green_pixels = PixelArray(8, 8)
+            green_pixels.fill(Color(0, 255, 0, 255))
+            pixels.blit(green_pixels, Vec2(8, 0))
+            sheet = Texture(pixels)
+
+            right = pykraken.TextureRegion(sheet, src=pykraken.Rect(8, 0, 8, 8))
+            whole = pykraken.TextureRegion(sheet)
+            assert whole.size == Vec2(16, 8)
+            with pytest.raises(ValueError):
+                whole.with_src(pykraken.Rect(0, 0, -1, 8))
+            assert right.with_src(pykraken.Rect()).src == pykraken.Rect(0, 0, 16, 8)
+
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw(right, Transform(pos=Vec2(0, 0)))
+            renderer.draw(whole.with_flip(True, False), Transform(pos=Vec2(0, 16)))
+            renderer.draw(whole.with_alpha(0.0), Transform(pos=Vec2(0, 32)))
+
+            pa = renderer.read_pixels()
+            c = pa.get_at(4, 4)
+            assert (c.r, c.g, c.b) == (0, 255, 0)
+            c = pa.get_at(4, 20)
+            assert (c.r, c.g, c.b) == (0, 255, 0)
+            c = pa.get_at(4, 36)
+            assert (c.r, c.g, c.b) == (0, 0, 0)
+
+            # The texture keeps its own state
+            assert sheet.clip_area == pykraken.Rect(0, 0, 16, 8)
+            assert not sheet.flip.h
+            assert sheet.alpha == 1.0
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_atlas_region_draws_through_texture_region():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            atlas = pykraken.TextureAtlas(page_width=64, page_height=64)
+            pixels = PixelArray(16, 8)
+            pixels.fill(Color(255, 0, 0, 255))
+            green_pixels = PixelArray(8, 8)
+            green_pixels.fill(Color(0, 255, 0, 255))
+            pixels.blit(green_pixels, Vec2(8, 0))
+            sprite = atlas.add("sprite", pixels)
+            sprite.flip.h = True
+
+            region = sprite.to_region()
+            assert region.src == sprite.clip_area
+            assert region.flip.h
+
+            # Atlas regions and their snapshots go through the same overloads
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw(sprite, Transform(pos=Vec2(0, 0)))
+            renderer.draw(region, Transform(pos=Vec2(0, 16)))
+            renderer.draw_batch(sprite, [Transform(pos=Vec2(0, 32))])
+            pa = renderer.read_pixels()
+            for y in (4, 20, 36):
+                c = pa.get_at(4, y)
+                assert (c.r, c.g, c.b) == (0, 255, 0)
+                c = pa.get_at(12, y)
+                assert (c.r, c.g, c.b) == (255, 0, 0)
+
+            atlas.remove("sprite")
+            with pytest.raises(RuntimeError):
+                sprite.to_region()
+            with pytest.raises(RuntimeError):
+                renderer.draw(sprite)
+            with pytest.raises(RuntimeError):
+                renderer.draw_batch(sprite, [Transform()])
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_renderer_draw_batch_columns_with_colors():
+    np = pytest.importorskip("numpy")
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            white_pixels = PixelArray(8, 8)
+            white_pixels.fill(Color(255, 255, 255, 255))
+            white = Texture(white_pixels)
+
+            state = np.array([[0.0, 0.0], [16.0, 0.0]], dtype=np.float32)
+            colors = np.array([[255, 0, 0, 255], [0, 255, 0, 255]], dtype=np.uint8)
+
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw_batch_columns(white, state[:, 0], state[:, 1], colors=colors)
+
+            pa = renderer.read_pixels()
+            c = pa.get_at(4, 4)
+            assert (c.r, c.g, c.b) == (255, 0, 0)
+            c = pa.get_at(20, 4)
+            assert (c.r, c.g, c.b) == (0, 255, 0)
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_renderer_threaded_batch_keeps_instance_order():
+    np = pytest.importorskip("numpy")
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            white_pixels = PixelArray(8, 8)
+            white_pixels.fill(Color(255, 255, 255, 255))
+            white = Texture(white_pixels)
+
+            # Mostly off-screen instances, with a red then green sprite at the same spot near the end
+            count = 5000
+            state = np.full((count, 2), -100.0)
+            state[-2:] = [8.0, 8.0]
+            colors = np.zeros((count, 4), dtype=np.uint8)
+            colors[-2] = [255, 0, 0, 255]
+            colors[-1] = [0, 255, 0, 255]
+
+            renderer.set_parallel_batch_threshold(1)
+            renderer.set_batch_thread_count(1_000_000)
+            assert 4 <= renderer.get_batch_thread_count() < 1_000_000
+            with pytest.raises(ValueError):
+                renderer.set_batch_thread_count(-1)
+
+            renderer.set_batch_thread_count(4)
+            assert renderer.get_batch_thread_count() == 4
+
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw_batch(white, state, colors=colors)
+
+            c = renderer.read_pixels().get_at(12, 12)
+            assert (c.r, c.g, c.b) == (0, 255, 0)
+        finally:
+            renderer.set_parallel_batch_threshold(32768)
+            renderer.set_batch_thread_count(0)
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_renderer_threaded_batch_survives_worker_restarts():
+    np = pytest.importorskip("numpy")
+    state = np.full((5000, 2), -100.0)
+    state[-1] = [8.0, 8.0]
+
+    for _ in range(2):
+        pykraken.init()
+        try:
+            window.create("test", 64, 64, handle_close=False)
+            try:
+                white_pixels = PixelArray(8, 8)
+                white_pixels.fill(Color(255, 255, 255, 255))
+                white = Texture(white_pixels)
+
+                renderer.set_parallel_batch_threshold(1)
+                # Each count change restarts the workers after earlier jobs have run
+                for count in (4, 2, 3):
+                    renderer.set_batch_thread_count(count)
+                    for _ in range(3):
+                        renderer.clear(Color(0, 0, 0, 255))
+                        renderer.draw_batch(white, state)
+                        c = renderer.read_pixels().get_at(12, 12)
+                        assert (c.r, c.g, c.b) == (255, 255, 255)
+            finally:
+                renderer.set_parallel_batch_threshold(32768)
+                renderer.set_batch_thread_count(0)
+                window.close()
+        finally:
+            pykraken.quit()
+
+
+def test_renderer_grid_culled_batch_keeps_visible_instances():
+    np = pytest.importorskip("numpy")
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            white_pixels = PixelArray(8, 8)
+            white_pixels.fill(Color(255, 255, 255, 255))
+            white = Texture(white_pixels)
+
+            # A far-off cluster the grid rejects, and a red then green sprite on screen
+            count = 4096
+            state = np.full((count, 2), 5000.0)
+            state[:, 0] += np.arange(count)
+            state[-2:] = [8.0, 8.0]
+            colors = np.zeros((count, 4), dtype=np.uint8)
+            colors[-2] = [255, 0, 0, 255]
+            colors[-1] = [0, 255, 0, 255]
+
+            renderer.set_cull_grid_threshold(1)
+            assert renderer.get_cull_grid_threshold() == 1
+
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw_batch(white, state, colors=colors)
+            c = renderer.read_pixels().get_at(12, 12)
+            assert (c.r, c.g, c.b) == (0, 255, 0)
+
+            transforms = [Transform(pos=Vec2(x, y)) for x, y in state[:-1]]
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw_batch(white, transforms)
+            c = renderer.read_pixels().get_at(12, 12)
+            assert (c.r, c.g, c.b) == (255, 255, 255)
+        finally:
+            renderer.set_cull_grid_threshold(16384)
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_renderer_simd_kernels_match_scalar():
+    np = pytest.importorskip("numpy")
+
+    # Counts that leave a tail after both the 4 and 8 lane SIMD loops
+    for count in (5, 13, 21, 35):
+        i = np.arange(count)
+        x = (4 + (i * 7) % 50).astype(np.float32)
+        y = (4 + (i * 11) % 50).astype(np.float32)
+        angle = (i * 0.37).astype(np.float32)
+        scale = (1 + (i % 3) * 0.5).astype(np.float32)
+
+        x[i % 7 == 1] = np.nan
+        angle[i % 7 == 3] = np.nan
+        scale[i % 7 == 5] = np.nan
+        scale[i % 11 == 2] = 0.0
+        x[i % 13 == 4] = 1000.0
+        y[i % 17 == 6] = np.inf
+        hidden = (i % 7 % 2 == 1) | (i % 11 == 2) | (i % 13 == 4) | (i % 17 == 6)
+
+        scalar = renderer._generate_quads(0, x, y, angle, scale, Vec2(8, 8), Vec2(64, 64))
+        assert len(scalar) == 8 * int(np.count_nonzero(~hidden))
+        for level in (1, 2):
+            simd = renderer._generate_quads(level, x, y, angle, scale, Vec2(8, 8), Vec2(64, 64))
+            assert len(simd) == len(scalar)
+            assert np.allclose(simd, scalar, atol=1e-3)
+
+
+def test_static_batch_add_update_remove():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            white_pixels = PixelArray(8, 8)
+            white_pixels.fill(Color(255, 255, 255, 255))
+            white = Texture(white_pixels)
+
+            batch = renderer.StaticBatch(white, cell_size=16)
+            red = batch.add(Transform(pos=Vec2(0, 0)), color=Color(255, 0, 0, 255))
+            green = batch.add(Transform(pos=Vec2(40, 0)), color=Color(0, 255, 0, 255))
+            assert len(batch) == 2 and batch.cell_count == 2
+
+            batch.update(green, Transform(pos=Vec2(16, 0)), color=Color(0, 255, 0, 255))
+            batch.remove(red)
+            batch.remove(red)
+            assert red not in batch and green in batch
+
+            renderer.clear(Color(0, 0, 0, 255))
+            batch.draw()
+
+            pa = renderer.read_pixels()
+            c = pa.get_at(4, 4)
+            assert (c.r, c.g, c.b) == (0, 0, 0)
+            c = pa.get_at(20, 4)
+            assert (c.r, c.g, c.b) == (0, 255, 0)
+
+            with pytest.raises(ValueError):
+                batch.update(red, Transform())
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_static_batch_update_in_cell_keeps_draw_order():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            white_pixels = PixelArray(8, 8)
+            white_pixels.fill(Color(255, 255, 255, 255))
+            white = Texture(white_pixels)
+
+            batch = renderer.StaticBatch(white, cell_size=64)
+            red = batch.add(Transform(pos=Vec2(0, 0)), color=Color(255, 0, 0, 255))
+            batch.add(Transform(pos=Vec2(0, 0)), color=Color(0, 255, 0, 255))
+            batch.add(Transform(pos=Vec2(32, 0)), color=Color(0, 0, 255, 255))
+
+            # Moving within the same cell must not lift the instance above later ones
+            batch.update(red, Transform(pos=Vec2(2, 0)), color=Color(255, 0, 0, 255))
+
+            renderer.clear(Color(0, 0, 0, 255))
+            batch.draw()
+            pa = renderer.read_pixels()
+            c = pa.get_at(4, 4)
+            assert (c.r, c.g, c.b) == (0, 255, 0)
+            c = pa.get_at(9, 4)
+            assert (c.r, c.g, c.b) == (255, 0, 0)
+
+            if renderer.is_frame_stats_enabled():
+                # A removed quad waits for compaction but is not counted as drawn
+                batch.remove(red)
+                renderer.present()
+                batch.draw()
+                renderer.present()
+                stats = renderer.get_frame_stats()
+                assert stats.sprites_drawn == 2
+                assert stats.sprites_culled == 0
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_camera_zoom_scales_draws_and_conversions():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            white_pixels = PixelArray(8, 8)
+            white_pixels.fill(Color(255, 255, 255, 255))
+            white = Texture(white_pixels)
+
+            cam = pykraken.Camera(set_active=True)
+            cam.zoom = 2.0
+            assert cam.world_to_screen(Vec2(4, 4)) == Vec2(40, 40)
+            assert cam.screen_to_world(Vec2(40, 40)) == Vec2(4, 4)
+            with pytest.raises(ValueError):
+                cam.zoom = 0.0
+
+            # An 8x8 sprite at the camera position covers 16x16 pixels around the center
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw(white, Transform(pos=Vec2(0, 0)))
+
+            pa = renderer.read_pixels()
+            c = pa.get_at(46, 46)
+            assert (c.r, c.g, c.b) == (255, 255, 255)
+            c = pa.get_at(50, 50)
+            assert (c.r, c.g, c.b) == (0, 0, 0)
+            cam.unset()
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_camera_move_screen_pans_by_pixels_while_zoomed():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            white_pixels = PixelArray(8, 8)
+            white_pixels.fill(Color(255, 255, 255, 255))
+            white = Texture(white_pixels)
+
+            cam = pykraken.Camera(set_active=True)
+            cam.zoom = 2.0
+            cam.rotate(math.pi / 2)
+
+            # Dragging by a delta keeps the world point under the cursor under it
+            grabbed = cam.screen_to_world(Vec2(40, 20))
+            cam.move_screen(Vec2(-8, 6))
+            moved = cam.screen_to_world(Vec2(48, 14))
+            assert moved.x == pytest.approx(grabbed.x)
+            assert moved.y == pytest.approx(grabbed.y)
+
+            # The 16x16 pixel footprint of an 8x8 sprite moves from x 32..48 to 40..56
+            cam.transform.angle = 0.0
+            cam.transform.pos = Vec2(0, 0)
+            cam.move_screen(Vec2(-8, 0))
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw(white, Transform(pos=Vec2(0, 0)))
+
+            pa = renderer.read_pixels()
+            c = pa.get_at(42, 40)
+            assert (c.r, c.g, c.b) == (255, 255, 255)
+            c = pa.get_at(58, 40)
+            assert (c.r, c.g, c.b) == (0, 0, 0)
+            cam.unset()
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_renderer_frame_stats_count_last_frame():
+    if not renderer.is_frame_stats_enabled():
+        pytest.skip("built without KRAKEN_FRAME_STATS")
+
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            red_pixels = PixelArray(8, 8)
+            red_pixels.fill(Color(255, 0, 0, 255))
+            blue_pixels = PixelArray(8, 8)
+            blue_pixels.fill(Color(0, 0, 255, 255))
+            red = Texture(red_pixels)
+            blue = Texture(blue_pixels)
+
+            renderer.clear(Color(0, 0, 0, 255))
+            renderer.draw(red, Transform(pos=Vec2(0, 0)))
+            renderer.draw(red, Transform(pos=Vec2(16, 0)))
+            renderer.draw(blue, Transform(pos=Vec2(32, 0)))
+            renderer.draw(red, Transform(pos=Vec2(500, 500)))
+            renderer.present()
+
+            stats = renderer.get_frame_stats()
+            assert stats.draw_calls == 4
+            assert stats.sprites_drawn == 3
+            assert stats.sprites_culled == 1
+            assert stats.geometry_calls == 2
+            assert stats.texture_switches == 2
+            assert stats.vertices == 12
+            assert stats.indices == 18
+            assert stats.cpu_time_ms >= 0.0
+
+            # Counters start over at every present
+            renderer.present()
+            assert renderer.get_frame_stats().draw_calls == 0
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_cached_layer_records_until_invalidated():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            white_pixels = PixelArray(8, 8)
+            white_pixels.fill(Color(255, 255, 255, 255))
+            white = Texture(white_pixels)
+
+            calls = []
+
+            def record():
+                calls.append(True)
+                renderer.draw(white, Transform(pos=Vec2(0, 0)))
+
+            layer = renderer.CachedLayer(Vec2(16, 16), record)
+            assert not layer.valid
+
+            renderer.clear(Color(0, 0, 0, 255))
+            layer.draw(Vec2(10, 10))
+            layer.draw(Vec2(40, 10))
+            assert len(calls) == 1
+            assert layer.valid
+
+            pa = renderer.read_pixels()
+            assert pa.get_at(12, 12).r == 255
+            assert pa.get_at(22, 12).r == 0
+            assert pa.get_at(42, 12).r == 255
+
+            # The premultiplied layer fades toward what is below rather than brightening it
+            layer.texture.alpha = 0.5
+            renderer.clear(Color(0, 0, 255, 255))
+            layer.draw(Vec2(10, 10))
+            c = renderer.read_pixels().get_at(12, 12)
+            assert 120 <= c.r <= 136 and c.b == 255
+            layer.texture.alpha = 1.0
+
+            layer.invalidate()
+            layer.draw()
+            assert len(calls) == 2
+
+            # A new scale rebuilds the texture at the new density
+            layer.scale = 2.0
+            assert layer.texture.size == Vec2(32, 32)
+            assert len(calls) == 3
+
+            with pytest.raises(ValueError):
+                layer.size = Vec2(0, 16)
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_frame_capture_writes_in_background(tmp_path):
+    renderer.set_render_backend(pykraken.RenderBackend.SOFTWARE)
+    pykraken.init()
+    try:
+        window.create("test", 32, 32, handle_close=False)
+        try:
+            capture = renderer.FrameCapture(slot_count=2)
+
+            paths = []
+            for i in range(5):
+                renderer.clear(Color(0, 0, 50 * i, 255))
+                path = tmp_path / f"frame_{i}.png"
+                assert capture.capture(path)
+                paths.append(path)
+                renderer.present()
+
+            capture.wait()
+            assert capture.pending == 0
+            assert capture.written == 5
+            assert all(path.stat().st_size > 0 for path in paths)
+
+            last = PixelArray(paths[4])
+            assert last.get_at(0, 0).b == 200
+
+            with pytest.raises(ValueError):
+                capture.capture(tmp_path / "frame.jpg")
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+        renderer.set_render_backend(pykraken.RenderBackend.AUTO)
+
+
+def test_draw_batched_shapes_keep_order_with_sprites():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            red_pixels = PixelArray(8, 8)
+            red_pixels.fill(Color(255, 0, 0, 255))
+            red = Texture(red_pixels)
+            green = Color(0, 255, 0, 255)
+            blue = Color(0, 0, 255, 255)
+
+            assert pykraken.draw.is_batching_enabled()
+            renderer.clear(Color(0, 0, 0, 255))
+            pykraken.draw.rect(pykraken.Rect(0, 0, 16, 16), green)
+            pykraken.draw.circle(pykraken.Circle(Vec2(6, 6), 3), blue)
+            # Lands between the two queued shape runs, so it must cover the first and not the second
+            renderer.draw(red, Transform(pos=Vec2(12, 0)))
+            pykraken.draw.rect(pykraken.Rect(18, 0, 8, 8), blue)
+
+            pa = renderer.read_pixels()
+            c = pa.get_at(2, 12)
+            assert (c.r, c.g, c.b) == (0, 255, 0)
+            c = pa.get_at(6, 6)
+            assert (c.r, c.g, c.b) == (0, 0, 255)
+            c = pa.get_at(14, 4)
+            assert (c.r, c.g, c.b) == (255, 0, 0)
+            c = pa.get_at(19, 4)
+            assert (c.r, c.g, c.b) == (0, 0, 255)
+
+            pykraken.draw.set_batching_enabled(False)
+            try:
+                assert not pykraken.draw.is_batching_enabled()
+                pykraken.draw.rect(pykraken.Rect(32, 32, 8, 8), green)
+                c = renderer.read_pixels().get_at(36, 36)
+                assert (c.r, c.g, c.b) == (0, 255, 0)
+            finally:
+                pykraken.draw.set_batching_enabled(True)
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_draw_circle_segments_follow_screen_radius():
+    if not renderer.is_frame_stats_enabled():
+        pytest.skip("built without KRAKEN_FRAME_STATS")
+
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            white = Color(255, 255, 255, 255)
+
+            pykraken.draw.circle(pykraken.Circle(Vec2(32, 32), 2), white)
+            renderer.present()
+            small = renderer.get_frame_stats().vertices
+
+            pykraken.draw.circle(pykraken.Circle(Vec2(32, 32), 30), white)
+            renderer.present()
+            large = renderer.get_frame_stats().vertices
+            assert small < large
+
+            # An explicit count is kept: the center plus a closed ring of 12 segments
+            pykraken.draw.circle(pykraken.Circle(Vec2(32, 32), 30), white, num_segments=12)
+            renderer.present()
+            assert renderer.get_frame_stats().vertices == 14
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_draw_thick_polyline_joins():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            white = Color(255, 255, 255, 255)
+            points = [Vec2(8, 8), Vec2(56, 8), Vec2(56, 56)]
+
+            # A mitered corner fills out to (60, 4), past the cut a bevel makes
+            renderer.clear(Color(0, 0, 0, 255))
+            pykraken.draw.polyline(points, white, thickness=8, join=pykraken.LineJoin.MITER)
+            c = renderer.read_pixels().get_at(59, 5)
+            assert (c.r, c.g, c.b) == (255, 255, 255)
+
+            renderer.clear(Color(0, 0, 0, 255))
+            pykraken.draw.polyline(points, white, thickness=8, join=pykraken.LineJoin.BEVEL)
+            pa = renderer.read_pixels()
+            c = pa.get_at(59, 5)
+            assert (c.r, c.g, c.b) == (0, 0, 0)
+            c = pa.get_at(56, 8)
+            assert (c.r, c.g, c.b) == (255, 255, 255)
+            renderer.present()
+
+            if renderer.is_frame_stats_enabled():
+                zigzag = [Vec2(i * 1.5, 20 + (i % 2) * 20) for i in range(40)]
+                pykraken.draw.polyline(zigzag, white, thickness=3, join=pykraken.LineJoin.ROUND)
+                renderer.present()
+                assert renderer.get_frame_stats().geometry_calls == 1
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_draw_geometry_from_float32_buffers():
+    np = pytest.importorskip("numpy")
+
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            # x, y, r, g, b, a interleaved, read through column slices
+            data = np.array(
+                [
+                    [0, 0, 1, 0, 0, 1],
+                    [32, 0, 1, 0, 0, 1],
+                    [0, 32, 1, 0, 0, 1],
+                ],
+                dtype=np.float32,
+            )
+
+            renderer.clear(Color(0, 0, 0, 255))
+            pykraken.draw.geometry_from_ndarray(None, data[:, 0:2], colors=data[:, 2:6])
+            c = renderer.read_pixels().get_at(4, 4)
+            assert (c.r, c.g, c.b) == (255, 0, 0)
+
+            mesh = pykraken.draw.Mesh(
+                np.array([[32, 32], [64, 32], [32, 64], [64, 64]], dtype=np.float32),
+                indices=np.array([0, 1, 2, 2, 1, 3], dtype=np.int32),
+                color=Color(0, 0, 255, 255),
+            )
+            assert mesh.vertex_count == 4
+            pykraken.draw.mesh(mesh)
+            pa = renderer.read_pixels()
+            c = pa.get_at(60, 60)
+            assert (c.r, c.g, c.b) == (0, 0, 255)
+            c = pa.get_at(4, 4)
+            assert (c.r, c.g, c.b) == (255, 0, 0)
+
+            with pytest.raises(ValueError):
+                pykraken.draw.geometry_from_ndarray(None, np.zeros((3, 3), dtype=np.float32))
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_draw_geometry_rejects_out_of_range_indices():
+    np = pytest.importorskip("numpy")
+
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            red = Color(255, 0, 0, 255)
+            vertices = [
+                pykraken.Vertex(Vec2(0, 0), red),
+                pykraken.Vertex(Vec2(32, 0), red),
+                pykraken.Vertex(Vec2(0, 32), red),
+            ]
+
+            renderer.clear(Color(0, 0, 0, 255))
+            with pytest.raises(ValueError):
+                pykraken.draw.geometry(None, vertices, [0, 1, 3])
+            with pytest.raises(ValueError):
+                pykraken.draw.geometry(None, vertices, [0, -1, 2])
+
+            mesh = pykraken.draw.Mesh(
+                np.array([[32, 32], [64, 32], [32, 64]], dtype=np.float32),
+                indices=np.array([0, 1, 7], dtype=np.int32),
+            )
+            with pytest.raises(ValueError):
+                pykraken.draw.mesh(mesh)
+
+            # Rejected geometry leaves nothing behind in the shape queue
+            pykraken.draw.geometry(None, vertices, [0, 1, 2])
+            pa = renderer.read_pixels()
+            c = pa.get_at(4, 4)
+            assert (c.r, c.g, c.b) == (255, 0, 0)
+            c = pa.get_at(40, 40)
+            assert (c.r, c.g, c.b) == (0, 0, 0)
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+def test_draw_shapes_from_ndarray():
+    np = pytest.importorskip("numpy")
+
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            draw = pykraken.draw
+            white = Color(255, 255, 255, 255)
+            circles = np.array([[8.0, 8.0, 6.0], [24.0, 8.0, 6.0]], dtype=np.float32)
+            rects = np.array([[0.0, 32.0, 12.0, 12.0, 0.0], [20.0, 32.0, 12.0, 12.0, 2.0]])
+            lines = np.array([[40.0, 4.0, 60.0, 4.0]])
+            colors = np.array([[255, 0, 0, 255], [0, 0, 255, 255]], dtype=np.uint8)
+
+            renderer.clear(Color(0, 0, 0, 255))
+            draw.circles_from_ndarray(circles, white, colors=colors)
+            draw.rects_from_ndarray(rects, Color(0, 255, 0, 255))
+            draw.lines_from_ndarray(lines, white, thickness=3.0)
+
+            pa = renderer.read_pixels()
+            c = pa.get_at(8, 8)
+            assert (c.r, c.g, c.b) == (255, 0, 0)
+            c = pa.get_at(24, 8)
+            assert (c.r, c.g, c.b) == (0, 0, 255)
+            c = pa.get_at(6, 38)
+            assert (c.r, c.g, c.b) == (0, 255, 0)
+            # The second rect is an outline, so its center stays clear
+            c = pa.get_at(26, 38)
+            assert (c.r, c.g, c.b) == (0, 0, 0)
+            c = pa.get_at(20, 38)
+            assert (c.r, c.g, c.b) == (0, 255, 0)
+            c = pa.get_at(50, 4)
+            assert (c.r, c.g, c.b) == (255, 255, 255)
+
+            with pytest.raises(ValueError):
+                draw.circles_from_ndarray(np.zeros((2, 2)), white)
+            with pytest.raises(ValueError):
+                draw.rects_from_ndarray(rects, white, colors=colors[:1])
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
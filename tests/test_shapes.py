@@ -217,3 +217,40 @@ class TestPolygonMethods:
         c = p.copy()
         c.move(Vec2(100, 100))
         assert p.points[0] == Vec2(0, 0)
+
+    def test_triangles_follow_points(self):
+        pts = [Vec2(0, 0), Vec2(10, 0), Vec2(10, 5), Vec2(5, 5), Vec2(5, 10), Vec2(0, 10)]
+        p = Polygon(pts)
+        triangles = p.triangles
+        assert len(triangles) == 12
+        p.move(Vec2(5, 5))
+        p.rotate(1.0)
+        assert p.triangles == triangles
+        p.points = pts[:3]
+        assert sorted(p.triangles) == [0, 1, 2]
+
+    def test_moving_one_point_retriangulates(self):
+        def filled_area(polygon):
+            pts, tris = polygon.points, polygon.triangles
+            total = 0.0
+            for i in range(0, len(tris), 3):
+                a, b, c = pts[tris[i]], pts[tris[i + 1]], pts[tris[i + 2]]
+                total += abs((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) / 2
+            return total
+
+        p = Polygon([Vec2(0, 0), Vec2(10, 0), Vec2(10, 10), Vec2(0, 10)])
+        assert filled_area(p) == pytest.approx(100)
+
+        # Push a corner off the cached diagonal past it, which makes the old triangles overlap
+        tris = list(p.triangles)
+        corner = next(i for i in range(4) if tris.count(i) == 1)
+        opposite = (corner + 2) % 4
+        p[corner] = p[corner] * 0.3 + p[opposite] * 0.7
+        assert filled_area(p) == pytest.approx(p.area)
+        assert p.area < 100
+
+        p.invalidate_triangles()
+        assert filled_area(p) == pytest.approx(p.area)
+
+        with pytest.raises(IndexError):
+            p[4] = Vec2(0, 0)
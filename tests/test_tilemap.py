@@ -0,0 +1,480 @@
+import struct
+import zlib
+
+import pytest
+
+import pykraken
+from pykraken import renderer, tilemap, window, Color, Vec2
+
+FLIP_H = 0x80000000
+FLIP_V = 0x40000000
+FLIP_D = 0x20000000
+
+# Quadrant colors (top left, top right, bottom left, bottom right) of the tiles in each tileset
+PALETTES = (
+    ((255, 0, 0), (0, 255, 0), (0, 0, 255), (255, 255, 255)),
+    ((255, 255, 0), (0, 255, 255), (255, 0, 255), (128, 128, 128)),
+)
+
+
+def write_png(path, width, height, pixel):
+    rows = b"".join(
+        b"\x00" + b"".join(bytes((*pixel(x, y), 255)) for x in range(width)) for y in range(height)
+    )
+
+    def chunk(kind, data):
+        body = kind + data
+        return struct.pack(">I", len(data)) + body + struct.pack(">I", zlib.crc32(body))
+
+    header = struct.pack(">IIBBBBB", width, height, 8, 6, 0, 0, 0)
+    path.write_bytes(
+        b"\x89PNG\r\n\x1a\n"
+        + chunk(b"IHDR", header)
+        + chunk(b"IDAT", zlib.compress(rows))
+        + chunk(b"IEND", b"")
+    )
+
+
+def write_map(
+    directory,
+    tile_w,
+    tile_h,
+    layers,
+    tileset_count=1,
+    attributes='orientation="orthogonal"',
+    extra_layers="",
+):
+    """Write a map whose tilesets each hold one quadrant-colored tile, and return its path.
+
+    layers is a list of row lists of GIDs, which may carry the TMX flip bits. extra_layers is
+    raw layer XML appended after them.
+    """
+    tilesets = []
+    for index in range(tileset_count):
+        colors = PALETTES[index]
+        write_png(
+            directory / f"tiles{index}.png",
+            tile_w,
+            tile_h,
+            lambda x, y, colors=colors: colors[(y >= tile_h // 2) * 2 + (x >= tile_w // 2)],
+        )
+        tilesets.append(
+            f' <tileset firstgid="{index + 1}" name="tiles{index}" tilewidth="{tile_w}" '
+            f'tileheight="{tile_h}" tilecount="1" columns="1">\n'
+            f'  <image source="tiles{index}.png" width="{tile_w}" height="{tile_h}"/>\n'
+            " </tileset>\n"
+        )
+
+    height = len(layers[0])
+    width = len(layers[0][0])
+    layer_xml = []
+    for index, rows in enumerate(layers):
+        data = ",\n".join(",".join(str(gid) for gid in row) for row in rows)
+        layer_xml.append(
+            f' <layer id="{index + 1}" name="layer{index}" width="{width}" height="{height}">\n'
+            f'  <data encoding="csv">\n{data}\n  </data>\n'
+            " </layer>\n"
+        )
+
+    path = directory / "map.tmx"
+    path.write_text(
+        '<?xml version="1.0" encoding="UTF-8"?>\n'
+        f'<map version="1.10" {attributes} renderorder="right-down" width="{width}" '
+        f'height="{height}" tilewidth="{tile_w}" tileheight="{tile_h}" infinite="0" '
+        f'nextlayerid="{len(layers) + 1}" nextobjectid="1">\n'
+        + "".join(tilesets)
+        + "".join(layer_xml)
+        + extra_layers
+        + "</map>\n"
+    )
+    return path
+
+
+def expected_quadrant(gid, qx, qy):
+    """Color Tiled shows in quadrant (qx, qy) of a tile: flipped diagonally, then H, then V."""
+    if gid & FLIP_V:
+        qy = 1 - qy
+    if gid & FLIP_H:
+        qx = 1 - qx
+    if gid & FLIP_D:
+        qx, qy = qy, qx
+    tileset = (gid & 0x0FFFFFFF) - 1
+    return PALETTES[tileset][qy * 2 + qx]
+
+
+def check_tiles(pixels, rows, tile_w, tile_h, origin=(0, 0)):
+    for y, row in enumerate(rows, origin[1]):
+        for x, gid in enumerate(row, origin[0]):
+            for qy in (0, 1):
+                for qx in (0, 1):
+                    px = x * tile_w + tile_w // 4 + qx * tile_w // 2
+                    py = y * tile_h + tile_h // 4 + qy * tile_h // 2
+                    c = pixels.get_at(px, py)
+                    assert (c.r, c.g, c.b) == expected_quadrant(gid, qx, qy), (x, y, qx, qy)
+
+
+@pytest.fixture
+def render_window():
+    pykraken.init()
+    try:
+        window.create("test", 64, 64, handle_close=False)
+        try:
+            yield
+        finally:
+            window.close()
+    finally:
+        pykraken.quit()
+
+
+class TestTileLayerDraw:
+    def test_flipped_and_rotated_square_tiles(self, tmp_path, render_window):
+        # Every combination of the three flip bits
+        flips = [d | v | h for d in (0, FLIP_D) for v in (0, FLIP_V) for h in (0, FLIP_H)]
+        rows = [[1 | flip for flip in flips[:4]], [1 | flip for flip in flips[4:]]]
+        tile_map = tilemap.Map(write_map(tmp_path, 16, 16, [rows]))
+
+        renderer.clear(Color(0, 0, 0, 255))
+        tile_map.draw()
+        check_tiles(renderer.read_pixels(), rows, 16, 16)
+
+    def test_flipped_non_square_tiles(self, tmp_path, render_window):
+        rows = [[1, 1 | FLIP_H], [1 | FLIP_V, 1 | FLIP_H | FLIP_V]]
+        tile_map = tilemap.Map(write_map(tmp_path, 32, 16, [rows]))
+
+        renderer.clear(Color(0, 0, 0, 255))
+        tile_map.draw()
+        check_tiles(renderer.read_pixels(), rows, 32, 16)
+
+        # Tiles fill their cells, so the layer can be drawn from baked chunks
+        layer = tile_map.get_layer("layer0")
+        layer.cache_enabled = True
+        renderer.clear(Color(0, 0, 0, 255))
+        tile_map.draw()
+        assert layer.cache_size > 0
+        check_tiles(renderer.read_pixels(), rows, 32, 16)
+
+    def test_one_geometry_call_per_tileset(self, tmp_path, render_window):
+        if not renderer.is_frame_stats_enabled():
+            pytest.skip("built without KRAKEN_FRAME_STATS")
+
+        rows = [[(x + y) % 2 + 1 for x in range(8)] for y in range(8)]
+        flipped = [[gid | FLIP_H for gid in row] for row in rows]
+        tile_map = tilemap.Map(write_map(tmp_path, 8, 8, [rows, flipped], tileset_count=2))
+
+        renderer.clear(Color(0, 0, 0, 255))
+        renderer.present()
+        tile_map.draw()
+        renderer.present()
+
+        stats = renderer.get_frame_stats()
+        assert stats.geometry_calls == 2 * 2
+        assert stats.sprites_drawn == 2 * 64
+
+
+OBJECTS_AND_IMAGE = """ <objectgroup id="10" name="objects" color="#ff8000" opacity="0.5">
+  <object id="1" name="spawn" type="marker" x="8" y="12"><point/></object>
+  <object id="2" name="area" x="4" y="6" width="20" height="10" rotation="30"/>
+  <object id="3" name="shape" x="30" y="2"><polygon points="0,0 12,4 6,14"/></object>
+  <object id="4" name="path" x="2" y="40" visible="0"><polyline points="0,0 10,0 10,10"/></object>
+  <object id="5" name="label" x="10" y="20" width="40" height="12">
+   <text fontfamily="sans" pixelsize="12" wrap="1" color="#ff00ff00" bold="1" italic="1"
+         halign="center">Hello map</text>
+  </object>
+ </objectgroup>
+ <imagelayer id="11" name="backdrop" offsetx="3" offsety="5" opacity="0.75">
+  <image source="tiles1.png" width="16" height="16"/>
+ </imagelayer>
+"""
+
+
+def assert_same_map(a, b):
+    assert a.orientation == b.orientation
+    assert a.render_order == b.render_order
+    assert a.map_size == b.map_size
+    assert a.tile_size == b.tile_size
+    assert a.bounds == b.bounds
+    assert a.hex_side_length == b.hex_side_length
+    assert a.stagger_axis == b.stagger_axis
+    assert a.stagger_index == b.stagger_index
+    assert a.background_color == b.background_color
+
+    assert len(a.tile_sets) == len(b.tile_sets)
+    for sa, sb in zip(a.tile_sets, b.tile_sets):
+        assert (sa.first_gid, sa.last_gid, sa.name) == (sb.first_gid, sb.last_gid, sb.name)
+        assert (sa.tile_size, sa.tile_offset) == (sb.tile_size, sb.tile_offset)
+        assert (sa.spacing, sa.margin, sa.columns) == (sb.spacing, sb.margin, sb.columns)
+        assert sa.tile_count == sb.tile_count
+        assert sa.texture.size == sb.texture.size
+        assert len(sa.tiles) == len(sb.tiles)
+        for ta, tb in zip(sa.tiles, sb.tiles):
+            assert (ta.id, ta.probability, ta.clip_area) == (tb.id, tb.probability, tb.clip_area)
+
+    assert len(a.all_layers) == len(b.all_layers)
+    for la, lb in zip(a.all_layers, b.all_layers):
+        assert (la.name, la.type, la.visible) == (lb.name, lb.type, lb.visible)
+        assert la.offset == lb.offset
+        assert la.opacity == pytest.approx(lb.opacity)
+
+    assert len(a.tile_layers) == len(b.tile_layers)
+    for la, lb in zip(a.tile_layers, b.tile_layers):
+        assert la.tint == lb.tint
+        assert len(la.tiles) == len(lb.tiles)
+        for ta, tb in zip(la.tiles, lb.tiles):
+            assert (ta.id, ta.flip_flags, ta.tileset_index) == (
+                tb.id,
+                tb.flip_flags,
+                tb.tileset_index,
+            )
+
+    assert len(a.object_groups) == len(b.object_groups)
+    for ga, gb in zip(a.object_groups, b.object_groups):
+        assert ga.color == gb.color
+        assert ga.opacity == pytest.approx(gb.opacity)
+        assert ga.draw_order == gb.draw_order
+        assert len(ga.objects) == len(gb.objects)
+        for oa, ob in zip(ga.objects, gb.objects):
+            assert (oa.uid, oa.name, oa.type, oa.tile_id) == (ob.uid, ob.name, ob.type, ob.tile_id)
+            assert (oa.shape_type, oa.is_visible) == (ob.shape_type, ob.is_visible)
+            assert oa.rect == ob.rect
+            assert list(oa.vertices) == list(ob.vertices)
+            assert oa.transform.pos == ob.transform.pos
+            assert oa.transform.angle == pytest.approx(ob.transform.angle)
+            assert oa.transform.scale == ob.transform.scale
+
+            ta, tb = oa.text, ob.text
+            assert (ta.text, ta.font_family) == (tb.text, tb.font_family)
+            assert ta.pixel_size == tb.pixel_size
+            assert (ta.wrap, ta.bold, ta.italic) == (tb.wrap, tb.bold, tb.italic)
+            assert (ta.underline, ta.strikethrough, ta.kerning) == (
+                tb.underline,
+                tb.strikethrough,
+                tb.kerning,
+            )
+            assert (ta.color, ta.align) == (tb.color, tb.align)
+
+    assert len(a.image_layers) == len(b.image_layers)
+    for la, lb in zip(a.image_layers, b.image_layers):
+        assert la.opacity == pytest.approx(lb.opacity)
+        assert la.texture.size == lb.texture.size
+
+
+def write_full_map(directory):
+    rows = [
+        [1, 1 | FLIP_H, 2 | FLIP_D | FLIP_V, 0],
+        [2, 0, 1 | FLIP_V, 2 | FLIP_H | FLIP_V],
+    ]
+    return write_map(directory, 16, 16, [rows], tileset_count=2, extra_layers=OBJECTS_AND_IMAGE)
+
+
+def patch_compiled(data, old, new):
+    """Replace bytes inside the zstd frame of a compiled map and compress it again."""
+    zstandard = pytest.importorskip("zstandard")
+    header = data[:24]
+    raw = zstandard.ZstdDecompressor().decompress(data[24:])
+    assert raw.count(old) == 1
+    return header + zstandard.ZstdCompressor().compress(raw.replace(old, new))
+
+
+class TestCompiledMap:
+    def test_round_trip_empty_map(self, tmp_path):
+        path = tmp_path / "empty.knmap"
+        source = tilemap.Map()
+        source.save_compiled(path)
+
+        loaded = tilemap.Map()
+        loaded.load_compiled(path)
+        assert loaded.map_size == source.map_size
+        assert len(loaded.all_layers) == 0
+
+        from_bytes = tilemap.Map()
+        from_bytes.load_compiled_bytes(path.read_bytes())
+        assert len(from_bytes.tile_sets) == 0
+
+    def test_rejects_other_data(self):
+        with pytest.raises(RuntimeError):
+            tilemap.Map().load_compiled_bytes(b"not a compiled map at all")
+
+    def test_round_trip_matches_tmx_load(self, tmp_path, render_window):
+        source = tilemap.Map(write_full_map(tmp_path))
+        assert len(source.object_groups[0].objects) == 5
+        source.tile_layers[0].tint = Color(255, 128, 0, 200)
+
+        path = tmp_path / "map.knmap"
+        source.save_compiled(path)
+
+        loaded = tilemap.Map()
+        loaded.load_compiled(path)
+        assert_same_map(source, loaded)
+
+        from_bytes = tilemap.Map()
+        from_bytes.load_compiled_bytes(path.read_bytes(), base_dir=tmp_path)
+        assert_same_map(source, from_bytes)
+
+    def test_rejects_invalid_gid_ranges(self, tmp_path, render_window):
+        path = tmp_path / "map.knmap"
+        tilemap.Map(write_full_map(tmp_path)).save_compiled(path)
+        data = path.read_bytes()
+
+        # Each tileset record starts with its first and last GID, then its name
+        first = struct.pack("<IIQ", 1, 1, 6) + b"tiles0"
+        second = struct.pack("<IIQ", 2, 2, 6) + b"tiles1"
+        bad_records = (
+            (first, struct.pack("<IIQ", 1, 0xFFFFFFFF, 6) + b"tiles0"),
+            (first, struct.pack("<IIQ", 2, 1, 6) + b"tiles0"),
+            (first, struct.pack("<IIQ", 0, 0, 6) + b"tiles0"),
+            (second, struct.pack("<IIQ", 1, 1, 6) + b"tiles1"),
+        )
+        for old, new in bad_records:
+            with pytest.raises(RuntimeError):
+                tilemap.Map().load_compiled_bytes(patch_compiled(data, old, new), base_dir=tmp_path)
+
+    def test_rejects_truncated_data(self, tmp_path):
+        path = tmp_path / "truncated.knmap"
+        tilemap.Map().save_compiled(path)
+
+        with pytest.raises(RuntimeError):
+            tilemap.Map().load_compiled_bytes(path.read_bytes()[:-4])
+
+
+def assert_same_pixels(a, b, skip=(0, 0, 0, 0)):
+    """Compare two 64x64 captures, ignoring the (x, y, w, h) area in skip."""
+    sx, sy, sw, sh = skip
+    for y in range(64):
+        for x in range(64):
+            if sx <= x < sx + sw and sy <= y < sy + sh:
+                continue
+            ca = a.get_at(x, y)
+            cb = b.get_at(x, y)
+            assert abs(ca.r - cb.r) <= 1 and abs(ca.g - cb.g) <= 1 and abs(ca.b - cb.b) <= 1, (x, y)
+
+
+def draw_frame(tile_map):
+    renderer.clear(Color(0, 0, 0, 255))
+    tile_map.draw()
+    pixels = renderer.read_pixels()
+    renderer.present()
+    return pixels
+
+
+class TestTileLayerCache:
+    def test_baked_chunks_match_direct_draw(self, tmp_path, render_window):
+        flips = (0, FLIP_H, FLIP_V, FLIP_D, FLIP_D | FLIP_H)
+        rows = [[(x * 3 + y) % 2 + 1 | flips[(x + y * 2) % 5] for x in range(9)] for y in range(9)]
+        tile_map = tilemap.Map(write_map(tmp_path, 8, 8, [rows], tileset_count=2))
+        layer = tile_map.get_layer("layer0")
+        layer.offset = Vec2(-5, -3)
+
+        direct = draw_frame(tile_map)
+
+        # Chunks of 4 leave partial chunks along the right and bottom edges
+        layer.chunk_size = 4
+        layer.cache_enabled = True
+        cached = draw_frame(tile_map)
+        assert layer.cache_size > 0
+        assert_same_pixels(direct, cached)
+
+    def test_evicts_least_recently_drawn_chunks(self, tmp_path, render_window):
+        # Four chunks of 128x64 pixels in a row, each wider than the window
+        rows = [[1] * 64 for _ in range(8)]
+        tile_map = tilemap.Map(write_map(tmp_path, 8, 8, [rows]))
+        layer = tile_map.get_layer("layer0")
+        layer.chunk_size = 16
+        layer.cache_enabled = True
+        chunk_bytes = 128 * 64 * 4
+        layer.cache_budget = 2 * chunk_bytes
+
+        def draw_chunk(index):
+            layer.offset = Vec2(-128 * index - 32, 0)
+            draw_frame(tile_map)
+
+        draw_chunk(0)
+        draw_chunk(1)
+        assert layer.cache_size == 2 * chunk_bytes
+
+        # Baking a third chunk evicts the least recently drawn one
+        draw_chunk(2)
+        assert layer.cache_size == 2 * chunk_bytes
+
+        if not renderer.is_frame_stats_enabled():
+            return
+
+        # Chunk 1 is still baked, while chunk 0 has to be baked again
+        draw_chunk(1)
+        assert renderer.get_frame_stats().target_switches == 0
+        draw_chunk(0)
+        assert renderer.get_frame_stats().target_switches == 2
+        assert layer.cache_size == 2 * chunk_bytes
+
+    def test_set_tile_rebakes_only_its_chunk(self, tmp_path, render_window):
+        rows = [[1] * 8 for _ in range(8)]
+        tile_map = tilemap.Map(write_map(tmp_path, 8, 8, [rows], tileset_count=2))
+        layer = tile_map.get_layer("layer0")
+        layer.chunk_size = 4
+        layer.cache_enabled = True
+
+        before = draw_frame(tile_map)
+        draw_frame(tile_map)
+        if renderer.is_frame_stats_enabled():
+            assert renderer.get_frame_stats().target_switches == 0
+
+        layer.set_tile(5, 1, 2, FLIP_H >> 28)
+        after = draw_frame(tile_map)
+        if renderer.is_frame_stats_enabled():
+            assert renderer.get_frame_stats().target_switches == 2
+
+        check_tiles(after, [[2 | FLIP_H]], 8, 8, origin=(5, 1))
+        assert_same_pixels(before, after, skip=(40, 8, 8, 8))
+
+
+HEX = 'orientation="hexagonal" hexsidelength="8"'
+
+# Layout attributes, tile height and a camera position inside each 24x24 map
+CULLING_LAYOUTS = [
+    ('orientation="isometric"', 8, (190, 90)),
+    ('orientation="staggered" staggeraxis="x" staggerindex="odd"', 8, (100, 90)),
+    ('orientation="staggered" staggeraxis="x" staggerindex="even"', 8, (100, 90)),
+    ('orientation="staggered" staggeraxis="y" staggerindex="odd"', 8, (190, 50)),
+    ('orientation="staggered" staggeraxis="y" staggerindex="even"', 8, (190, 50)),
+    (f'{HEX} staggeraxis="x" staggerindex="odd"', 16, (140, 200)),
+    (f'{HEX} staggeraxis="y" staggerindex="even"', 16, (190, 150)),
+]
+
+
+class TestTileLayerCulling:
+    @pytest.mark.parametrize("attributes, tile_h, cam_pos", CULLING_LAYOUTS)
+    def test_culled_draw_matches_full_pass(
+        self, tmp_path, render_window, attributes, tile_h, cam_pos
+    ):
+        rows = [[(x * 3 + y) % 2 + 1 for x in range(24)] for y in range(24)]
+        tile_map = tilemap.Map(
+            write_map(tmp_path, 16, tile_h, [rows], tileset_count=2, attributes=attributes)
+        )
+        tile_map.get_layer("layer0").offset = Vec2(-7, 5)
+
+        cam = pykraken.Camera(set_active=True)
+        try:
+            cam.transform.pos = Vec2(*cam_pos)
+            cam.transform.angle = 0.35
+            cam.zoom = 1.5
+
+            culled = draw_frame(tile_map)
+            culled_stats = renderer.get_frame_stats()
+            tilemap._set_range_culling(False)
+            try:
+                full = draw_frame(tile_map)
+                full_stats = renderer.get_frame_stats()
+            finally:
+                tilemap._set_range_culling(True)
+        finally:
+            cam.unset()
+
+        # The view is filled with tiles, so a range that drops any of them changes pixels
+        for x, y in ((0, 0), (63, 0), (0, 63), (63, 63), (32, 32)):
+            c = culled.get_at(x, y)
+            assert (c.r, c.g, c.b) != (0, 0, 0), (x, y)
+        assert_same_pixels(culled, full)
+
+        if renderer.is_frame_stats_enabled():
+            assert culled_stats.sprites_drawn == full_stats.sprites_drawn
+            assert culled_stats.sprites_culled == full_stats.sprites_culled
+            assert culled_stats.sprites_culled > 0